@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+
+import re, sys, unicodedata
+
+# Generates two-stage case mapping tables for keysyms, from the Unicode
+# character database of the running Python and the keysymtab[] array of
+# src/keysym-utf.c.
+#
+# Each code point (for Unicode keysyms) or keysym value (for Latin-1 and
+# legacy keysyms) is split into a high and a low byte.  The high byte
+# selects a page of 256 entries; identical pages are shared, and page 0
+# maps everything to itself.  Each entry is an index into a table of
+# (lower, upper) deltas to add to the keysym.
+
+pattern = re.compile(r'^\s*\{\s*(?P<keysym>0x[0-9a-fA-F]+),\s*(?P<ucs>0x[0-9a-fA-F]+)\s*\},')
+matches = [pattern.match(line) for line in open(sys.argv[1])]
+pairs = [(int(m.group("keysym"), 16), int(m.group("ucs"), 16)) for m in matches if m]
+pairs += [(cp, cp) for cp in range(0x20, 0x7f)]
+pairs += [(cp, cp) for cp in range(0xa0, 0x100)]
+
+def simple_lower(cp):
+    s = chr(cp).lower()
+    if len(s) == 1:
+        return ord(s)
+    # The only unconditional multi-character lowercase mapping is U+0130
+    # LATIN CAPITAL LETTER I WITH DOT ABOVE -> i + COMBINING DOT ABOVE;
+    # its simple mapping is to plain i.
+    assert cp == 0x130, hex(cp)
+    return 0x69
+
+def simple_upper(cp):
+    s = chr(cp).upper()
+    if len(s) == 1:
+        return ord(s)
+    # Characters like U+1F80 GREEK SMALL LETTER ALPHA WITH PSILI AND
+    # YPOGEGRAMMENI have a multi-character full mapping, but a simple
+    # mapping to their titlecase form.
+    s = chr(cp).title()
+    if len(s) == 1 and s != chr(cp) and s.lower() == chr(cp):
+        return ord(s)
+    return cp
+
+def is_cased(cp):
+    return simple_lower(cp) != cp or simple_upper(cp) != cp
+
+# Unicode keysyms map to Unicode keysyms.
+ucs_mappings = {}
+for cp in range(0x110000):
+    if 0xd800 <= cp <= 0xdfff:
+        continue
+    if is_cased(cp):
+        ucs_mappings[cp] = (simple_lower(cp) - cp, simple_upper(cp) - cp)
+
+# Latin-1 and legacy keysyms map to a keysym with the target code point,
+# preferring one from the same block; those without one are left alone.
+by_ucs = {}
+for (keysym, ucs) in sorted(pairs):
+    by_ucs.setdefault(ucs, []).append(keysym)
+
+def legacy_target(keysym, cp):
+    candidates = by_ucs.get(cp, [])
+    for candidate in candidates:
+        if candidate >> 8 == keysym >> 8:
+            return candidate
+    return candidates[0] if candidates else keysym
+
+legacy_mappings = {}
+for (keysym, ucs) in pairs:
+    if not is_cased(ucs):
+        continue
+    lower = legacy_target(keysym, simple_lower(ucs))
+    upper = legacy_target(keysym, simple_upper(ucs))
+    if lower != keysym or upper != keysym:
+        legacy_mappings[keysym] = (lower - keysym, upper - keysym)
+
+deltas = [(0, 0)] + sorted(set(ucs_mappings.values()) |
+                           set(legacy_mappings.values()) - set([(0, 0)]))
+assert len(deltas) <= 0x100
+
+pages = [tuple([0] * 256)]
+
+def build_index(mappings):
+    index = []
+    for hi in range(max(mappings) // 256 + 1):
+        page = tuple(deltas.index(mappings[(hi << 8) | lo])
+                     if (hi << 8) | lo in mappings else 0
+                     for lo in range(256))
+        if page not in pages:
+            pages.append(page)
+        index.append(pages.index(page))
+    return index
+
+legacy_index = build_index(legacy_mappings)
+ucs_index = build_index(ucs_mappings)
+assert len(pages) <= 0x100
+
+print('''
+/**
+ * This file comes from libxkbcommon and was generated by makecase.py
+ * from src/keysym-utf.c and Unicode {version}; please do not edit it
+ * directly.
+ */'''.format(version=unicodedata.unidata_version))
+
+def print_index(prefix, index, comment):
+    print('')
+    print(comment)
+    print('static const uint8_t {prefix}_case_page_index[] = {{'.format(prefix=prefix))
+    for hi in range(0, len(index), 8):
+        print('    ' + ' '.join('{v:3},'.format(v=v) for v in index[hi:hi + 8]) +
+              ' /* 0x{hi:04x}00 */'.format(hi=hi))
+    print('};')
+
+print_index('keysym', legacy_index,
+            '/* Page of each high byte of a Latin-1 or legacy keysym. */')
+print_index('ucs', ucs_index,
+            '/* Page of each high byte of the code point of a Unicode keysym. */')
+
+print('')
+print('/* Index into case_deltas of each low byte. */')
+print('static const uint8_t case_pages[][256] = {')
+for page in pages:
+    print('    {')
+    for lo in range(0, 256, 16):
+        print('        ' + ' '.join('{v:3},'.format(v=v) for v in page[lo:lo + 16]))
+    print('    },')
+print('};')
+
+print('')
+print('/* Offsets to add to a keysym to get its lower and upper case forms. */')
+print('static const struct case_delta case_deltas[] = {')
+for (lower, upper) in deltas:
+    print('    {{ {lower}, {upper} }},'.format(lower=lower, upper=upper))
+print('};')
@@ -1,4 +1,4 @@
-#!/usr/bin/env python
+#!/usr/bin/env python3
 
 import re, sys, itertools
 
@@ -49,3 +49,183 @@ print('};\n')
 print('static const struct name_keysym keysym_to_name[] = {')
 print_entries(next(g[1]) for g in itertools.groupby(sorted(entries, key=lambda e: e[1]), key=lambda e: e[1]))
 print('};')
+
+# Minimal perfect hashes of the names, with the "hash, displace" scheme:
+# the upper half of a name's hash picks a bucket, and the displacement of
+# the bucket is either the slot itself for a single name, stored as
+# -slot - 1, or a value mixed into the lower half of the hash, chosen so
+# that the names in the bucket land in free slots.  This must match
+# keysym.c.
+
+M32 = 0xffffffff
+M64 = 0xffffffffffffffff
+
+def name_hash(name):
+    h = 0xcbf29ce484222325
+    for c in name:
+        h = ((h ^ ord(c)) * 0x100000001b3) & M64
+    return h
+
+def hash_slot(h, d, size):
+    x = (h & M32) ^ ((d * 0x9e3779b9) & M32)
+    x ^= x >> 16
+    x = (x * 0x85ebca6b) & M32
+    x ^= x >> 13
+    x = (x * 0xc2b2ae35) & M32
+    x ^= x >> 16
+    return x % size
+
+def perfect_hash(keys):
+    size = len(keys)
+    hashes = [name_hash(k) for k in keys]
+    buckets = [[] for _ in range(size)]
+    for (i, h) in enumerate(hashes):
+        buckets[(h >> 32) % size].append(i)
+
+    displacements = [0] * size
+    slots = [None] * size
+    for b in sorted(range(size), key=lambda b: -len(buckets[b])):
+        if len(buckets[b]) <= 1:
+            break
+        d = 0
+        while True:
+            s = [hash_slot(hashes[i], d, size) for i in buckets[b]]
+            if len(set(s)) == len(s) and all(slots[x] is None for x in s):
+                break
+            d += 1
+        assert d < 0x8000
+        displacements[b] = d
+        for (i, x) in zip(buckets[b], s):
+            slots[x] = i
+
+    free = [x for x in range(size) if slots[x] is None]
+    for b in range(size):
+        if len(buckets[b]) == 1:
+            x = free.pop(0)
+            displacements[b] = -x - 1
+            slots[x] = buckets[b][0]
+
+    return (displacements, slots)
+
+def print_array(decl, values):
+    print('static const {decl}[] = {{'.format(decl=decl))
+    for i in range(0, len(values), 10):
+        print('    ' + ' '.join('{v},'.format(v=v) for v in values[i:i + 10]))
+    print('};\n')
+
+names = [name for (name, _) in sorted(entries, key=lambda e: e[0].lower())]
+
+print('')
+(displacements, slots) = perfect_hash(names)
+print_array('int16_t name_hash_displacements', displacements)
+print('/* Indices into name_to_keysym. */')
+print_array('uint16_t name_hash_entries', slots)
+
+# Names which only differ by case are next to each other in name_to_keysym,
+# so the case-insensitive hash gives the first of them and their count.
+groups = [(k, len(list(g))) for (k, g) in itertools.groupby(n.lower() for n in names)]
+first = {}
+for (i, name) in enumerate(names):
+    first.setdefault(name.lower(), i)
+
+(displacements, slots) = perfect_hash([k for (k, _) in groups])
+print_array('int16_t icase_name_hash_displacements', displacements)
+print('''
+struct icase_name_range {
+    uint16_t first;
+    uint16_t count;
+};\n'''.lstrip())
+print('static const struct icase_name_range icase_name_hash_entries[] = {')
+for x in slots:
+    (key, count) = groups[x]
+    print('    {{ {first}, {count} }}, /* {key} */'.format(first=first[key], count=count, key=key))
+print('};')
+
+# name_to_keysym is sorted by lower-case name, so the names with a given
+# prefix are next to each other.  For each ASCII character, this gives the
+# first entry whose lower-case name starts with it or a later character;
+# prefix searches only need to look between two of these.
+lower_names = [name.lower() for name in names]
+first_char_index = []
+for c in range(0x81):
+    first_char_index.append(next((i for (i, name) in enumerate(lower_names)
+                                  if ord(name[0]) >= c), len(names)))
+print('')
+print('/* Indices into name_to_keysym. */')
+print_array('uint16_t name_first_char_index', first_char_index)
+
+# Classes of the keysyms below 0x10000, as in the Is*Key() macros of
+# X11/Xutil.h, as a page of enum xkb_keysym_class flags for each high byte.
+# Printable keysyms are those which xkb_keysym_to_utf32() converts to a
+# character other than a control character, using the keysymtab[] array
+# of src/keysym-utf.c.  This must match keysym.c.
+
+CLASS_MODIFIER = 1 << 0
+CLASS_KEYPAD = 1 << 1
+CLASS_FUNCTION = 1 << 2
+CLASS_CURSOR = 1 << 3
+CLASS_DEAD = 1 << 4
+CLASS_PRINTABLE = 1 << 5
+
+pattern = re.compile(r'^\s*\{\s*(?P<keysym>0x[0-9a-fA-F]+),\s*(?P<ucs>0x[0-9a-fA-F]+)\s*\},')
+matches = [pattern.match(line) for line in open(sys.argv[2])]
+keysymtab = dict((int(m.group("keysym"), 16), int(m.group("ucs"), 16)) for m in matches if m)
+value = dict(entries)
+dead = set(v for (name, v) in entries if name.startswith('dead_'))
+
+def keysym_to_utf32(ks):
+    if 0x20 <= ks <= 0x7e or 0xa0 <= ks <= 0xff:
+        return ks
+    if ks == value['KP_Space']:
+        return value['space'] & 0x7f
+    if (value['BackSpace'] <= ks <= value['Clear'] or
+            value['KP_Multiply'] <= ks <= value['KP_9'] or
+            ks in (value['Return'], value['Escape'], value['Delete'],
+                   value['KP_Tab'], value['KP_Enter'], value['KP_Equal'])):
+        return ks & 0x7f
+    return keysymtab.get(ks, 0)
+
+def is_printable(cp):
+    return ((0x20 <= cp <= 0x7e or cp >= 0xa0) and
+            not 0xd800 <= cp <= 0xdfff and cp <= 0x10ffff)
+
+def keysym_class(ks):
+    c = 0
+    if (value['Shift_L'] <= ks <= value['Hyper_R'] or
+            value['ISO_Lock'] <= ks <= value['ISO_Level5_Lock'] or
+            ks in (value['Mode_switch'], value['Num_Lock'])):
+        c |= CLASS_MODIFIER
+    if value['KP_Space'] <= ks <= value['KP_Equal']:
+        c |= CLASS_KEYPAD
+    if value['F1'] <= ks <= value['F35']:
+        c |= CLASS_FUNCTION
+    if value['Home'] <= ks < value['Select']:
+        c |= CLASS_CURSOR
+    if ks in dead:
+        c |= CLASS_DEAD
+    if is_printable(keysym_to_utf32(ks)):
+        c |= CLASS_PRINTABLE
+    return c
+
+pages = [tuple([0] * 256)]
+page_index = []
+for hi in range(0x100):
+    page = tuple(keysym_class((hi << 8) | lo) for lo in range(0x100))
+    if page not in pages:
+        pages.append(page)
+    page_index.append(pages.index(page))
+assert len(pages) <= 0x100
+
+print('/* Page of keysym_class_pages for each high byte. */')
+print('static const uint8_t keysym_class_page_index[] = {')
+for hi in range(0, 0x100, 16):
+    print('    ' + ' '.join('{v},'.format(v=v) for v in page_index[hi:hi + 16]))
+print('};\n')
+print('/* The enum xkb_keysym_class of each low byte. */')
+print('static const uint8_t keysym_class_pages[][256] = {')
+for page in pages:
+    print('    {')
+    for lo in range(0, 0x100, 16):
+        print('        ' + ' '.join('0x{v:02x},'.format(v=v) for v in page[lo:lo + 16]))
+    print('    },')
+print('};')
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+import re, sys
+
+# Generates page tables over the keysymtab[] array of src/keysym-utf.c,
+# so that keysyms and code points can be converted without searching the
+# array.
+
+pattern = re.compile(r'^\s*\{\s*(?P<keysym>0x[0-9a-fA-F]+),\s*(?P<ucs>0x[0-9a-fA-F]+)\s*\},')
+matches = [pattern.match(line) for line in open(sys.argv[1])]
+pairs = [(int(m.group("keysym"), 16), int(m.group("ucs"), 16)) for m in matches if m]
+keysyms = [keysym for (keysym, _) in pairs]
+
+assert keysyms == sorted(keysyms)
+assert len(keysyms) < 0xffff
+
+print('''
+/**
+ * This file comes from libxkbcommon and was generated by makeutf.py
+ * from src/keysym-utf.c; please do not edit it directly.
+ */
+''')
+
+def print_pages(prefix, pages, comment):
+    numbers = sorted(pages)
+    assert len(numbers) < 0xff
+
+    print('/* Index of the page of each high byte, plus 1; 0 if there is none. */')
+    print('static const uint8_t {prefix}_page_index[] = {{'.format(prefix=prefix))
+    for hi in range(numbers[-1] + 1):
+        print('    {index}, /* 0x{hi:02x}00 */'.format(
+            index=numbers.index(hi) + 1 if hi in pages else 0, hi=hi))
+    print('};\n')
+
+    print(comment)
+    print('static const uint16_t {prefix}_pages[][256] = {{'.format(prefix=prefix))
+    for hi in numbers:
+        print('    {{ /* 0x{hi:02x}00 */'.format(hi=hi))
+        page = pages[hi]
+        for lo in range(0, 256, 16):
+            print('        ' + ' '.join('{v},'.format(v=v) for v in page[lo:lo + 16]))
+        print('    },')
+    print('};')
+
+pages = {}
+for (i, keysym) in enumerate(keysyms):
+    pages.setdefault(keysym >> 8, [0] * 256)[keysym & 0xff] = i + 1
+
+print_pages('keysymtab', pages,
+            '/* Index into keysymtab of each low byte, plus 1; 0 if there is none. */')
+print('')
+
+# Where several keysyms have the same code point, the one with the same
+# value is used (e.g. EuroSign), and else the one with the lowest value.
+# Latin-1 maps to itself.
+pages = {}
+for (i, (keysym, ucs)) in enumerate(pairs):
+    if ucs < 0x100:
+        continue
+    page = pages.setdefault(ucs >> 8, [0] * 256)
+    if page[ucs & 0xff] == 0 or keysym == ucs:
+        page[ucs & 0xff] = i + 1
+
+print_pages('ucs', pages,
+            '/* Index into keysymtab of each low byte, plus 1; 0 if there is none. */')
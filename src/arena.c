@@ -0,0 +1,152 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+#define ARENA_CHUNK_SIZE 16384
+
+/* Enough for any of the types we put in an arena. */
+#define ARENA_ALIGN (2 * sizeof(void *))
+
+#define ALIGN_UP(n) (((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+struct arena_chunk {
+    struct arena_chunk *prev;
+    size_t size;
+    size_t used;
+};
+
+#define CHUNK_HEADER_SIZE ALIGN_UP(sizeof(struct arena_chunk))
+
+struct arena {
+    /* The chunk being allocated from; older chunks are linked by prev. */
+    struct arena_chunk *chunk;
+};
+
+struct arena *
+arena_new(void)
+{
+    return calloc(1, sizeof(struct arena));
+}
+
+void
+arena_free(struct arena *arena)
+{
+    struct arena_chunk *chunk, *prev;
+
+    if (!arena)
+        return;
+
+    for (chunk = arena->chunk; chunk; chunk = prev) {
+        prev = chunk->prev;
+        free(chunk);
+    }
+    free(arena);
+}
+
+void *
+arena_alloc(struct arena *arena, size_t size)
+{
+    struct arena_chunk *chunk = arena->chunk;
+    void *ret;
+
+    size = ALIGN_UP(size);
+
+    if (!chunk || chunk->size - chunk->used < size) {
+        size_t chunk_size = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+
+        chunk = malloc(CHUNK_HEADER_SIZE + chunk_size);
+        if (!chunk)
+            return NULL;
+
+        chunk->prev = arena->chunk;
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        arena->chunk = chunk;
+    }
+
+    ret = (char *) chunk + CHUNK_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    return ret;
+}
+
+char *
+arena_strndup(struct arena *arena, const char *s, size_t len)
+{
+    char *ret = arena_alloc(arena, len + 1);
+    if (!ret)
+        return NULL;
+
+    memcpy(ret, s, len);
+    ret[len] = '\0';
+    return ret;
+}
+
+char *
+arena_strdup(struct arena *arena, const char *s)
+{
+    if (!s)
+        return NULL;
+
+    return arena_strndup(arena, s, strlen(s));
+}
+
+size_t
+arena_size(struct arena *arena)
+{
+    struct arena_chunk *chunk;
+    size_t size = 0;
+
+    for (chunk = arena->chunk; chunk; chunk = chunk->prev)
+        size += chunk->used;
+
+    return size;
+}
+
+struct arena_mark
+arena_get_mark(struct arena *arena)
+{
+    struct arena_mark mark = {
+        .chunk = arena->chunk,
+        .used = arena->chunk ? arena->chunk->used : 0,
+    };
+    return mark;
+}
+
+void
+arena_release(struct arena *arena, struct arena_mark mark)
+{
+    struct arena_chunk *prev;
+
+    while (arena->chunk != mark.chunk) {
+        prev = arena->chunk->prev;
+        free(arena->chunk);
+        arena->chunk = prev;
+    }
+
+    if (arena->chunk)
+        arena->chunk->used = mark.used;
+}
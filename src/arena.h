@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+/*
+ * A bump allocator: memory is handed out from large chunks, and is only
+ * freed all at once, when the arena is freed.  This is used for the many
+ * small, short-lived objects built while parsing, e.g. the AST.
+ */
+
+struct arena;
+
+struct arena_chunk;
+
+/* A position in the arena, to go back to with arena_release(). */
+struct arena_mark {
+    struct arena_chunk *chunk;
+    size_t used;
+};
+
+struct arena *
+arena_new(void);
+
+void
+arena_free(struct arena *arena);
+
+/* Returns NULL if out of memory.  The memory is suitably aligned. */
+void *
+arena_alloc(struct arena *arena, size_t size);
+
+/* Returns NULL if @s is NULL, or if out of memory. */
+char *
+arena_strdup(struct arena *arena, const char *s);
+
+char *
+arena_strndup(struct arena *arena, const char *s, size_t len);
+
+/* The number of bytes handed out so far. */
+size_t
+arena_size(struct arena *arena);
+
+struct arena_mark
+arena_get_mark(struct arena *arena);
+
+/* Frees everything allocated since @mark was taken. */
+void
+arena_release(struct arena *arena, struct arena_mark mark);
+
+#endif
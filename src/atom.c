@@ -70,21 +70,133 @@
  *
  ********************************************************/
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "utils.h"
 #include "atom.h"
+#include "arena.h"
 
-struct atom_node {
-    xkb_atom_t left, right;
-    xkb_atom_t atom;
-    unsigned int fingerprint;
-    char *string;
+/*
+ * The table may be used from several threads at once.  Lookups don't take
+ * any lock: strings and index entries are never moved or changed once
+ * they are published, which is done with release/acquire ordering.
+ * Interning locks only the shard the string hashes to, and adding a block
+ * of atoms locks the block directory.
+ */
+
+#ifdef HAVE_PTHREAD
+#define load_acquire(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define store_release(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define fetch_add(ptr, val) __atomic_fetch_add((ptr), (val), __ATOMIC_RELAXED)
+#define mutex_init(m) pthread_mutex_init((m), NULL)
+#define mutex_destroy(m) pthread_mutex_destroy(m)
+#define mutex_lock(m) pthread_mutex_lock(m)
+#define mutex_unlock(m) pthread_mutex_unlock(m)
+#else
+#define load_acquire(ptr) (*(ptr))
+#define store_release(ptr, val) (*(ptr) = (val))
+#define fetch_add(ptr, val) ((*(ptr) += (val)) - (val))
+#define mutex_init(m) do { } while (0)
+#define mutex_destroy(m) do { } while (0)
+#define mutex_lock(m) do { } while (0)
+#define mutex_unlock(m) do { } while (0)
+#endif
+
+/* The top bits of the hash pick the shard. */
+#define ATOM_SHARD_BITS 4
+#define ATOM_NUM_SHARDS (1 << ATOM_SHARD_BITS)
+#define ATOM_INDEX_MIN_SIZE 64
+
+/* Atoms map to their strings through blocks, which are never reallocated. */
+#define ATOM_BLOCK_SIZE 512
+#define ATOM_DIRECTORY_MIN_SIZE 16
+
+/* The strings are stored with their length, followed by a NUL. */
+struct atom_string {
+    size_t len;
+    char string[];
+};
+
+/* An open-addressing hash table, probed linearly. */
+struct atom_index {
+    unsigned int size;
+    struct atom_slot {
+        uint32_t hash;
+        xkb_atom_t atom;
+    } slots[];
+};
+
+/* The blocks, by atom / ATOM_BLOCK_SIZE; NULL if not added yet. */
+struct atom_directory {
+    unsigned int size;
+    struct atom_string **blocks[];
+};
+
+struct atom_shard {
+    struct atom_index *index;
+    unsigned int count;
+    /*
+     * When the index grows, lookups may still be reading the old one,
+     * so it is kept until the table is freed.
+     */
+    darray(struct atom_index *) old_indexes;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_t mutex;
+#endif
 };
 
 struct atom_table {
-    xkb_atom_t root;
-    darray(struct atom_node) table;
+    struct atom_shard shards[ATOM_NUM_SHARDS];
+
+    /* The next atom to hand out.  Atom 0 is XKB_ATOM_NONE. */
+    xkb_atom_t next_atom;
+
+    /*
+     * When the directory grows, lookups may still be reading the old one,
+     * so it is kept until the table is freed, like the old indexes.
+     */
+    struct atom_directory *directory;
+    darray(struct atom_directory *) old_directories;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_t directory_mutex;
+#endif
+
+    /* The strings; they stay where they are until the table is freed. */
+    struct arena *strings;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_t strings_mutex;
+#endif
 };
 
+static struct atom_index *
+atom_index_new(unsigned int size)
+{
+    struct atom_index *index;
+
+    index = calloc(1, sizeof(*index) + size * sizeof(index->slots[0]));
+    if (!index)
+        return NULL;
+
+    index->size = size;
+    return index;
+}
+
+static struct atom_directory *
+atom_directory_new(unsigned int size)
+{
+    struct atom_directory *directory;
+
+    directory = calloc(1, sizeof(*directory) +
+                          size * sizeof(directory->blocks[0]));
+    if (!directory)
+        return NULL;
+
+    directory->size = size;
+    return directory;
+}
+
 struct atom_table *
 atom_table_new(void)
 {
@@ -94,132 +206,307 @@ atom_table_new(void)
     if (!table)
         return NULL;
 
-    darray_init(table->table);
-    /* The original throw-away root is here, at the illegal atom 0. */
-    darray_resize0(table->table, 1);
+    for (int i = 0; i < ATOM_NUM_SHARDS; i++)
+        mutex_init(&table->shards[i].mutex);
+    mutex_init(&table->strings_mutex);
+    mutex_init(&table->directory_mutex);
+    table->next_atom = 1;
+
+    table->strings = arena_new();
+    if (!table->strings)
+        goto err;
+
+    table->directory = atom_directory_new(ATOM_DIRECTORY_MIN_SIZE);
+    if (!table->directory)
+        goto err;
+
+    for (int i = 0; i < ATOM_NUM_SHARDS; i++) {
+        table->shards[i].index = atom_index_new(ATOM_INDEX_MIN_SIZE);
+        if (!table->shards[i].index)
+            goto err;
+    }
 
     return table;
+
+err:
+    atom_table_free(table);
+    return NULL;
 }
 
 void
 atom_table_free(struct atom_table *table)
 {
-    struct atom_node *node;
+    struct atom_index **index;
+    struct atom_directory **directory;
 
     if (!table)
         return;
 
-    darray_foreach(node, table->table)
-        free(node->string);
-    darray_free(table->table);
+    for (int i = 0; i < ATOM_NUM_SHARDS; i++) {
+        struct atom_shard *shard = &table->shards[i];
+
+        mutex_destroy(&shard->mutex);
+        free(shard->index);
+        darray_foreach(index, shard->old_indexes)
+            free(*index);
+        darray_free(shard->old_indexes);
+    }
+    mutex_destroy(&table->strings_mutex);
+    mutex_destroy(&table->directory_mutex);
+    /* The old directories only point to blocks which are still in use. */
+    if (table->directory)
+        for (unsigned int i = 0; i < table->directory->size; i++)
+            free(table->directory->blocks[i]);
+    free(table->directory);
+    darray_foreach(directory, table->old_directories)
+        free(*directory);
+    darray_free(table->old_directories);
+    arena_free(table->strings);
     free(table);
 }
 
+static struct atom_string **
+get_block(struct atom_table *table, unsigned int block_index)
+{
+    struct atom_directory *directory = load_acquire(&table->directory);
+
+    if (block_index >= directory->size)
+        return NULL;
+
+    return load_acquire(&directory->blocks[block_index]);
+}
+
+static struct atom_string *
+get_string(struct atom_table *table, xkb_atom_t atom)
+{
+    struct atom_string **block;
+
+    block = get_block(table, atom / ATOM_BLOCK_SIZE);
+    if (!block)
+        return NULL;
+
+    return load_acquire(&block[atom % ATOM_BLOCK_SIZE]);
+}
+
+/*
+ * Adds the block, growing the directory if it is too small.  This happens
+ * once per ATOM_BLOCK_SIZE atoms, so it is done under a lock; the block
+ * can't be added to a directory while it is copied to a larger one.
+ */
+static struct atom_string **
+add_block(struct atom_table *table, unsigned int block_index)
+{
+    struct atom_directory *directory, *old;
+    struct atom_string **block = NULL;
+
+    mutex_lock(&table->directory_mutex);
+
+    directory = table->directory;
+    if (block_index >= directory->size) {
+        old = directory;
+        directory = atom_directory_new(MAX(old->size * 2, block_index + 1));
+        if (!directory)
+            goto out;
+        memcpy(directory->blocks, old->blocks,
+               old->size * sizeof(old->blocks[0]));
+        darray_append(table->old_directories, old);
+        store_release(&table->directory, directory);
+    }
+
+    /* Another thread may have added it meanwhile. */
+    block = directory->blocks[block_index];
+    if (!block) {
+        block = calloc(ATOM_BLOCK_SIZE, sizeof(*block));
+        if (block)
+            store_release(&directory->blocks[block_index], block);
+    }
+
+out:
+    mutex_unlock(&table->directory_mutex);
+    return block;
+}
+
+/* Returns a new atom, with its string set to @str. */
+static xkb_atom_t
+alloc_atom(struct atom_table *table, struct atom_string *str)
+{
+    xkb_atom_t atom;
+    struct atom_string **block;
+
+    atom = fetch_add(&table->next_atom, 1);
+    block = get_block(table, atom / ATOM_BLOCK_SIZE);
+    if (!block)
+        block = add_block(table, atom / ATOM_BLOCK_SIZE);
+    if (!block)
+        return XKB_ATOM_NONE;
+
+    store_release(&block[atom % ATOM_BLOCK_SIZE], str);
+    return atom;
+}
+
 const char *
 atom_text(struct atom_table *table, xkb_atom_t atom)
 {
-    if (atom == XKB_ATOM_NONE || atom >= darray_size(table->table))
+    struct atom_string *str;
+
+    if (atom == XKB_ATOM_NONE)
         return NULL;
 
-    return darray_item(table->table, atom).string;
+    str = get_string(table, atom);
+    return str ? str->string : NULL;
 }
 
-static bool
-find_atom_pointer(struct atom_table *table, const char *string, size_t len,
-                  xkb_atom_t **atomp_out, unsigned int *fingerprint_out)
+unsigned int
+atom_table_size(struct atom_table *table)
+{
+    return load_acquire(&table->next_atom) - 1;
+}
+
+/* FNV-1a. */
+static uint32_t
+atom_hash(const char *string, size_t len)
 {
-    xkb_atom_t *atomp = &table->root;
-    unsigned int fingerprint = 0;
-    bool found = false;
+    uint32_t hash = 2166136261u;
 
-    for (size_t i = 0; i < (len + 1) / 2; i++) {
-        fingerprint = fingerprint * 27 + string[i];
-        fingerprint = fingerprint * 27 + string[len - 1 - i];
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char) string[i];
+        hash *= 16777619u;
     }
 
-    while (*atomp != XKB_ATOM_NONE) {
-        struct atom_node *node = &darray_item(table->table, *atomp);
+    return hash;
+}
 
-        if (fingerprint < node->fingerprint) {
-            atomp = &node->left;
-        }
-        else if (fingerprint > node->fingerprint) {
-            atomp = &node->right;
-        }
-        else {
-            /* Now start testing the strings. */
-            const int cmp = strncmp(string, node->string, len);
-            if (cmp < 0 || (cmp == 0 && len < strlen(node->string))) {
-                atomp = &node->left;
-            }
-            else if (cmp > 0) {
-                atomp = &node->right;
-            }
-            else {
-                found = true;
-                break;
-            }
+static struct atom_shard *
+get_shard(struct atom_table *table, uint32_t hash)
+{
+    return &table->shards[hash >> (32 - ATOM_SHARD_BITS)];
+}
+
+/*
+ * Returns the slot in @index which holds the atom for @string, or an
+ * empty slot where it should be put if it's not there.
+ */
+static struct atom_slot *
+find_atom_slot(struct atom_table *table, struct atom_index *index,
+               const char *string, size_t len, uint32_t hash)
+{
+    const unsigned int mask = index->size - 1;
+    struct atom_slot *slot;
+    xkb_atom_t atom;
+
+    for (unsigned int i = hash & mask; ; i = (i + 1) & mask) {
+        slot = &index->slots[i];
+
+        atom = load_acquire(&slot->atom);
+        if (atom == XKB_ATOM_NONE)
+            return slot;
+
+        if (slot->hash == hash) {
+            struct atom_string *str = get_string(table, atom);
+            if (str->len == len && memcmp(str->string, string, len) == 0)
+                return slot;
         }
     }
+}
+
+/* Doubles the size of @shard's index.  Called with the shard locked. */
+static bool
+grow_index(struct atom_shard *shard)
+{
+    struct atom_index *old = shard->index, *index;
+
+    index = atom_index_new(old->size * 2);
+    if (!index)
+        return false;
+
+    for (unsigned int i = 0; i < old->size; i++) {
+        const struct atom_slot *slot = &old->slots[i];
+        unsigned int j;
+
+        if (slot->atom == XKB_ATOM_NONE)
+            continue;
+
+        /* The strings are all different, so only look for a free slot. */
+        for (j = slot->hash & (index->size - 1);
+             index->slots[j].atom != XKB_ATOM_NONE;
+             j = (j + 1) & (index->size - 1));
+        index->slots[j] = *slot;
+    }
 
-    if (fingerprint_out)
-        *fingerprint_out = fingerprint;
-    if (atomp_out)
-        *atomp_out = atomp;
-    return found;
+    darray_append(shard->old_indexes, old);
+    store_release(&shard->index, index);
+    return true;
 }
 
 xkb_atom_t
 atom_lookup(struct atom_table *table, const char *string, size_t len)
 {
-    xkb_atom_t *atomp;
+    uint32_t hash;
+    struct atom_index *index;
 
     if (!string)
         return XKB_ATOM_NONE;
 
-    if (!find_atom_pointer(table, string, len, &atomp, NULL))
-        return XKB_ATOM_NONE;
+    hash = atom_hash(string, len);
+    index = load_acquire(&get_shard(table, hash)->index);
 
-    return *atomp;
+    return load_acquire(&find_atom_slot(table, index, string, len,
+                                        hash)->atom);
 }
 
-/*
- * If steal is true, we do not strdup @string; therefore it must be
- * dynamically allocated, NUL-terminated, not be free'd by the caller
- * and not be used afterwards. Use to avoid some redundant allocations.
- */
 xkb_atom_t
-atom_intern(struct atom_table *table, const char *string, size_t len,
-            bool steal)
+atom_intern(struct atom_table *table, const char *string, size_t len)
 {
-    xkb_atom_t *atomp;
-    struct atom_node node;
-    unsigned int fingerprint;
+    uint32_t hash;
+    struct atom_shard *shard;
+    struct atom_slot *slot;
+    struct atom_string *str;
+    xkb_atom_t atom;
 
     if (!string)
         return XKB_ATOM_NONE;
 
-    if (find_atom_pointer(table, string, len, &atomp, &fingerprint)) {
-        if (steal)
-            free(UNCONSTIFY(string));
-        return *atomp;
-    }
+    hash = atom_hash(string, len);
+    shard = get_shard(table, hash);
 
-    if (steal) {
-        node.string = UNCONSTIFY(string);
-    }
-    else {
-        node.string = strndup(string, len);
-        if (!node.string)
-            return XKB_ATOM_NONE;
-    }
+    slot = find_atom_slot(table, load_acquire(&shard->index), string, len,
+                          hash);
+    atom = load_acquire(&slot->atom);
+    if (atom != XKB_ATOM_NONE)
+        return atom;
+
+    mutex_lock(&shard->mutex);
+
+    /* Keep the load factor at most 1/2. */
+    if ((shard->count + 1) * 2 > shard->index->size && !grow_index(shard))
+        goto out;
+
+    /* Search again, it might have been added since. */
+    slot = find_atom_slot(table, shard->index, string, len, hash);
+    atom = slot->atom;
+    if (atom != XKB_ATOM_NONE)
+        goto out;
+
+    mutex_lock(&table->strings_mutex);
+    str = arena_alloc(table->strings, sizeof(*str) + len + 1);
+    mutex_unlock(&table->strings_mutex);
+    if (!str)
+        goto out;
+
+    str->len = len;
+    memcpy(str->string, string, len);
+    str->string[len] = '\0';
+
+    atom = alloc_atom(table, str);
+    if (atom == XKB_ATOM_NONE)
+        goto out;
 
-    node.left = node.right = XKB_ATOM_NONE;
-    node.fingerprint = fingerprint;
-    node.atom = darray_size(table->table);
-    /* Do this before the append, as it may realloc and change the offsets. */
-    *atomp = node.atom;
-    darray_append(table->table, node);
+    slot->hash = hash;
+    /* The slot is complete; make it visible to lookups. */
+    store_release(&slot->atom, atom);
+    shard->count++;
 
-    return node.atom;
+out:
+    mutex_unlock(&shard->mutex);
+    return atom;
 }
@@ -40,10 +40,13 @@ xkb_atom_t
 atom_lookup(struct atom_table *table, const char *string, size_t len);
 
 xkb_atom_t
-atom_intern(struct atom_table *table, const char *string, size_t len,
-            bool steal);
+atom_intern(struct atom_table *table, const char *string, size_t len);
 
 const char *
 atom_text(struct atom_table *table, xkb_atom_t atom);
 
+/* The number of atoms interned so far. */
+unsigned int
+atom_table_size(struct atom_table *table);
+
 #endif /* ATOM_H */
@@ -33,6 +33,12 @@
 #include "utils.h"
 #include "context.h"
 
+#ifdef HAVE_PTHREAD
+#define per_thread __thread
+#else
+#define per_thread
+#endif
+
 unsigned int
 xkb_context_num_failed_include_paths(struct xkb_context *ctx)
 {
@@ -58,13 +64,7 @@ xkb_atom_lookup(struct xkb_context *ctx, const char *string)
 xkb_atom_t
 xkb_atom_intern(struct xkb_context *ctx, const char *string, size_t len)
 {
-    return atom_intern(ctx->atom_table, string, len, false);
-}
-
-xkb_atom_t
-xkb_atom_steal(struct xkb_context *ctx, char *string)
-{
-    return atom_intern(ctx->atom_table, string, strlen(string), true);
+    return atom_intern(ctx->atom_table, string, len);
 }
 
 const char *
@@ -73,6 +73,8 @@ xkb_atom_text(struct xkb_context *ctx, xkb_atom_t atom)
     return atom_text(ctx->atom_table, atom);
 }
 
+static per_thread darray_log_message *log_queue;
+
 void
 xkb_log(struct xkb_context *ctx, enum xkb_log_level level, int verbosity,
         const char *fmt, ...)
@@ -82,24 +84,76 @@ xkb_log(struct xkb_context *ctx, enum xkb_log_level level, int verbosity,
     if (ctx->log_level < level || ctx->log_verbosity < verbosity)
         return;
 
+    if (log_queue) {
+        struct log_message msg;
+        int ret;
+
+        va_start(args, fmt);
+        ret = vasprintf(&msg.text, fmt, args);
+        va_end(args);
+        if (ret < 0)
+            return;
+
+        msg.level = level;
+        darray_append(*log_queue, msg);
+        return;
+    }
+
     va_start(args, fmt);
     ctx->log_fn(ctx, level, fmt, args);
     va_end(args);
 }
 
+void
+xkb_log_set_queue(darray_log_message *queue)
+{
+    log_queue = queue;
+}
+
+ATTR_PRINTF(3, 4) static void
+log_queued(struct xkb_context *ctx, enum xkb_log_level level,
+           const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    ctx->log_fn(ctx, level, fmt, args);
+    va_end(args);
+}
+
+void
+xkb_log_flush_queue(struct xkb_context *ctx, darray_log_message *queue)
+{
+    struct log_message *msg;
+
+    darray_foreach(msg, *queue) {
+        log_queued(ctx, msg->level, "%s", msg->text);
+        free(msg->text);
+    }
+    darray_free(*queue);
+}
+
+/*
+ * Buffer for the *Text() functions.  Each thread has its own, since a
+ * compilation in another thread would soon reuse the space of a string
+ * which is still being used.
+ */
+static per_thread char text_buffer[2048];
+static per_thread size_t text_next;
+
 char *
 xkb_context_get_buffer(struct xkb_context *ctx, size_t size)
 {
     char *rtrn;
 
-    if (size >= sizeof(ctx->text_buffer))
+    if (size >= sizeof(text_buffer))
         return NULL;
 
-    if (sizeof(ctx->text_buffer) - ctx->text_next <= size)
-        ctx->text_next = 0;
+    if (sizeof(text_buffer) - text_next <= size)
+        text_next = 0;
 
-    rtrn = &ctx->text_buffer[ctx->text_next];
-    ctx->text_next += size;
+    rtrn = &text_buffer[text_next];
+    text_next += size;
 
     return rtrn;
 }
@@ -33,6 +33,13 @@
 #include "utils.h"
 #include "context.h"
 
+/* Keymaps take a reference, and may be created in several threads. */
+#ifdef HAVE_PTHREAD
+#define fetch_add(ptr, val) __atomic_fetch_add((ptr), (val), __ATOMIC_ACQ_REL)
+#else
+#define fetch_add(ptr, val) ((*(ptr) += (val)) - (val))
+#endif
+
 /**
  * Append one directory to the context's include path.
  */
@@ -109,6 +116,8 @@ xkb_context_include_path_clear(struct xkb_context *ctx)
     darray_foreach(path, ctx->failed_includes)
         free(*path);
     darray_free(ctx->failed_includes);
+
+    xkb_context_include_index_clear(ctx);
 }
 
 /**
@@ -149,7 +158,7 @@ xkb_context_include_path_get(struct xkb_context *ctx, unsigned int idx)
 XKB_EXPORT struct xkb_context *
 xkb_context_ref(struct xkb_context *ctx)
 {
-    ctx->refcnt++;
+    fetch_add(&ctx->refcnt, 1);
     return ctx;
 }
 
@@ -160,10 +169,15 @@ xkb_context_ref(struct xkb_context *ctx)
 XKB_EXPORT void
 xkb_context_unref(struct xkb_context *ctx)
 {
-    if (!ctx || --ctx->refcnt > 0)
+    if (!ctx || fetch_add(&ctx->refcnt, -1) > 1)
         return;
 
     xkb_context_include_path_clear(ctx);
+    free(ctx->cache_path);
+    rules_cache_free(ctx->rules_cache);
+    free(ctx->stats);
+    if (ctx->x11_atom_cache)
+        ctx->x11_atom_cache->free(ctx->x11_atom_cache);
     atom_table_free(ctx->atom_table);
     free(ctx);
 }
@@ -271,7 +285,8 @@ xkb_context_new(enum xkb_context_flags flags)
     ctx->use_environment_names = !(flags & XKB_CONTEXT_NO_ENVIRONMENT_NAMES);
 
     ctx->atom_table = atom_table_new();
-    if (!ctx->atom_table) {
+    ctx->rules_cache = rules_cache_new();
+    if (!ctx->atom_table || !ctx->rules_cache) {
         xkb_context_unref(ctx);
         return NULL;
     }
@@ -325,3 +340,37 @@ xkb_context_set_user_data(struct xkb_context *ctx, void *user_data)
 {
     ctx->user_data = user_data;
 }
+
+XKB_EXPORT int
+xkb_context_set_cache_path(struct xkb_context *ctx, const char *path)
+{
+    struct stat stat_buf;
+    char *tmp = NULL;
+
+    if (path) {
+        if (stat(path, &stat_buf) != 0 || !S_ISDIR(stat_buf.st_mode)) {
+            log_err(ctx, "Cache path %s is not a directory\n", path);
+            return 0;
+        }
+
+        if (access(path, R_OK | W_OK | X_OK) != 0) {
+            log_err(ctx, "Cache path %s is not accessible: %s\n",
+                    path, strerror(errno));
+            return 0;
+        }
+
+        tmp = strdup(path);
+        if (!tmp)
+            return 0;
+    }
+
+    free(ctx->cache_path);
+    ctx->cache_path = tmp;
+    return 1;
+}
+
+XKB_EXPORT const char *
+xkb_context_get_cache_path(struct xkb_context *ctx)
+{
+    return ctx->cache_path;
+}
@@ -28,6 +28,14 @@
 
 #include "atom.h"
 
+/*
+ * Data which libxkbcommon-x11 keeps in a context.  It is published with a
+ * single atomic store, so it carries the function which frees it.
+ */
+struct x11_context_data {
+    void (*free)(struct x11_context_data *data);
+};
+
 struct xkb_context {
     int refcnt;
 
@@ -43,15 +51,44 @@ struct xkb_context {
     darray(char *) includes;
     darray(char *) failed_includes;
 
+    /* Safe to use from several threads; see atom.c. */
     struct atom_table *atom_table;
 
-    /* Buffer for the *Text() functions. */
-    char text_buffer[2048];
-    size_t text_next;
+    /* Directory for the compiled keymap cache, or NULL if disabled. */
+    char *cache_path;
+    /* Entries of the include path directories; see include.c. */
+    struct include_index *include_index;
+
+    /* Compilation statistics, or NULL if disabled; see stats.c. */
+    struct context_stats *stats;
+    xkb_context_stats_fn stats_fn;
+    void *stats_fn_data;
+
+    /* Cache of X atom names, owned by libxkbcommon-x11; see src/x11/util.c. */
+    struct x11_context_data *x11_atom_cache;
+
+    /*
+     * Rules files compiled by xkb_components_from_rules(); locked, so
+     * it can be shared by compilations in several threads.
+     */
+    struct rules_cache *rules_cache;
 
     unsigned int use_environment_names : 1;
 };
 
+struct rules_cache *
+rules_cache_new(void);
+
+void
+rules_cache_free(struct rules_cache *cache);
+
+void
+xkb_context_include_index_clear(struct xkb_context *ctx);
+
+/* Read the include path directories again when they are next looked in. */
+void
+xkb_context_include_index_invalidate(struct xkb_context *ctx);
+
 unsigned int
 xkb_context_num_failed_include_paths(struct xkb_context *ctx);
 
@@ -72,15 +109,6 @@ xkb_atom_intern(struct xkb_context *ctx, const char *string, size_t len);
 #define xkb_atom_intern_literal(ctx, literal) \
     xkb_atom_intern((ctx), (literal), sizeof(literal) - 1)
 
-/**
- * If @string is dynamically allocated, NUL-terminated, free'd immediately
- * after being interned, and not used afterwards, use this function
- * instead of xkb_atom_intern to avoid some unnecessary allocations.
- * The caller should not use or free the passed in string afterwards.
- */
-xkb_atom_t
-xkb_atom_steal(struct xkb_context *ctx, char *string);
-
 const char *
 xkb_atom_text(struct xkb_context *ctx, xkb_atom_t atom);
 
@@ -91,6 +119,25 @@ ATTR_PRINTF(4, 5) void
 xkb_log(struct xkb_context *ctx, enum xkb_log_level level, int verbosity,
         const char *fmt, ...);
 
+struct log_message {
+    enum xkb_log_level level;
+    char *text;
+};
+
+typedef darray(struct log_message) darray_log_message;
+
+/*
+ * While a thread has a queue set, the messages it logs are kept there
+ * instead of being passed to the log function.  The thread which started
+ * it then passes them on with xkb_log_flush_queue(), so that the log
+ * function is never called from a thread the user doesn't know about.
+ */
+void
+xkb_log_set_queue(darray_log_message *queue);
+
+void
+xkb_log_flush_queue(struct xkb_context *ctx, darray_log_message *queue);
+
 void
 xkb_context_sanitize_rule_names(struct xkb_context *ctx,
                                 struct xkb_rule_names *rmlvo);
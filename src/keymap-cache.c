@@ -0,0 +1,1129 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "keymap.h"
+#include "keymap-cache.h"
+
+/*
+ * On-disk cache of compiled keymaps.
+ *
+ * Each entry is stored in its own file in the context's cache directory,
+ * named after a hash of the RMLVO names and the include path it was
+ * compiled with.  The entry repeats these, so that hash collisions are
+ * detected, followed by the size and modification time of every file
+ * read while compiling it (see FindFileInXkbPath()), and of the type
+ * directories (symbols/ etc.) of every include path.  The latter catch
+ * files which were added earlier in the include path and would now
+ * shadow the ones which were used.  If any of these changed, the entry
+ * is ignored, and replaced after compiling the keymap again.
+ *
+ * The keymap itself is stored field by field, with atoms as strings.
+ * The format is private and native-endian; entries written by a
+ * different version of the format are simply ignored.
+ */
+
+#define CACHE_MAGIC "xkbcache"
+#define CACHE_VERSION 2
+
+static const char *const cache_type_dirs[] = {
+    "keycodes", "types", "compat", "symbols", "rules",
+};
+
+struct file_stamp {
+    char *path;
+    /* -1 if the file does not exist. */
+    int64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+};
+
+struct cache_deps {
+    darray(struct file_stamp) stamps;
+    bool failed;
+#ifdef HAVE_PTHREAD
+    /* Files are added from several threads in a parallel compilation. */
+    pthread_mutex_t mutex;
+#endif
+};
+
+static void
+file_stamp_set(struct file_stamp *stamp, const struct stat *stat_buf)
+{
+    if (stat_buf) {
+        stamp->size = stat_buf->st_size;
+        stamp->mtime_sec = stat_buf->st_mtim.tv_sec;
+        stamp->mtime_nsec = stat_buf->st_mtim.tv_nsec;
+    }
+    else {
+        stamp->size = -1;
+        stamp->mtime_sec = 0;
+        stamp->mtime_nsec = 0;
+    }
+}
+
+static void
+cache_deps_add_stamp(struct cache_deps *deps, const char *path,
+                     const struct stat *stat_buf)
+{
+    struct file_stamp *stamp;
+    struct file_stamp new_stamp;
+
+    /* The same file is often included many times. */
+    darray_foreach(stamp, deps->stamps)
+        if (streq(stamp->path, path))
+            return;
+
+    new_stamp.path = strdup(path);
+    if (!new_stamp.path) {
+        deps->failed = true;
+        return;
+    }
+
+    file_stamp_set(&new_stamp, stat_buf);
+    darray_append(deps->stamps, new_stamp);
+}
+
+struct cache_deps *
+cache_deps_new(struct xkb_context *ctx)
+{
+    struct cache_deps *deps;
+    char *path;
+    struct stat stat_buf;
+
+    deps = calloc(1, sizeof(*deps));
+    if (!deps)
+        return NULL;
+
+#ifdef HAVE_PTHREAD
+    pthread_mutex_init(&deps->mutex, NULL);
+#endif
+
+    for (unsigned i = 0; i < xkb_context_num_include_paths(ctx); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(cache_type_dirs); j++) {
+            if (asprintf(&path, "%s/%s", xkb_context_include_path_get(ctx, i),
+                         cache_type_dirs[j]) < 0) {
+                deps->failed = true;
+                continue;
+            }
+
+            cache_deps_add_stamp(deps, path,
+                                 stat(path, &stat_buf) == 0 ? &stat_buf : NULL);
+            free(path);
+        }
+    }
+
+    return deps;
+}
+
+void
+cache_deps_free(struct cache_deps *deps)
+{
+    struct file_stamp *stamp;
+
+    if (!deps)
+        return;
+
+    darray_foreach(stamp, deps->stamps)
+        free(stamp->path);
+    darray_free(deps->stamps);
+#ifdef HAVE_PTHREAD
+    pthread_mutex_destroy(&deps->mutex);
+#endif
+    free(deps);
+}
+
+void
+cache_deps_add_file(struct cache_deps *deps, const char *path, FILE *file)
+{
+    struct stat stat_buf;
+    bool ok;
+
+    ok = (fstat(fileno(file), &stat_buf) == 0);
+
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&deps->mutex);
+#endif
+    if (ok)
+        cache_deps_add_stamp(deps, path, &stat_buf);
+    else
+        deps->failed = true;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_unlock(&deps->mutex);
+#endif
+}
+
+static char *
+cache_entry_path(struct xkb_context *ctx, const struct xkb_rule_names *rmlvo)
+{
+    /* FNV-1a; the strings are hashed with their terminating NUL. */
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    const char *strings[] = {
+        rmlvo->rules, rmlvo->model, rmlvo->layout, rmlvo->variant,
+        rmlvo->options,
+    };
+    char *path;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(strings) +
+                            xkb_context_num_include_paths(ctx); i++) {
+        const char *s = (i < ARRAY_SIZE(strings) ? strings[i] :
+            xkb_context_include_path_get(ctx, i - ARRAY_SIZE(strings)));
+
+        s = strempty(s);
+        do {
+            hash ^= (unsigned char) *s;
+            hash *= UINT64_C(0x100000001b3);
+        } while (*s++);
+    }
+
+    if (asprintf(&path, "%s/%016" PRIx64 ".xkbcache",
+                 ctx->cache_path, hash) < 0)
+        return NULL;
+
+    return path;
+}
+
+/*
+ * FNV-1a over the whole entry, stored at its end.  Each step is a bijection
+ * of the hash state, so changing any single byte changes the checksum.
+ */
+uint64_t
+keymap_cache_checksum(const char *data, size_t len)
+{
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char) data[i];
+        hash *= UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
+/***====================================================================***/
+
+struct writer {
+    darray_char buf;
+};
+
+static void
+write_data(struct writer *w, const void *data, size_t size)
+{
+    darray_append_items(w->buf, (const char *) data, size);
+}
+
+static void
+write_u8(struct writer *w, uint8_t v)
+{
+    write_data(w, &v, sizeof(v));
+}
+
+static void
+write_u32(struct writer *w, uint32_t v)
+{
+    write_data(w, &v, sizeof(v));
+}
+
+static void
+write_i64(struct writer *w, int64_t v)
+{
+    write_data(w, &v, sizeof(v));
+}
+
+static void
+write_string(struct writer *w, const char *s)
+{
+    size_t len;
+
+    if (!s) {
+        write_u32(w, UINT32_MAX);
+        return;
+    }
+
+    len = strlen(s);
+    write_u32(w, len);
+    write_data(w, s, len);
+}
+
+static void
+write_atom(struct writer *w, struct xkb_context *ctx, xkb_atom_t atom)
+{
+    write_string(w, xkb_atom_text(ctx, atom));
+}
+
+static void
+write_mods(struct writer *w, const struct xkb_mods *mods)
+{
+    write_u32(w, mods->mods);
+    write_u32(w, mods->mask);
+}
+
+static void
+write_action(struct writer *w, const union xkb_action *action)
+{
+    write_u32(w, action->type);
+
+    switch (action->type) {
+    case ACTION_TYPE_MOD_SET:
+    case ACTION_TYPE_MOD_LATCH:
+    case ACTION_TYPE_MOD_LOCK:
+        write_u32(w, action->mods.flags);
+        write_mods(w, &action->mods.mods);
+        break;
+
+    case ACTION_TYPE_GROUP_SET:
+    case ACTION_TYPE_GROUP_LATCH:
+    case ACTION_TYPE_GROUP_LOCK:
+        write_u32(w, action->group.flags);
+        write_u32(w, (uint32_t) action->group.group);
+        break;
+
+    case ACTION_TYPE_PTR_MOVE:
+        write_u32(w, action->ptr.flags);
+        write_u32(w, (uint16_t) action->ptr.x);
+        write_u32(w, (uint16_t) action->ptr.y);
+        break;
+
+    case ACTION_TYPE_PTR_BUTTON:
+    case ACTION_TYPE_PTR_LOCK:
+        write_u32(w, action->btn.flags);
+        write_u8(w, action->btn.count);
+        write_u8(w, action->btn.button);
+        break;
+
+    case ACTION_TYPE_PTR_DEFAULT:
+        write_u32(w, action->dflt.flags);
+        write_u8(w, (uint8_t) action->dflt.value);
+        break;
+
+    case ACTION_TYPE_SWITCH_VT:
+        write_u32(w, action->screen.flags);
+        write_u8(w, (uint8_t) action->screen.screen);
+        break;
+
+    case ACTION_TYPE_CTRL_SET:
+    case ACTION_TYPE_CTRL_LOCK:
+        write_u32(w, action->ctrls.flags);
+        write_u32(w, action->ctrls.ctrls);
+        break;
+
+    case ACTION_TYPE_NONE:
+    case ACTION_TYPE_TERMINATE:
+        break;
+
+    default:
+        write_data(w, action->priv.data, sizeof(action->priv.data));
+        break;
+    }
+}
+
+static void
+write_keymap(struct writer *w, struct xkb_keymap *keymap)
+{
+    struct xkb_context *ctx = keymap->ctx;
+    const struct xkb_mod *mod;
+    const struct xkb_led *led;
+    const struct xkb_key *key;
+
+    write_u32(w, keymap->enabled_ctrls);
+
+    write_u32(w, keymap->mods.num_mods);
+    xkb_mods_foreach(mod, &keymap->mods) {
+        write_atom(w, ctx, mod->name);
+        write_u32(w, mod->type);
+        write_u32(w, mod->mapping);
+    }
+
+    write_u32(w, keymap->num_types);
+    for (unsigned i = 0; i < keymap->num_types; i++) {
+        const struct xkb_key_type *type = &keymap->types[i];
+
+        write_atom(w, ctx, type->name);
+        write_mods(w, &type->mods);
+        write_u32(w, type->num_levels);
+        write_u8(w, type->level_names != NULL);
+        if (type->level_names)
+            for (unsigned j = 0; j < type->num_levels; j++)
+                write_atom(w, ctx, type->level_names[j]);
+        write_u32(w, type->num_entries);
+        for (unsigned j = 0; j < type->num_entries; j++) {
+            write_u32(w, type->entries[j].level);
+            write_mods(w, &type->entries[j].mods);
+            write_mods(w, &type->entries[j].preserve);
+        }
+    }
+
+    write_u32(w, keymap->num_key_aliases);
+    for (unsigned i = 0; i < keymap->num_key_aliases; i++) {
+        write_atom(w, ctx, keymap->key_aliases[i].real);
+        write_atom(w, ctx, keymap->key_aliases[i].alias);
+    }
+
+    write_u32(w, keymap->num_sym_interprets);
+    for (unsigned i = 0; i < keymap->num_sym_interprets; i++) {
+        const struct xkb_sym_interpret *si = &keymap->sym_interprets[i];
+
+        write_u32(w, si->sym);
+        write_u32(w, si->match);
+        write_u32(w, si->mods);
+        write_u32(w, si->virtual_mod);
+        write_action(w, &si->action);
+        write_u8(w, si->level_one_only);
+        write_u8(w, si->repeat);
+    }
+
+    write_u32(w, keymap->num_groups);
+    write_u32(w, keymap->num_group_names);
+    for (unsigned i = 0; i < keymap->num_group_names; i++)
+        write_atom(w, ctx, keymap->group_names[i]);
+
+    write_u32(w, keymap->num_leds);
+    xkb_leds_foreach(led, keymap) {
+        write_atom(w, ctx, led->name);
+        write_u32(w, led->which_groups);
+        write_u32(w, led->groups);
+        write_u32(w, led->which_mods);
+        write_mods(w, &led->mods);
+        write_u32(w, led->ctrls);
+    }
+
+    write_u32(w, keymap->min_key_code);
+    write_u32(w, keymap->max_key_code);
+    xkb_keys_foreach(key, keymap) {
+        write_atom(w, ctx, key->name);
+        write_u32(w, key->explicit);
+        write_u32(w, key->modmap);
+        write_u32(w, key->vmodmap);
+        write_u8(w, key->repeats);
+        write_u32(w, key->out_of_range_group_action);
+        write_u32(w, key->out_of_range_group_number);
+        write_u32(w, key->num_groups);
+        for (unsigned i = 0; i < key->num_groups; i++) {
+            const struct xkb_group *group = &key->groups[i];
+
+            write_u8(w, group->explicit_type);
+            write_u32(w, group->type - keymap->types);
+            for (unsigned j = 0; j < XkbKeyGroupWidth(key, i); j++) {
+                const struct xkb_level *level = &group->levels[j];
+
+                write_action(w, &level->action);
+                write_u32(w, level->num_syms);
+                if (level->num_syms == 1)
+                    write_u32(w, level->u.sym);
+                else
+                    for (unsigned k = 0; k < level->num_syms; k++)
+                        write_u32(w, level->u.syms[k]);
+            }
+        }
+    }
+
+    write_string(w, keymap->keycodes_section_name);
+    write_string(w, keymap->types_section_name);
+    write_string(w, keymap->compat_section_name);
+    write_string(w, keymap->symbols_section_name);
+}
+
+/* Compiling in parallel gives the same keymap. */
+static uint32_t
+entry_flags(enum xkb_keymap_compile_flags flags)
+{
+    return flags & ~XKB_KEYMAP_COMPILE_PARALLEL;
+}
+
+static void
+write_entry_key(struct writer *w, struct xkb_context *ctx,
+                const struct xkb_rule_names *rmlvo,
+                enum xkb_keymap_format format,
+                enum xkb_keymap_compile_flags flags)
+{
+    write_data(w, CACHE_MAGIC, sizeof(CACHE_MAGIC) - 1);
+    write_u32(w, CACHE_VERSION);
+    write_u32(w, format);
+    write_u32(w, entry_flags(flags));
+
+    write_string(w, rmlvo->rules);
+    write_string(w, rmlvo->model);
+    write_string(w, rmlvo->layout);
+    write_string(w, rmlvo->variant);
+    write_string(w, rmlvo->options);
+
+    write_u32(w, xkb_context_num_include_paths(ctx));
+    for (unsigned i = 0; i < xkb_context_num_include_paths(ctx); i++)
+        write_string(w, xkb_context_include_path_get(ctx, i));
+}
+
+static bool
+write_file(int fd, const char *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t ret = write(fd, data, size);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += ret;
+        size -= ret;
+    }
+
+    return true;
+}
+
+void
+keymap_cache_store(struct xkb_keymap *keymap,
+                   const struct xkb_rule_names *rmlvo,
+                   struct cache_deps *deps)
+{
+    struct xkb_context *ctx = keymap->ctx;
+    struct writer w = { darray_new() };
+    struct file_stamp *stamp;
+    char *path, *tmp_path;
+    int fd, err;
+
+    if (deps->failed)
+        return;
+
+    write_entry_key(&w, ctx, rmlvo, keymap->format, keymap->flags);
+
+    write_u32(&w, darray_size(deps->stamps));
+    darray_foreach(stamp, deps->stamps) {
+        write_string(&w, stamp->path);
+        write_i64(&w, stamp->size);
+        write_i64(&w, stamp->mtime_sec);
+        write_i64(&w, stamp->mtime_nsec);
+    }
+
+    write_keymap(&w, keymap);
+    write_i64(&w, keymap_cache_checksum(w.buf.item, darray_size(w.buf)));
+
+    path = cache_entry_path(ctx, rmlvo);
+    if (!path || asprintf(&tmp_path, "%s.XXXXXX", path) < 0)
+        goto err_path;
+
+    /* Write to a temporary file first, so readers never see a partial entry. */
+    fd = mkstemp(tmp_path);
+    if (fd < 0) {
+        err = errno;
+        goto err_tmp_path;
+    }
+
+    if (!write_file(fd, w.buf.item, darray_size(w.buf))) {
+        err = errno;
+        close(fd);
+        unlink(tmp_path);
+        goto err_tmp_path;
+    }
+
+    if (close(fd) != 0 || rename(tmp_path, path) != 0) {
+        err = errno;
+        unlink(tmp_path);
+        goto err_tmp_path;
+    }
+
+    log_dbg(ctx, "Stored compiled keymap in cache entry %s\n", path);
+    free(tmp_path);
+    free(path);
+    darray_free(w.buf);
+    return;
+
+err_tmp_path:
+    log_warn(ctx, "Couldn't write keymap cache entry %s: %s\n",
+             path, strerror(err));
+    free(tmp_path);
+err_path:
+    free(path);
+    darray_free(w.buf);
+}
+
+/***====================================================================***/
+
+struct reader {
+    struct xkb_context *ctx;
+    const char *s;
+    size_t len;
+    size_t pos;
+    bool error;
+};
+
+static bool
+read_data(struct reader *r, void *data, size_t size)
+{
+    if (r->error || r->len - r->pos < size) {
+        r->error = true;
+        memset(data, 0, size);
+        return false;
+    }
+
+    memcpy(data, r->s + r->pos, size);
+    r->pos += size;
+    return true;
+}
+
+static uint8_t
+read_u8(struct reader *r)
+{
+    uint8_t v;
+    read_data(r, &v, sizeof(v));
+    return v;
+}
+
+static uint32_t
+read_u32(struct reader *r)
+{
+    uint32_t v;
+    read_data(r, &v, sizeof(v));
+    return v;
+}
+
+static int64_t
+read_i64(struct reader *r)
+{
+    int64_t v;
+    read_data(r, &v, sizeof(v));
+    return v;
+}
+
+/*
+ * Returns a pointer into the entry, which is not NUL-terminated, or NULL
+ * for a NULL string.
+ */
+static const char *
+read_string(struct reader *r, uint32_t *len_out)
+{
+    const char *s;
+    uint32_t len;
+
+    *len_out = 0;
+
+    len = read_u32(r);
+    if (r->error || len == UINT32_MAX)
+        return NULL;
+
+    if (r->len - r->pos < len) {
+        r->error = true;
+        return NULL;
+    }
+
+    s = r->s + r->pos;
+    r->pos += len;
+    *len_out = len;
+    return s;
+}
+
+static bool
+read_string_equals(struct reader *r, const char *expected)
+{
+    uint32_t len;
+    const char *s = read_string(r, &len);
+
+    if (r->error)
+        return false;
+    if (!s || !expected)
+        return !s && !expected;
+
+    return len == strlen(expected) && memcmp(s, expected, len) == 0;
+}
+
+static char *
+read_strdup(struct reader *r)
+{
+    uint32_t len;
+    const char *s = read_string(r, &len);
+
+    if (!s)
+        return NULL;
+
+    return strndup(s, len);
+}
+
+static xkb_atom_t
+read_atom(struct reader *r)
+{
+    uint32_t len;
+    const char *s = read_string(r, &len);
+
+    if (!s)
+        return XKB_ATOM_NONE;
+
+    return xkb_atom_intern(r->ctx, s, len);
+}
+
+/*
+ * Read the number of items which follow, each of which takes at least
+ * @item_size bytes.  This keeps a corrupt entry from making us allocate
+ * huge arrays.
+ */
+static uint32_t
+read_count(struct reader *r, size_t item_size)
+{
+    uint32_t count = read_u32(r);
+
+    if (r->error || (uint64_t) count * item_size > r->len - r->pos) {
+        r->error = true;
+        return 0;
+    }
+
+    return count;
+}
+
+/* Modifier masks may only name the modifiers which were read. */
+static xkb_mod_mask_t
+read_mod_mask(struct reader *r, const struct xkb_keymap *keymap)
+{
+    xkb_mod_mask_t mask = read_u32(r);
+
+    if (keymap->mods.num_mods < XKB_MAX_MODS &&
+        (mask >> keymap->mods.num_mods) != 0)
+        r->error = true;
+
+    return mask;
+}
+
+static void
+read_mods(struct reader *r, const struct xkb_keymap *keymap,
+          struct xkb_mods *mods)
+{
+    mods->mods = read_mod_mask(r, keymap);
+    mods->mask = read_mod_mask(r, keymap);
+}
+
+static void
+read_action(struct reader *r, const struct xkb_keymap *keymap,
+            union xkb_action *action)
+{
+    uint32_t type;
+
+    memset(action, 0, sizeof(*action));
+    type = read_u32(r);
+    /* Private actions keep their type number, which fits in a byte. */
+    if (type > UINT8_MAX) {
+        r->error = true;
+        return;
+    }
+    action->type = type;
+
+    switch (action->type) {
+    case ACTION_TYPE_MOD_SET:
+    case ACTION_TYPE_MOD_LATCH:
+    case ACTION_TYPE_MOD_LOCK:
+        action->mods.flags = read_u32(r);
+        read_mods(r, keymap, &action->mods.mods);
+        break;
+
+    case ACTION_TYPE_GROUP_SET:
+    case ACTION_TYPE_GROUP_LATCH:
+    case ACTION_TYPE_GROUP_LOCK:
+        action->group.flags = read_u32(r);
+        action->group.group = (int32_t) read_u32(r);
+        break;
+
+    case ACTION_TYPE_PTR_MOVE:
+        action->ptr.flags = read_u32(r);
+        action->ptr.x = (int16_t) read_u32(r);
+        action->ptr.y = (int16_t) read_u32(r);
+        break;
+
+    case ACTION_TYPE_PTR_BUTTON:
+    case ACTION_TYPE_PTR_LOCK:
+        action->btn.flags = read_u32(r);
+        action->btn.count = read_u8(r);
+        action->btn.button = read_u8(r);
+        break;
+
+    case ACTION_TYPE_PTR_DEFAULT:
+        action->dflt.flags = read_u32(r);
+        action->dflt.value = (int8_t) read_u8(r);
+        break;
+
+    case ACTION_TYPE_SWITCH_VT:
+        action->screen.flags = read_u32(r);
+        action->screen.screen = (int8_t) read_u8(r);
+        break;
+
+    case ACTION_TYPE_CTRL_SET:
+    case ACTION_TYPE_CTRL_LOCK:
+        action->ctrls.flags = read_u32(r);
+        action->ctrls.ctrls = read_u32(r);
+        break;
+
+    case ACTION_TYPE_NONE:
+    case ACTION_TYPE_TERMINATE:
+        break;
+
+    default:
+        read_data(r, action->priv.data, sizeof(action->priv.data));
+        break;
+    }
+}
+
+static bool
+read_keymap(struct reader *r, struct xkb_keymap *keymap)
+{
+    struct xkb_mod *mod;
+    struct xkb_led *led;
+    struct xkb_key *key;
+    xkb_keycode_t min_key_code, max_key_code;
+    unsigned int count;
+
+    keymap->enabled_ctrls = read_u32(r);
+
+    count = read_count(r, 12);
+    if (count > XKB_MAX_MODS)
+        return false;
+    keymap->mods.num_mods = count;
+    xkb_mods_foreach(mod, &keymap->mods) {
+        mod->name = read_atom(r);
+        mod->type = read_u32(r);
+        mod->mapping = read_mod_mask(r, keymap);
+        if (mod->type != MOD_REAL && mod->type != MOD_VIRT)
+            return false;
+    }
+
+    count = read_count(r, 21);
+    if (r->error || count == 0)
+        return false;
+    keymap->types = calloc(count, sizeof(*keymap->types));
+    if (!keymap->types)
+        return false;
+    keymap->num_types = count;
+    for (unsigned i = 0; i < keymap->num_types; i++) {
+        struct xkb_key_type *type = &keymap->types[i];
+
+        type->name = read_atom(r);
+        read_mods(r, keymap, &type->mods);
+        count = read_u32(r);
+        if (r->error || count == 0)
+            return false;
+        if (read_u8(r)) {
+            /* Each name takes at least its length. */
+            if ((uint64_t) count * 4 > r->len - r->pos)
+                return false;
+            type->level_names = calloc(count, sizeof(*type->level_names));
+            if (!type->level_names)
+                return false;
+            for (unsigned j = 0; j < count; j++)
+                type->level_names[j] = read_atom(r);
+        }
+        type->num_levels = count;
+
+        count = read_count(r, 20);
+        if (r->error)
+            return false;
+        if (count > 0) {
+            type->entries = calloc(count, sizeof(*type->entries));
+            if (!type->entries)
+                return false;
+            type->num_entries = count;
+        }
+        for (unsigned j = 0; j < type->num_entries; j++) {
+            type->entries[j].level = read_u32(r);
+            read_mods(r, keymap, &type->entries[j].mods);
+            read_mods(r, keymap, &type->entries[j].preserve);
+            if (type->entries[j].level >= type->num_levels)
+                return false;
+        }
+    }
+
+    count = read_count(r, 8);
+    if (r->error)
+        return false;
+    if (count > 0) {
+        keymap->key_aliases = calloc(count, sizeof(*keymap->key_aliases));
+        if (!keymap->key_aliases)
+            return false;
+        keymap->num_key_aliases = count;
+    }
+    for (unsigned i = 0; i < keymap->num_key_aliases; i++) {
+        keymap->key_aliases[i].real = read_atom(r);
+        keymap->key_aliases[i].alias = read_atom(r);
+    }
+
+    count = read_count(r, 22);
+    if (r->error)
+        return false;
+    if (count > 0) {
+        keymap->sym_interprets = calloc(count,
+                                        sizeof(*keymap->sym_interprets));
+        if (!keymap->sym_interprets)
+            return false;
+        keymap->num_sym_interprets = count;
+    }
+    for (unsigned i = 0; i < keymap->num_sym_interprets; i++) {
+        struct xkb_sym_interpret *si = &keymap->sym_interprets[i];
+
+        si->sym = read_u32(r);
+        si->match = read_u32(r);
+        si->mods = read_mod_mask(r, keymap);
+        si->virtual_mod = read_u32(r);
+        read_action(r, keymap, &si->action);
+        si->level_one_only = read_u8(r);
+        si->repeat = read_u8(r);
+        if (si->virtual_mod != XKB_MOD_INVALID &&
+            si->virtual_mod >= keymap->mods.num_mods)
+            return false;
+    }
+
+    keymap->num_groups = read_u32(r);
+    if (keymap->num_groups > XKB_MAX_GROUPS)
+        return false;
+    count = read_count(r, 4);
+    if (r->error || count > XKB_MAX_GROUPS)
+        return false;
+    if (count > 0) {
+        keymap->group_names = calloc(count, sizeof(*keymap->group_names));
+        if (!keymap->group_names)
+            return false;
+        keymap->num_group_names = count;
+    }
+    for (unsigned i = 0; i < keymap->num_group_names; i++)
+        keymap->group_names[i] = read_atom(r);
+
+    count = read_count(r, 28);
+    if (count > XKB_MAX_LEDS)
+        return false;
+    keymap->num_leds = count;
+    xkb_leds_foreach(led, keymap) {
+        led->name = read_atom(r);
+        led->which_groups = read_u32(r);
+        led->groups = read_u32(r);
+        led->which_mods = read_u32(r);
+        read_mods(r, keymap, &led->mods);
+        led->ctrls = read_u32(r);
+    }
+    XkbUpdateValidLeds(keymap);
+
+    min_key_code = read_u32(r);
+    max_key_code = read_u32(r);
+    if (r->error || min_key_code > max_key_code ||
+        max_key_code > XKB_KEYCODE_MAX ||
+        ((uint64_t) max_key_code - min_key_code + 1) * 29 > r->len - r->pos)
+        return false;
+    keymap->keys = calloc((size_t) max_key_code + 1, sizeof(*keymap->keys));
+    if (!keymap->keys)
+        return false;
+    keymap->min_key_code = min_key_code;
+    keymap->max_key_code = max_key_code;
+    xkb_keys_foreach(key, keymap) {
+        key->keycode = key - keymap->keys;
+        key->name = read_atom(r);
+        key->explicit = read_u32(r);
+        key->modmap = read_mod_mask(r, keymap);
+        key->vmodmap = read_mod_mask(r, keymap);
+        key->repeats = read_u8(r);
+        key->out_of_range_group_action = read_u32(r);
+        key->out_of_range_group_number = read_u32(r);
+        if (key->out_of_range_group_action > RANGE_REDIRECT)
+            return false;
+
+        count = read_count(r, 5);
+        if (r->error || count > keymap->num_groups)
+            return false;
+        if (count == 0)
+            continue;
+        key->groups = calloc(count, sizeof(*key->groups));
+        if (!key->groups)
+            return false;
+        key->num_groups = count;
+
+        for (unsigned i = 0; i < key->num_groups; i++) {
+            struct xkb_group *group = &key->groups[i];
+            xkb_level_index_t num_levels;
+            unsigned int type_idx;
+
+            group->explicit_type = read_u8(r);
+            type_idx = read_u32(r);
+            if (r->error || type_idx >= keymap->num_types)
+                return false;
+            group->type = &keymap->types[type_idx];
+
+            /* Each level takes at least its action and count. */
+            num_levels = group->type->num_levels;
+            if ((uint64_t) num_levels * 8 > r->len - r->pos)
+                return false;
+            group->levels = calloc(num_levels, sizeof(*group->levels));
+            if (!group->levels)
+                return false;
+
+            for (unsigned j = 0; j < num_levels; j++) {
+                struct xkb_level *level = &group->levels[j];
+
+                read_action(r, keymap, &level->action);
+                count = read_count(r, 4);
+                if (r->error)
+                    return false;
+                if (count == 1) {
+                    level->u.sym = read_u32(r);
+                }
+                else if (count > 1) {
+                    level->u.syms = calloc(count, sizeof(*level->u.syms));
+                    if (!level->u.syms)
+                        return false;
+                    for (unsigned k = 0; k < count; k++)
+                        level->u.syms[k] = read_u32(r);
+                }
+                level->num_syms = count;
+            }
+        }
+    }
+
+    keymap->keycodes_section_name = read_strdup(r);
+    keymap->types_section_name = read_strdup(r);
+    keymap->compat_section_name = read_strdup(r);
+    keymap->symbols_section_name = read_strdup(r);
+
+    return !r->error && r->pos == r->len;
+}
+
+/*
+ * Check that the entry was written for this RMLVO, include path etc.,
+ * and that none of the files it was compiled from have changed.
+ */
+static bool
+read_entry_key(struct reader *r, const struct xkb_rule_names *rmlvo,
+               enum xkb_keymap_format format,
+               enum xkb_keymap_compile_flags flags)
+{
+    struct xkb_context *ctx = r->ctx;
+    char magic[sizeof(CACHE_MAGIC) - 1];
+    unsigned int count;
+
+    if (!read_data(r, magic, sizeof(magic)) ||
+        memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 ||
+        read_u32(r) != CACHE_VERSION ||
+        read_u32(r) != (uint32_t) format ||
+        read_u32(r) != entry_flags(flags))
+        return false;
+
+    if (!read_string_equals(r, rmlvo->rules) ||
+        !read_string_equals(r, rmlvo->model) ||
+        !read_string_equals(r, rmlvo->layout) ||
+        !read_string_equals(r, rmlvo->variant) ||
+        !read_string_equals(r, rmlvo->options))
+        return false;
+
+    if (read_u32(r) != xkb_context_num_include_paths(ctx))
+        return false;
+    for (unsigned i = 0; i < xkb_context_num_include_paths(ctx); i++)
+        if (!read_string_equals(r, xkb_context_include_path_get(ctx, i)))
+            return false;
+
+    count = read_count(r, 28);
+    for (unsigned i = 0; i < count; i++) {
+        struct file_stamp stamp, current;
+        struct stat stat_buf;
+        bool same;
+
+        stamp.path = read_strdup(r);
+        stamp.size = read_i64(r);
+        stamp.mtime_sec = read_i64(r);
+        stamp.mtime_nsec = read_i64(r);
+        if (!stamp.path)
+            return false;
+
+        file_stamp_set(&current,
+                       stat(stamp.path, &stat_buf) == 0 ? &stat_buf : NULL);
+        same = (stamp.size == current.size &&
+                stamp.mtime_sec == current.mtime_sec &&
+                stamp.mtime_nsec == current.mtime_nsec);
+        if (!same)
+            log_dbg(ctx, "Keymap cache entry is stale: %s changed\n",
+                    stamp.path);
+        free(stamp.path);
+        if (!same) {
+            /* Files may have been added which the index doesn't know. */
+            xkb_context_include_index_invalidate(ctx);
+            return false;
+        }
+    }
+
+    return !r->error;
+}
+
+struct xkb_keymap *
+keymap_cache_load(struct xkb_context *ctx,
+                  const struct xkb_rule_names *rmlvo,
+                  enum xkb_keymap_format format,
+                  enum xkb_keymap_compile_flags flags)
+{
+    struct xkb_keymap *keymap = NULL;
+    struct reader r = { .ctx = ctx };
+    size_t map_len;
+    uint64_t checksum;
+    FILE *file;
+    char *path;
+
+    path = cache_entry_path(ctx, rmlvo);
+    if (!path)
+        return NULL;
+
+    file = fopen(path, "rb");
+    if (!file)
+        goto err_path;
+
+    if (!map_file(file, &r.s, &r.len)) {
+        log_warn(ctx, "Couldn't read keymap cache entry %s: %s\n",
+                 path, strerror(errno));
+        goto err_file;
+    }
+    map_len = r.len;
+
+    if (r.len < sizeof(checksum))
+        goto err_corrupt;
+    r.len -= sizeof(checksum);
+    memcpy(&checksum, r.s + r.len, sizeof(checksum));
+    if (checksum != keymap_cache_checksum(r.s, r.len))
+        goto err_corrupt;
+
+    if (!read_entry_key(&r, rmlvo, format, flags))
+        goto err_map;
+
+    keymap = xkb_keymap_new(ctx, format, flags);
+    if (!keymap)
+        goto err_map;
+
+    if (!read_keymap(&r, keymap)) {
+        xkb_keymap_unref(keymap);
+        keymap = NULL;
+        goto err_corrupt;
+    }
+
+    log_dbg(ctx, "Loaded keymap from cache entry %s\n", path);
+    goto err_map;
+
+err_corrupt:
+    log_warn(ctx, "Ignoring corrupt keymap cache entry %s\n", path);
+err_map:
+    unmap_file(r.s, map_len);
+err_file:
+    fclose(file);
+err_path:
+    free(path);
+    return keymap;
+}
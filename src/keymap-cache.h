@@ -0,0 +1,52 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef KEYMAP_CACHE_H
+#define KEYMAP_CACHE_H
+
+struct cache_deps;
+
+struct cache_deps *
+cache_deps_new(struct xkb_context *ctx);
+
+void
+cache_deps_free(struct cache_deps *deps);
+
+void
+cache_deps_add_file(struct cache_deps *deps, const char *path, FILE *file);
+
+struct xkb_keymap *
+keymap_cache_load(struct xkb_context *ctx,
+                  const struct xkb_rule_names *rmlvo,
+                  enum xkb_keymap_format format,
+                  enum xkb_keymap_compile_flags flags);
+
+uint64_t
+keymap_cache_checksum(const char *data, size_t len);
+
+void
+keymap_cache_store(struct xkb_keymap *keymap,
+                   const struct xkb_rule_names *rmlvo,
+                   struct cache_deps *deps);
+
+#endif
@@ -66,12 +66,175 @@ xkb_keymap_new(struct xkb_context *ctx,
 
     keymap->format = format;
     keymap->flags = flags;
+    keymap->text[0].fd = keymap->text[1].fd = -1;
 
     update_builtin_keymap_fields(keymap);
 
     return keymap;
 }
 
+static bool
+copy_key(struct xkb_key *copy, const struct xkb_key *key,
+         const struct xkb_keymap *keymap, struct xkb_keymap *keymap_copy)
+{
+    struct xkb_group *groups = NULL;
+
+    if (key->num_groups > 0) {
+        groups = memdup(key->groups, key->num_groups, sizeof(*groups));
+        if (!groups)
+            return false;
+    }
+
+    /* Don't let the copy free the levels of the original on failure. */
+    for (xkb_layout_index_t i = 0; i < key->num_groups; i++) {
+        groups[i].type = &keymap_copy->types[key->groups[i].type -
+                                             keymap->types];
+        groups[i].levels = NULL;
+    }
+
+    *copy = *key;
+    copy->groups = groups;
+
+    for (xkb_layout_index_t i = 0; i < key->num_groups; i++) {
+        const xkb_level_index_t width = XkbKeyGroupWidth(key, i);
+        struct xkb_level *levels;
+
+        if (!key->groups[i].levels || width == 0)
+            continue;
+
+        levels = memdup(key->groups[i].levels, width, sizeof(*levels));
+        if (!levels)
+            return false;
+        copy->groups[i].levels = levels;
+
+        for (xkb_level_index_t j = 0; j < width; j++) {
+            if (levels[j].num_syms <= 1)
+                continue;
+
+            levels[j].u.syms = memdup(levels[j].u.syms, levels[j].num_syms,
+                                      sizeof(*levels[j].u.syms));
+            if (!levels[j].u.syms) {
+                while (j < width)
+                    levels[j++].num_syms = 0;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Make a deep copy of a keymap, as the base of a new keymap which
+ * differs from it in a few places.  The text of the keymap is not
+ * copied, since it is unlikely to be the same.
+ */
+struct xkb_keymap *
+xkb_keymap_copy(const struct xkb_keymap *keymap)
+{
+    struct xkb_keymap *copy;
+
+    copy = xkb_keymap_new(keymap->ctx, keymap->format, keymap->flags);
+    if (!copy)
+        return NULL;
+
+    copy->enabled_ctrls = keymap->enabled_ctrls;
+    copy->mods = keymap->mods;
+    copy->num_groups = keymap->num_groups;
+    memcpy(copy->leds, keymap->leds, sizeof(keymap->leds));
+    copy->num_leds = keymap->num_leds;
+    copy->valid_leds = keymap->valid_leds;
+
+    if (keymap->num_types > 0) {
+        copy->types = calloc(keymap->num_types, sizeof(*copy->types));
+        if (!copy->types)
+            goto fail;
+        copy->num_types = keymap->num_types;
+    }
+
+    for (unsigned i = 0; i < keymap->num_types; i++) {
+        const struct xkb_key_type *type = &keymap->types[i];
+        struct xkb_key_type_entry *entries = NULL;
+        xkb_atom_t *level_names = NULL;
+
+        if (type->num_entries > 0) {
+            entries = memdup(type->entries, type->num_entries,
+                             sizeof(*entries));
+            if (!entries)
+                goto fail;
+        }
+
+        if (type->level_names && type->num_levels > 0) {
+            level_names = memdup(type->level_names, type->num_levels,
+                                 sizeof(*level_names));
+            if (!level_names) {
+                free(entries);
+                goto fail;
+            }
+        }
+
+        copy->types[i] = *type;
+        copy->types[i].entries = entries;
+        copy->types[i].level_names = level_names;
+    }
+
+    if (keymap->keys) {
+        copy->keys = calloc(keymap->max_key_code + 1, sizeof(*copy->keys));
+        if (!copy->keys)
+            goto fail;
+        copy->min_key_code = keymap->min_key_code;
+        copy->max_key_code = keymap->max_key_code;
+
+        for (xkb_keycode_t kc = keymap->min_key_code;
+             kc <= keymap->max_key_code; kc++)
+            if (!copy_key(&copy->keys[kc], &keymap->keys[kc], keymap, copy))
+                goto fail;
+    }
+
+    if (keymap->num_key_aliases > 0) {
+        copy->key_aliases = memdup(keymap->key_aliases,
+                                   keymap->num_key_aliases,
+                                   sizeof(*copy->key_aliases));
+        if (!copy->key_aliases)
+            goto fail;
+        copy->num_key_aliases = keymap->num_key_aliases;
+    }
+
+    if (keymap->num_sym_interprets > 0) {
+        copy->sym_interprets = memdup(keymap->sym_interprets,
+                                      keymap->num_sym_interprets,
+                                      sizeof(*copy->sym_interprets));
+        if (!copy->sym_interprets)
+            goto fail;
+        copy->num_sym_interprets = keymap->num_sym_interprets;
+    }
+
+    if (keymap->num_group_names > 0) {
+        copy->group_names = memdup(keymap->group_names,
+                                   keymap->num_group_names,
+                                   sizeof(*copy->group_names));
+        if (!copy->group_names)
+            goto fail;
+        copy->num_group_names = keymap->num_group_names;
+    }
+
+    copy->keycodes_section_name = strdup_safe(keymap->keycodes_section_name);
+    copy->symbols_section_name = strdup_safe(keymap->symbols_section_name);
+    copy->types_section_name = strdup_safe(keymap->types_section_name);
+    copy->compat_section_name = strdup_safe(keymap->compat_section_name);
+    if ((keymap->keycodes_section_name && !copy->keycodes_section_name) ||
+        (keymap->symbols_section_name && !copy->symbols_section_name) ||
+        (keymap->types_section_name && !copy->types_section_name) ||
+        (keymap->compat_section_name && !copy->compat_section_name))
+        goto fail;
+
+    return copy;
+
+fail:
+    xkb_keymap_unref(copy);
+    return NULL;
+}
+
 struct xkb_key *
 XkbKeyByName(struct xkb_keymap *keymap, xkb_atom_t name, bool use_aliases)
 {
@@ -124,6 +287,23 @@ XkbEscapeMapName(char *name)
     }
 }
 
+/*
+ * Only the LEDs with a name can be queried.  Their mask is computed once,
+ * when the keymap is made, so that xkb_state_led_mask_is_active() can
+ * check its argument cheaply.
+ */
+void
+XkbUpdateValidLeds(struct xkb_keymap *keymap)
+{
+    xkb_led_index_t i;
+    const struct xkb_led *led;
+
+    keymap->valid_leds = 0;
+    xkb_leds_enumerate(i, led, keymap)
+        if (led->name != XKB_ATOM_NONE)
+            keymap->valid_leds |= (1u << i);
+}
+
 xkb_mod_index_t
 XkbModNameToIndex(const struct xkb_mod_set *mods, xkb_atom_t name,
                   enum mod_type type)
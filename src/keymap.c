@@ -50,20 +50,51 @@
  *
  * ********************************************************/
 
+#include <errno.h>
+#include <unistd.h>
+#ifdef HAVE_MEMFD_CREATE
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
 #include "keymap.h"
+#include "stats.h"
+#include "keymap-cache.h"
 #include "text.h"
 
+/*
+ * A keymap may be used from several threads at once; the text made
+ * lazily by xkb_keymap_get_text() is published with a compare-and-swap,
+ * and a thread which loses the race frees its own copy.
+ */
+#ifdef HAVE_PTHREAD
+#define fetch_add(ptr, val) __atomic_fetch_add((ptr), (val), __ATOMIC_ACQ_REL)
+#define load_acquire(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define load_relaxed(ptr) __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define store_relaxed(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELAXED)
+#define compare_exchange(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), false, \
+                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define fetch_add(ptr, val) ((*(ptr) += (val)) - (val))
+#define load_acquire(ptr) (*(ptr))
+#define load_relaxed(ptr) (*(ptr))
+#define store_relaxed(ptr, val) (*(ptr) = (val))
+#define compare_exchange(ptr, expected, desired) \
+    (*(ptr) == *(expected) ? (*(ptr) = (desired), true) : false)
+#endif
+
 XKB_EXPORT struct xkb_keymap *
 xkb_keymap_ref(struct xkb_keymap *keymap)
 {
-    keymap->refcnt++;
+    fetch_add(&keymap->refcnt, 1);
     return keymap;
 }
 
 XKB_EXPORT void
 xkb_keymap_unref(struct xkb_keymap *keymap)
 {
-    if (!keymap || --keymap->refcnt > 0)
+    if (!keymap || fetch_add(&keymap->refcnt, -1) > 1)
         return;
 
     if (keymap->keys) {
@@ -97,6 +128,11 @@ xkb_keymap_unref(struct xkb_keymap *keymap)
     free(keymap->symbols_section_name);
     free(keymap->types_section_name);
     free(keymap->compat_section_name);
+    for (unsigned i = 0; i < ARRAY_SIZE(keymap->text); i++) {
+        free(keymap->text[i].str);
+        if (keymap->text[i].fd >= 0)
+            close(keymap->text[i].fd);
+    }
     xkb_context_unref(keymap->ctx);
     free(keymap);
 }
@@ -123,6 +159,9 @@ xkb_keymap_new_from_names(struct xkb_context *ctx,
     struct xkb_rule_names rmlvo;
     const enum xkb_keymap_format format = XKB_KEYMAP_FORMAT_TEXT_V1;
     const struct xkb_keymap_format_ops *ops;
+    struct cache_deps *deps = NULL;
+    struct stats_compile stats;
+    bool ok;
 
     ops = get_keymap_format_ops(format);
     if (!ops || !ops->keymap_new_from_names) {
@@ -130,22 +169,42 @@ xkb_keymap_new_from_names(struct xkb_context *ctx,
         return NULL;
     }
 
-    if (flags & ~(XKB_KEYMAP_COMPILE_NO_FLAGS)) {
+    if (flags & ~(XKB_KEYMAP_COMPILE_PARALLEL)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
         return NULL;
     }
 
-    keymap = xkb_keymap_new(ctx, format, flags);
-    if (!keymap)
-        return NULL;
-
     if (rmlvo_in)
         rmlvo = *rmlvo_in;
     else
         memset(&rmlvo, 0, sizeof(rmlvo));
     xkb_context_sanitize_rule_names(ctx, &rmlvo);
 
-    if (!ops->keymap_new_from_names(keymap, &rmlvo)) {
+    if (ctx->cache_path) {
+        keymap = keymap_cache_load(ctx, &rmlvo, format, flags);
+        if (keymap)
+            return keymap;
+    }
+
+    keymap = xkb_keymap_new(ctx, format, flags);
+    if (!keymap)
+        return NULL;
+
+    stats_compile_begin(ctx, &stats);
+
+    /* Record the files which are read, to validate the cache entry. */
+    if (ctx->cache_path)
+        deps = cache_deps_new(ctx);
+
+    ok = ops->keymap_new_from_names(keymap, &rmlvo, deps);
+
+    if (ok && deps)
+        keymap_cache_store(keymap, &rmlvo, deps);
+    cache_deps_free(deps);
+
+    stats_compile_end(ctx, &stats, ok);
+
+    if (!ok) {
         xkb_keymap_unref(keymap);
         return NULL;
     }
@@ -171,6 +230,8 @@ xkb_keymap_new_from_buffer(struct xkb_context *ctx,
 {
     struct xkb_keymap *keymap;
     const struct xkb_keymap_format_ops *ops;
+    struct stats_compile stats;
+    bool ok;
 
     ops = get_keymap_format_ops(format);
     if (!ops || !ops->keymap_new_from_string) {
@@ -178,7 +239,7 @@ xkb_keymap_new_from_buffer(struct xkb_context *ctx,
         return NULL;
     }
 
-    if (flags & ~(XKB_KEYMAP_COMPILE_NO_FLAGS)) {
+    if (flags & ~(XKB_KEYMAP_COMPILE_PARALLEL)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
         return NULL;
     }
@@ -192,7 +253,11 @@ xkb_keymap_new_from_buffer(struct xkb_context *ctx,
     if (!keymap)
         return NULL;
 
-    if (!ops->keymap_new_from_string(keymap, buffer, length)) {
+    stats_compile_begin(ctx, &stats);
+    ok = ops->keymap_new_from_string(keymap, buffer, length);
+    stats_compile_end(ctx, &stats, ok);
+
+    if (!ok) {
         xkb_keymap_unref(keymap);
         return NULL;
     }
@@ -208,6 +273,8 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
 {
     struct xkb_keymap *keymap;
     const struct xkb_keymap_format_ops *ops;
+    struct stats_compile stats;
+    bool ok;
 
     ops = get_keymap_format_ops(format);
     if (!ops || !ops->keymap_new_from_file) {
@@ -215,7 +282,7 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
         return NULL;
     }
 
-    if (flags & ~(XKB_KEYMAP_COMPILE_NO_FLAGS)) {
+    if (flags & ~(XKB_KEYMAP_COMPILE_PARALLEL)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
         return NULL;
     }
@@ -229,7 +296,11 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
     if (!keymap)
         return NULL;
 
-    if (!ops->keymap_new_from_file(keymap, file)) {
+    stats_compile_begin(ctx, &stats);
+    ok = ops->keymap_new_from_file(keymap, file);
+    stats_compile_end(ctx, &stats, ok);
+
+    if (!ok) {
         xkb_keymap_unref(keymap);
         return NULL;
     }
@@ -237,22 +308,280 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
     return keymap;
 }
 
+/**
+ * Write the keymap in pieces to a callback.
+ */
+XKB_EXPORT int
+xkb_keymap_write(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                 enum xkb_keymap_serialize_flags flags,
+                 xkb_keymap_write_fn write_fn, void *data)
+{
+    const struct xkb_keymap_format_ops *ops;
+
+    if (format == XKB_KEYMAP_USE_ORIGINAL_FORMAT)
+        format = keymap->format;
+
+    ops = get_keymap_format_ops(format);
+    if (!ops || !ops->keymap_write) {
+        log_err_func(keymap->ctx, "unsupported keymap format: %d\n", format);
+        return 0;
+    }
+
+    if (flags & ~(XKB_KEYMAP_SERIALIZE_COMPACT)) {
+        log_err_func(keymap->ctx, "unrecognized flags: %#x\n", flags);
+        return 0;
+    }
+
+    return ops->keymap_write(keymap, flags, write_fn, data);
+}
+
+struct buffer_sink {
+    char *buffer;
+    size_t size;
+    size_t len;
+};
+
+static int
+write_to_buffer(void *data, const char *text, size_t len)
+{
+    struct buffer_sink *sink = data;
+
+    if (sink->len < sink->size) {
+        size_t n = MIN(len, sink->size - sink->len);
+        memcpy(sink->buffer + sink->len, text, n);
+    }
+
+    sink->len += len;
+    return 1;
+}
+
+struct text_piece {
+    char *text;
+    size_t len;
+};
+
+/* The pieces of the text, kept until its whole length is known. */
+struct pieces_sink {
+    darray(struct text_piece) pieces;
+    size_t len;
+};
+
+static int
+write_to_pieces(void *data, const char *text, size_t len)
+{
+    struct pieces_sink *sink = data;
+    struct text_piece piece;
+
+    piece.text = malloc(len);
+    if (!piece.text)
+        return 0;
+
+    memcpy(piece.text, text, len);
+    piece.len = len;
+    darray_append(sink->pieces, piece);
+    sink->len += len;
+    return 1;
+}
+
+/*
+ * Write the keymap to a new string, which is allocated once at its exact
+ * size.  The text is only formatted once; the pieces are kept until the
+ * length is known, and then copied into the string.
+ */
+static char *
+write_to_new_string(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                    enum xkb_keymap_serialize_flags flags, size_t *len_out)
+{
+    struct pieces_sink sink;
+    struct text_piece *piece;
+    char *str = NULL;
+    size_t len = 0;
+
+    darray_init(sink.pieces);
+    sink.len = 0;
+
+    if (xkb_keymap_write(keymap, format, flags, write_to_pieces, &sink))
+        str = malloc(sink.len + 1);
+
+    darray_foreach(piece, sink.pieces) {
+        if (str) {
+            memcpy(str + len, piece->text, piece->len);
+            len += piece->len;
+        }
+        free(piece->text);
+    }
+    darray_free(sink.pieces);
+
+    if (!str)
+        return NULL;
+
+    str[len] = '\0';
+    *len_out = len;
+    return str;
+}
+
 XKB_EXPORT char *
 xkb_keymap_get_as_string(struct xkb_keymap *keymap,
                          enum xkb_keymap_format format)
 {
-    const struct xkb_keymap_format_ops *ops;
+    const char *text = load_acquire(&keymap->text[0].str);
+    size_t len;
+
+    if (text && (format == XKB_KEYMAP_USE_ORIGINAL_FORMAT ||
+                 format == keymap->format))
+        return strdup(text);
+
+    return write_to_new_string(keymap, format, XKB_KEYMAP_SERIALIZE_NO_FLAGS,
+                               &len);
+}
+
+/**
+ * Write the keymap to a buffer, snprintf()-style.
+ */
+XKB_EXPORT size_t
+xkb_keymap_write_to_buffer(struct xkb_keymap *keymap,
+                           enum xkb_keymap_format format,
+                           enum xkb_keymap_serialize_flags flags,
+                           char *buffer, size_t size)
+{
+    struct buffer_sink sink = { buffer, size, 0 };
+
+    if (!xkb_keymap_write(keymap, format, flags, write_to_buffer, &sink))
+        return 0;
+
+    if (size > 0)
+        buffer[MIN(sink.len, size - 1)] = '\0';
+
+    return sink.len;
+}
+
+static int
+write_to_fd(void *data, const char *text, size_t len)
+{
+    int fd = *(int *) data;
+
+    while (len > 0) {
+        ssize_t ret = write(fd, text, len);
+
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            return 0;
+        }
+
+        text += ret;
+        len -= ret;
+    }
+
+    return 1;
+}
+
+/**
+ * Write the keymap to a file descriptor.
+ */
+XKB_EXPORT int
+xkb_keymap_write_to_fd(struct xkb_keymap *keymap,
+                       enum xkb_keymap_format format,
+                       enum xkb_keymap_serialize_flags flags, int fd)
+{
+    return xkb_keymap_write(keymap, format, flags, write_to_fd, &fd);
+}
+
+/**
+ * Returns the keymap text, which is kept on the keymap once made.
+ */
+XKB_EXPORT const char *
+xkb_keymap_get_text(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                    enum xkb_keymap_serialize_flags flags, size_t *length_out)
+{
+    bool compact = (flags & XKB_KEYMAP_SERIALIZE_COMPACT);
+    char *text;
 
     if (format == XKB_KEYMAP_USE_ORIGINAL_FORMAT)
         format = keymap->format;
 
-    ops = get_keymap_format_ops(format);
-    if (!ops || !ops->keymap_get_as_string) {
+    if (format != keymap->format) {
         log_err_func(keymap->ctx, "unsupported keymap format: %d\n", format);
         return NULL;
     }
 
-    return ops->keymap_get_as_string(keymap);
+    if (flags & ~(XKB_KEYMAP_SERIALIZE_COMPACT)) {
+        log_err_func(keymap->ctx, "unrecognized flags: %#x\n", flags);
+        return NULL;
+    }
+
+    text = load_acquire(&keymap->text[compact].str);
+    if (!text) {
+        size_t len;
+        char *str = write_to_new_string(keymap, format, flags, &len);
+
+        if (!str)
+            return NULL;
+
+        /* Every thread gets the same length, so it can go first. */
+        store_relaxed(&keymap->text[compact].len, len);
+        if (compare_exchange(&keymap->text[compact].str, &text, str))
+            text = str;
+        else
+            free(str);
+    }
+
+    if (length_out)
+        *length_out = load_relaxed(&keymap->text[compact].len);
+    return text;
+}
+
+/**
+ * Returns a sealed memfd with the keymap text, which is kept on the keymap
+ * once made.
+ */
+XKB_EXPORT int
+xkb_keymap_get_text_fd(struct xkb_keymap *keymap,
+                       enum xkb_keymap_format format,
+                       enum xkb_keymap_serialize_flags flags, size_t *size_out)
+{
+#ifdef HAVE_MEMFD_CREATE
+    bool compact = (flags & XKB_KEYMAP_SERIALIZE_COMPACT);
+    const char *text;
+    size_t len;
+    int fd, expected = -1;
+
+    text = xkb_keymap_get_text(keymap, format, flags, &len);
+    if (!text)
+        return -1;
+
+    fd = load_acquire(&keymap->text[compact].fd);
+    if (fd < 0) {
+        fd = memfd_create("xkb-keymap", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd < 0) {
+            log_err_func(keymap->ctx, "couldn't create memfd: %s\n",
+                         strerror(errno));
+            return -1;
+        }
+
+        /* Include the NUL, so the mapped file is a string. */
+        if (!write_to_fd(&fd, text, len + 1) ||
+            fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW |
+                                   F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+            log_err_func(keymap->ctx, "couldn't write sealed memfd: %s\n",
+                         strerror(errno));
+            close(fd);
+            return -1;
+        }
+
+        if (!compare_exchange(&keymap->text[compact].fd, &expected, fd)) {
+            close(fd);
+            fd = expected;
+        }
+    }
+
+    if (size_out)
+        *size_out = len + 1;
+    return fd;
+#else
+    log_err_func1(keymap->ctx, "sealed files are not supported\n");
+    return -1;
+#endif
 }
 
 /**
@@ -291,6 +620,20 @@ xkb_keymap_mod_get_index(struct xkb_keymap *keymap, const char *name)
     return XkbModNameToIndex(&keymap->mods, atom, MOD_BOTH);
 }
 
+/**
+ * Return the mask for a named modifier, or 0 if it doesn't exist.
+ */
+XKB_EXPORT xkb_mod_mask_t
+xkb_keymap_mod_get_mask(struct xkb_keymap *keymap, const char *name)
+{
+    xkb_mod_index_t idx = xkb_keymap_mod_get_index(keymap, name);
+
+    if (idx == XKB_MOD_INVALID)
+        return 0;
+
+    return 1u << idx;
+}
+
 /**
  * Return the total number of active groups in the keymap.
  */
@@ -428,6 +771,20 @@ xkb_keymap_led_get_index(struct xkb_keymap *keymap, const char *name)
     return XKB_LED_INVALID;
 }
 
+/**
+ * Return the mask for a named LED, or 0 if it doesn't exist.
+ */
+XKB_EXPORT xkb_led_mask_t
+xkb_keymap_led_get_mask(struct xkb_keymap *keymap, const char *name)
+{
+    xkb_led_index_t idx = xkb_keymap_led_get_index(keymap, name);
+
+    if (idx == XKB_LED_INVALID)
+        return 0;
+
+    return 1u << idx;
+}
+
 /**
  * As below, but takes an explicit layout/level rather than state.
  */
@@ -391,11 +391,24 @@ struct xkb_keymap {
 
     struct xkb_led leds[XKB_MAX_LEDS];
     unsigned int num_leds;
+    /* The LEDs which have a name; see XkbUpdateValidLeds(). */
+    xkb_led_mask_t valid_leds;
 
     char *keycodes_section_name;
     char *symbols_section_name;
     char *types_section_name;
     char *compat_section_name;
+
+    /*
+     * The keymap as text, made on first use by xkb_keymap_get_text(),
+     * indexed by whether it is compact.
+     */
+    struct {
+        char *str;
+        size_t len;
+        /* A sealed memfd holding the text, or -1. */
+        int fd;
+    } text[2];
 };
 
 #define xkb_keys_foreach(iter, keymap) \
@@ -442,6 +455,9 @@ xkb_keymap_new(struct xkb_context *ctx,
                enum xkb_keymap_format format,
                enum xkb_keymap_compile_flags flags);
 
+struct xkb_keymap *
+xkb_keymap_copy(const struct xkb_keymap *keymap);
+
 struct xkb_key *
 XkbKeyByName(struct xkb_keymap *keymap, xkb_atom_t name, bool use_aliases);
 
@@ -451,6 +467,9 @@ XkbResolveKeyAlias(const struct xkb_keymap *keymap, xkb_atom_t name);
 void
 XkbEscapeMapName(char *name);
 
+void
+XkbUpdateValidLeds(struct xkb_keymap *keymap);
+
 xkb_mod_index_t
 XkbModNameToIndex(const struct xkb_mod_set *mods, xkb_atom_t name,
                   enum mod_type type);
@@ -464,13 +483,18 @@ XkbWrapGroupIntoRange(int32_t group,
 xkb_mod_mask_t
 mod_mask_get_effective(struct xkb_keymap *keymap, xkb_mod_mask_t mods);
 
+struct cache_deps;
+
 struct xkb_keymap_format_ops {
     bool (*keymap_new_from_names)(struct xkb_keymap *keymap,
-                                  const struct xkb_rule_names *names);
+                                  const struct xkb_rule_names *names,
+                                  struct cache_deps *deps);
     bool (*keymap_new_from_string)(struct xkb_keymap *keymap,
                                    const char *string, size_t length);
     bool (*keymap_new_from_file)(struct xkb_keymap *keymap, FILE *file);
-    char *(*keymap_get_as_string)(struct xkb_keymap *keymap);
+    bool (*keymap_write)(struct xkb_keymap *keymap,
+                         enum xkb_keymap_serialize_flags flags,
+                         xkb_keymap_write_fn write_fn, void *data);
 };
 
 extern const struct xkb_keymap_format_ops text_v1_keymap_format_ops;
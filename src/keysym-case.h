@@ -0,0 +1,888 @@
+
+/**
+ * This file comes from libxkbcommon and was generated by makecase.py
+ * from src/keysym-utf.c and Unicode 14.0.0; please do not edit it
+ * directly.
+ */
+
+/* Page of each high byte of a Latin-1 or legacy keysym. */
+static const uint8_t keysym_case_page_index[] = {
+      1,   2,   3,   4,   0,   0,   5,   6, /* 0x000000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x000800 */
+      0,   0,   0,   7, /* 0x001000 */
+};
+
+/* Page of each high byte of the code point of a Unicode keysym. */
+static const uint8_t ucs_case_page_index[] = {
+      8,   9,  10,  11,  12,  13,   0,   0, /* 0x000000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x000800 */
+     14,   0,   0,  15,   0,   0,   0,   0, /* 0x001000 */
+      0,   0,   0,   0,  16,  17,  18,  19, /* 0x001800 */
+      0,  20,   0,   0,  21,   0,   0,   0, /* 0x002000 */
+      0,   0,   0,   0,  22,  23,   0,   0, /* 0x002800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x003000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x003800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x004000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x004800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x005000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x005800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x006000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x006800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x007000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x007800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x008000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x008800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x009000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x009800 */
+      0,   0,   0,   0,   0,   0,  24,  25, /* 0x00a000 */
+      0,   0,   0,  26,   0,   0,   0,   0, /* 0x00a800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00b000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00b800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00c000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00c800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00d000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00d800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00e000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00e800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x00f000 */
+      0,   0,   0,   0,   0,   0,   0,  27, /* 0x00f800 */
+      0,   0,   0,   0,  28,  29,   0,   0, /* 0x010000 */
+      0,   0,   0,   0,  30,   0,   0,   0, /* 0x010800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x011000 */
+     31,   0,   0,   0,   0,   0,   0,   0, /* 0x011800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x012000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x012800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x013000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x013800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x014000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x014800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x015000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x015800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x016000 */
+      0,   0,   0,   0,   0,   0,  32,   0, /* 0x016800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x017000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x017800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x018000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x018800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x019000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x019800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01a000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01a800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01b000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01b800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01c000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01c800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01d000 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01d800 */
+      0,   0,   0,   0,   0,   0,   0,   0, /* 0x01e000 */
+      0,  33, /* 0x01e800 */
+};
+
+/* Index into case_deltas of each low byte. */
+static const uint8_t case_pages[][256] = {
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,   0,   0,   0,   0,   0,
+          0,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0, 126,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157,   0, 157, 157, 157, 157, 157, 157, 157,   0,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,   0,  97,  97,  97,  97,  97,  97,  97, 129,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 154,   0, 154,   0, 154, 154,   0,   0, 154, 154, 154, 154,   0, 154, 154,
+          0, 101,   0, 101,   0, 101, 101,   0,   0, 101, 101, 101, 101,   0, 101, 101,
+        157,   0,   0, 157,   0, 157, 157,   0, 157,   0, 157,   0, 157,   0,   0, 157,
+        157, 157, 157,   0,   0, 157,   0,   0, 157, 157,   0, 157,   0,   0, 157,   0,
+         97,   0,   0,  97,   0,  97,  97,   0,  97,   0,  97,   0,  97,   0,   0,  97,
+         97,  97,  97,   0,   0,  97,   0,   0,  97,  97,   0,  97,   0,   0,  97,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 154,   0,   0,   0,   0, 154,   0,   0,  26,   0, 154, 154,   0,   0,   0,
+          0, 101,   0,   0,   0,   0, 101,   0,   0,  60,   0, 101, 101,   0,   0,   0,
+          0,   0,   0,   0,   0, 157, 157,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0, 157,   0,   0, 157,   0,   0,   0,   0, 157, 157,   0,
+          0,   0,   0,   0,   0,  97,  97,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,  97,   0,   0,  97,   0,   0,   0,   0,  97,  97,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0, 154,   0, 154, 154,   0,   0,   0, 154, 154, 154,   0,   0,   0,
+          0,   0,   0, 101,   0, 101, 101,   0,   0,   0, 101, 101, 101, 151,   0, 104,
+        157,   0,   0,   0,   0,   0,   0, 157,   0,   0,   0,   0, 157,   0,   0, 157,
+          0, 157, 157, 157,   0,   0,   0,   0,   0, 157,   0,   0,   0, 157, 157,   0,
+         97,   0,   0,   0,   0,   0,   0,  97,   0,   0,   0,   0,  97,   0,   0,  97,
+          0,  97,  97,  97,   0,   0,   0,   0,   0,  97,   0,   0,   0,  97,  97,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+          0,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+        110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+        110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+         42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,
+         42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,  42,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 154, 154, 154, 154, 154,   0, 154, 154, 154,   0, 154,   0,   0,   0,   0,
+          0, 101, 101, 101, 101, 101,   0, 101, 101, 101,   0, 101,   0,   0,   0,   0,
+          0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157,   0, 157, 157, 157, 157, 157, 157,   0,   0,   0,   0,   0,   0,
+          0,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  96,  97,  97,  97,  97,  97,  97,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 150, 105,  23,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,   0,   0,   0,   0,   0,
+          0,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0, 125,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157,   0, 157, 157, 157, 157, 157, 157, 157,   0,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,   0,  97,  97,  97,  97,  97,  97,  97, 119,
+    },
+    {
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+         27,  62, 150, 105, 150, 105, 150, 105,   0, 150, 105, 150, 105, 150, 105, 150,
+        105, 150, 105, 150, 105, 150, 105, 150, 105,   0, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105,  33, 150, 105, 150, 105, 150, 105,  61,
+        124, 177, 150, 105, 150, 105, 174, 150, 105, 173, 173, 150, 105,   0, 168, 171,
+        172, 150, 105, 173, 175, 116, 178, 176, 150, 105, 123,   0, 178, 179, 122, 180,
+        150, 105, 150, 105, 150, 105, 182, 150, 105, 182,   0,   0, 150, 105, 182, 150,
+        105, 181, 181, 150, 105, 150, 105, 183, 150, 105,   0,   0, 150, 105,   0, 112,
+          0,   0,   0,   0, 151, 149, 104, 151, 149, 104, 151, 149, 104, 150, 105, 150,
+        105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,  80, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+          0, 151, 149, 104, 150, 105,  36,  40, 150, 105, 150, 105, 150, 105, 150, 105,
+    },
+    {
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+         30,   0, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105,   0,   0,   0,   0,   0,   0, 187, 150, 105,  29, 186, 136,
+        136, 150, 105,  28, 166, 167, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        135, 133, 134,  69,  72,   0,  73,  73,   0,  75,   0,  74, 148,   0,   0,   0,
+         73, 147,   0,  71,   0, 142, 146,   0,  70,  68, 146, 131, 144,   0,   0,  68,
+          0, 132,  67,   0,   0,  66,   0,   0,   0,   0,   0,   0,   0, 130,   0,   0,
+         64,   0, 145,  64,   0,   0,   0, 143,  64,  82,  65,  65,  81,   0,   0,   0,
+          0,   0,  63,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141, 140,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0, 114,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        150, 105, 150, 105,   0,   0, 150, 105,   0,   0,   0, 122, 122, 122,   0, 170,
+          0,   0,   0,   0,   0,   0, 160,   0, 159, 159, 159,   0, 165,   0, 164, 164,
+          0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157,   0, 157, 157, 157, 157, 157, 157, 157, 157, 157,  93,  94,  94,  94,
+          0,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  98,  97,  97,  97,  97,  97,  97,  97,  97,  97,  83,  84,  84, 152,
+         85,  87,   0,   0,   0,  90,  88, 103, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+         78,  79, 106,  76,  39,  77,   0, 150, 105,  46, 150, 105,   0,  30,  30,  30,
+    },
+    {
+        169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,  79,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105,   0,   0,   0,   0,   0,   0,   0,   0, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        153, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 102,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+    },
+    {
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+          0, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 163, 163, 163, 163, 163,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,
+         89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,
+         89,  89,  89,  89,  89,  89,  89,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185,   0, 185,   0,   0,   0,   0,   0, 185,   0,   0,
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,   0,   0, 127, 127, 127,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+        188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+        152, 152, 152, 152, 152, 152,   0,   0, 103, 103, 103, 103, 103, 103,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         52,  53,  54,  56,  56,  55,  57,  58, 137,   0,   0,   0,   0,   0,   0,   0,
+         25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+         25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+         25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,   0,   0,  25,  25,  25,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0, 138,   0,   0,   0, 128,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105,   0,   0,   0,   0,   0,  86,   0,   0,  21,   0,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+    },
+    {
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        107, 107, 107, 107, 107, 107,   0,   0,  45,  45,  45,  45,  45,  45,   0,   0,
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        107, 107, 107, 107, 107, 107,   0,   0,  45,  45,  45,  45,  45,  45,   0,   0,
+          0, 107,   0, 107,   0, 107,   0, 107,   0,  45,   0,  45,   0,  45,   0,  45,
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        113, 113, 115, 115, 115, 115, 117, 117, 121, 121, 118, 118, 120, 120,   0,   0,
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        107, 107, 107, 107, 107, 107, 107, 107,  45,  45,  45,  45,  45,  45,  45,  45,
+        107, 107,   0, 108,   0,   0,   0,   0,  45,  45,  38,  38,  44,   0,  51,   0,
+          0,   0,   0, 108,   0,   0,   0,   0,  37,  37,  37,  37,  44,   0,   0,   0,
+        107, 107,   0,   0,   0,   0,   0,   0,  45,  45,  35,  35,   0,   0,   0,   0,
+        107, 107,   0,   0,   0, 106,   0,   0,  45,  45,  34,  34,  46,   0,   0,   0,
+          0,   0,   0, 108,   0,   0,   0,   0,  31,  31,  32,  32,  44,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,  22,   0,   0,   0,  19,  20,   0,   0,   0,   0,
+          0,   0, 156,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  99,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+          0,   0,   0, 150, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+         89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,
+         89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,
+         89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,  89,
+        150, 105,  17,  24,  18,  48,  49, 150, 105, 150, 105, 150, 105,  15,  16,  13,
+         14,   0, 150, 105,   0, 150, 105,   0,   0,   0,   0,   0,   0,   0,  12,  12,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105,   0,   0,   0,   0,   0,   0,   0, 150, 105, 150, 105,   0,
+          0,   0, 150, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+         50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,
+         50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,  50,
+         50,  50,  50,  50,  50,  50,   0,  50,   0,   0,   0,   0,   0,  50,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+          0,   0, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+          0,   0,   0,   0,   0,   0,   0,   0,   0, 150, 105, 150, 105,  11, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105,   0,   0,   0, 150, 105,   7,   0,   0,
+        150, 105, 150, 105, 111,   0, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105, 150, 105, 150, 105, 150, 105,   3,   1,   2,   5,   3,   0,
+          9,   6,   8, 184, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105, 150, 105,
+        150, 105, 150, 105,  41,   4,  10, 150, 105, 150, 105,   0,   0,   0,   0,   0,
+        150, 105,   0,   0,   0,   0, 150, 105, 150, 105,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0, 150, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,  59,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,
+         47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,
+         47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,
+         47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,
+         47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  47,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,   0,   0,   0,   0,   0,
+          0,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+        162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+        162, 162, 162, 162, 162, 162, 162, 162,  91,  91,  91,  91,  91,  91,  91,  91,
+         91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,
+         91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+        162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+        162, 162, 162, 162,   0,   0,   0,   0,  91,  91,  91,  91,  91,  91,  91,  91,
+         91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,
+         91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,  91,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,   0, 161, 161, 161, 161,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,   0, 161, 161, 161, 161,
+        161, 161, 161,   0, 161, 161,   0,  92,  92,  92,  92,  92,  92,  92,  92,  92,
+         92,  92,   0,  92,  92,  92,  92,  92,  92,  92,  92,  92,  92,  92,  92,  92,
+         92,  92,   0,  92,  92,  92,  92,  92,  92,  92,   0,  92,  92,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        165, 165, 165,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,
+         83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,
+         83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,
+         83,  83,  83,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+         97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,  97,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+};
+
+/* Offsets to add to a keysym to get its lower and upper case forms. */
+static const struct case_delta case_deltas[] = {
+    { 0, 0 },
+    { -42319, 0 },
+    { -42315, 0 },
+    { -42308, 0 },
+    { -42307, 0 },
+    { -42305, 0 },
+    { -42282, 0 },
+    { -42280, 0 },
+    { -42261, 0 },
+    { -42258, 0 },
+    { -35384, 0 },
+    { -35332, 0 },
+    { -10815, 0 },
+    { -10783, 0 },
+    { -10782, 0 },
+    { -10780, 0 },
+    { -10749, 0 },
+    { -10743, 0 },
+    { -10727, 0 },
+    { -8383, 0 },
+    { -8262, 0 },
+    { -7615, 0 },
+    { -7517, 0 },
+    { -4799, 0 },
+    { -3814, 0 },
+    { -3008, 0 },
+    { -576, 0 },
+    { -199, 0 },
+    { -195, 0 },
+    { -163, 0 },
+    { -130, 0 },
+    { -128, 0 },
+    { -126, 0 },
+    { -121, 0 },
+    { -112, 0 },
+    { -100, 0 },
+    { -97, 0 },
+    { -86, 0 },
+    { -74, 0 },
+    { -60, 0 },
+    { -56, 0 },
+    { -48, 0 },
+    { -32, 0 },
+    { -16, 0 },
+    { -9, 0 },
+    { -8, 0 },
+    { -7, 0 },
+    { 0, -38864 },
+    { 0, -10795 },
+    { 0, -10792 },
+    { 0, -7264 },
+    { 0, -7205 },
+    { 0, -6254 },
+    { 0, -6253 },
+    { 0, -6244 },
+    { 0, -6243 },
+    { 0, -6242 },
+    { 0, -6236 },
+    { 0, -6181 },
+    { 0, -928 },
+    { 0, -624 },
+    { 0, -300 },
+    { 0, -232 },
+    { 0, -219 },
+    { 0, -218 },
+    { 0, -217 },
+    { 0, -214 },
+    { 0, -213 },
+    { 0, -211 },
+    { 0, -210 },
+    { 0, -209 },
+    { 0, -207 },
+    { 0, -206 },
+    { 0, -205 },
+    { 0, -203 },
+    { 0, -202 },
+    { 0, -116 },
+    { 0, -96 },
+    { 0, -86 },
+    { 0, -80 },
+    { 0, -79 },
+    { 0, -71 },
+    { 0, -69 },
+    { 0, -64 },
+    { 0, -63 },
+    { 0, -62 },
+    { 0, -59 },
+    { 0, -57 },
+    { 0, -54 },
+    { 0, -48 },
+    { 0, -47 },
+    { 0, -40 },
+    { 0, -39 },
+    { 0, -38 },
+    { 0, -37 },
+    { 0, -34 },
+    { 0, -33 },
+    { 0, -32 },
+    { 0, -31 },
+    { 0, -28 },
+    { 0, -26 },
+    { 0, -16 },
+    { 0, -15 },
+    { 0, -8 },
+    { 0, -2 },
+    { 0, -1 },
+    { 0, 7 },
+    { 0, 8 },
+    { 0, 9 },
+    { 0, 16 },
+    { 0, 32 },
+    { 0, 48 },
+    { 0, 56 },
+    { 0, 74 },
+    { 0, 84 },
+    { 0, 86 },
+    { 0, 97 },
+    { 0, 100 },
+    { 0, 112 },
+    { 0, 121 },
+    { 0, 126 },
+    { 0, 128 },
+    { 0, 130 },
+    { 0, 163 },
+    { 0, 195 },
+    { 0, 743 },
+    { 0, 1815 },
+    { 0, 3008 },
+    { 0, 3814 },
+    { 0, 4799 },
+    { 0, 10727 },
+    { 0, 10743 },
+    { 0, 10749 },
+    { 0, 10780 },
+    { 0, 10782 },
+    { 0, 10783 },
+    { 0, 10815 },
+    { 0, 35266 },
+    { 0, 35332 },
+    { 0, 35384 },
+    { 0, 42258 },
+    { 0, 42261 },
+    { 0, 42280 },
+    { 0, 42282 },
+    { 0, 42305 },
+    { 0, 42307 },
+    { 0, 42308 },
+    { 0, 42315 },
+    { 0, 42319 },
+    { 1, -1 },
+    { 1, 0 },
+    { 2, 0 },
+    { 8, 0 },
+    { 15, 0 },
+    { 16, 0 },
+    { 26, 0 },
+    { 28, 0 },
+    { 32, 0 },
+    { 34, 0 },
+    { 37, 0 },
+    { 38, 0 },
+    { 39, 0 },
+    { 40, 0 },
+    { 48, 0 },
+    { 63, 0 },
+    { 64, 0 },
+    { 69, 0 },
+    { 71, 0 },
+    { 79, 0 },
+    { 80, 0 },
+    { 116, 0 },
+    { 202, 0 },
+    { 203, 0 },
+    { 205, 0 },
+    { 206, 0 },
+    { 207, 0 },
+    { 209, 0 },
+    { 210, 0 },
+    { 211, 0 },
+    { 213, 0 },
+    { 214, 0 },
+    { 217, 0 },
+    { 218, 0 },
+    { 219, 0 },
+    { 928, 0 },
+    { 7264, 0 },
+    { 10792, 0 },
+    { 10795, 0 },
+    { 38864, 0 },
+};
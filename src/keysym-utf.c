@@ -5,9 +5,11 @@
  * (UCS, Unicode) values.
  *
  * The array keysymtab[] contains pairs of X11 keysym values for graphical
- * characters and the corresponding Unicode value. The function
- * keysym2ucs() maps a keysym onto a Unicode value using a binary search,
- * therefore keysymtab[] must remain SORTED by keysym value.
+ * characters and the corresponding Unicode value. The page tables in
+ * keysym-utf-pages.h map a keysym or a Unicode value onto its entry; they
+ * are generated from keysymtab[] by makeutf.py, which must be rerun when
+ * the table changes.
+ * keysymtab[] must remain SORTED by keysym value.
  *
  * The keysym -> UTF-8 conversion will hopefully one day be provided
  * by Xlib via XmbLookupString() and should ideally not have to be
@@ -35,6 +37,10 @@
  *
  */
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "xkbcommon/xkbcommon.h"
 #include "utils.h"
 #include "utf8.h"
@@ -835,34 +841,32 @@ static const struct codepair keysymtab[] = {
     { 0x20ac, 0x20ac }, /*                    EuroSign € EURO SIGN */
 };
 
-/* binary search with range check */
-static uint32_t
-bin_search(const struct codepair *table, size_t length, xkb_keysym_t keysym)
+#include "keysym-utf-pages.h"
+
+/* Returns the keysymtab entry for @value, or NULL if there is none. */
+static const struct codepair *
+lookup_pages(const uint8_t *page_index, size_t num_pages,
+             const uint16_t (*pages)[256], uint32_t value)
 {
-    size_t first = 0;
-    size_t last = length;
+    uint8_t page;
+    uint16_t index;
 
-    if (keysym < table[0].keysym  || keysym > table[length].keysym)
-        return 0;
+    if ((value >> 8) >= num_pages)
+        return NULL;
 
-    /* binary search in table */
-    while (last >= first) {
-        size_t mid = (first + last) / 2;
-        if (table[mid].keysym < keysym)
-            first = mid + 1;
-        else if (table[mid].keysym > keysym)
-            last = mid - 1;
-        else /* found it */
-            return table[mid].ucs;
-    }
+    page = page_index[value >> 8];
+    if (page == 0)
+        return NULL;
 
-    /* no matching Unicode value found in table */
-    return 0;
+    index = pages[page - 1][value & 0xff];
+    return index ? &keysymtab[index - 1] : NULL;
 }
 
 XKB_EXPORT uint32_t
 xkb_keysym_to_utf32(xkb_keysym_t keysym)
 {
+    const struct codepair *entry;
+
     /* first check for Latin-1 characters (1:1 mapping) */
     if ((keysym >= 0x0020 && keysym <= 0x007e) ||
         (keysym >= 0x00a0 && keysym <= 0x00ff))
@@ -884,8 +888,44 @@ xkb_keysym_to_utf32(xkb_keysym_t keysym)
     if ((keysym & 0xff000000) == 0x01000000)
         return keysym & 0x00ffffff;
 
-    /* search main table */
-    return bin_search(keysymtab, ARRAY_SIZE(keysymtab) - 1, keysym);
+    /* look up main table */
+    entry = lookup_pages(keysymtab_page_index,
+                         ARRAY_SIZE(keysymtab_page_index),
+                         keysymtab_pages, keysym);
+    return entry ? entry->ucs : 0;
+}
+
+XKB_EXPORT xkb_keysym_t
+xkb_utf32_to_keysym(uint32_t ucs)
+{
+    const struct codepair *entry;
+
+    /* first check for Latin-1 characters (1:1 mapping) */
+    if ((ucs >= 0x0020 && ucs <= 0x007e) ||
+        (ucs >= 0x00a0 && ucs <= 0x00ff))
+        return ucs;
+
+    /* special keysyms */
+    if ((ucs >= (XKB_KEY_BackSpace & 0x7f) && ucs <= (XKB_KEY_Clear & 0x7f)) ||
+        ucs == (XKB_KEY_Return & 0x7f) || ucs == (XKB_KEY_Escape & 0x7f))
+        return ucs | 0xff00;
+    if (ucs == (XKB_KEY_Delete & 0x7f))
+        return XKB_KEY_Delete;
+
+    /* Unicode non-characters and code points outside Unicode planes */
+    if ((ucs >= 0xd800 && ucs <= 0xdfff) ||
+        (ucs >= 0xfdd0 && ucs <= 0xfdef) ||
+        ucs > 0x10ffff || (ucs & 0xfffe) == 0xfffe)
+        return XKB_KEY_NoSymbol;
+
+    /* look up main table */
+    entry = lookup_pages(ucs_page_index, ARRAY_SIZE(ucs_page_index),
+                         ucs_pages, ucs);
+    if (entry)
+        return entry->keysym;
+
+    /* use direct encoding if everything else fails */
+    return ucs | 0x01000000;
 }
 
 /*
@@ -928,3 +968,82 @@ xkb_keysym_to_utf8(xkb_keysym_t keysym, char *buffer, size_t size)
 
     return utf32_to_utf8(codepoint, buffer);
 }
+
+#ifdef __SSE2__
+/*
+ * Copies runs of 8 printable ASCII keysyms, which are encoded as
+ * themselves, as long as they fit with a terminating byte.  Returns how
+ * many keysyms were copied.
+ */
+static size_t
+copy_ascii(const xkb_keysym_t *keysyms, size_t count,
+           char *buffer, size_t size)
+{
+    const __m128i lower = _mm_set1_epi32(0x1f);
+    const __m128i upper = _mm_set1_epi32(0x7f);
+    size_t i = 0;
+
+    while (i + 8 <= count && i + 8 < size) {
+        __m128i a = _mm_loadu_si128((const __m128i *) &keysyms[i]);
+        __m128i b = _mm_loadu_si128((const __m128i *) &keysyms[i + 4]);
+        __m128i ok_a = _mm_and_si128(_mm_cmpgt_epi32(a, lower),
+                                     _mm_cmplt_epi32(a, upper));
+        __m128i ok_b = _mm_and_si128(_mm_cmpgt_epi32(b, lower),
+                                     _mm_cmplt_epi32(b, upper));
+        __m128i bytes;
+
+        if (_mm_movemask_epi8(_mm_and_si128(ok_a, ok_b)) != 0xffff)
+            break;
+
+        bytes = _mm_packs_epi32(a, b);
+        bytes = _mm_packus_epi16(bytes, bytes);
+        _mm_storel_epi64((__m128i *) &buffer[i], bytes);
+        i += 8;
+    }
+
+    return i;
+}
+#endif
+
+XKB_EXPORT int
+xkb_keysyms_to_utf8(const xkb_keysym_t *keysyms, size_t count,
+                    char *buffer, size_t size)
+{
+    size_t i = 0, length = 0, written = 0;
+    bool truncated = (size == 0);
+    uint32_t codepoint;
+    int ret;
+
+    while (i < count) {
+#ifdef __SSE2__
+        if (!truncated) {
+            size_t n = copy_ascii(&keysyms[i], count - i,
+                                  buffer + written, size - written);
+            i += n;
+            length += n;
+            written += n;
+            if (i >= count)
+                break;
+        }
+#endif
+
+        /* The codepoint is checked, so the result needs no validation. */
+        codepoint = xkb_keysym_to_utf32(keysyms[i++]);
+        ret = utf32_utf8_length(codepoint);
+        if (codepoint == 0 || ret == 0)
+            continue;
+
+        /* Only whole characters are written, with the terminating byte. */
+        if (!truncated && written + ret < size)
+            written += utf32_to_utf8(codepoint, buffer + written) - 1;
+        else
+            truncated = true;
+
+        length += ret;
+    }
+
+    if (size > 0)
+        buffer[written] = '\0';
+
+    return length;
+}
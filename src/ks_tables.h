@@ -7102,3 +7102,3170 @@ static const struct name_keysym keysym_to_name[] = {
     { 0x1008ffb1, 28716 }, /* XF86TouchpadOff */
     { 0x1008ffb2, 26785 }, /* XF86AudioMicMute */
 };
+
+static const int16_t name_hash_displacements[] = {
+    0, 1, -1, 1, 0, 0, 0, 2, -2, 0,
+    0, 0, -5, 0, 0, 0, 0, 0, 1, -6,
+    1, -9, -12, -15, 0, 0, 0, 0, 0, 0,
+    -24, 0, -27, -29, 0, 0, 0, 0, 0, -32,
+    -33, -36, -37, 0, -38, -40, -42, 0, -46, 0,
+    -49, -51, 0, 0, 0, 0, 0, 1, -57, 0,
+    -58, -60, 0, -71, -72, 0, 0, 0, 0, 0,
+    4, -73, 0, 2, -75, -76, 0, 0, -77, 0,
+    0, 0, 0, 0, -79, -81, -88, 0, 0, -89,
+    0, 0, 0, 0, -91, 0, 0, 0, 0, 0,
+    0, 0, -92, 0, 0, 0, -93, 0, -96, 0,
+    1, 0, 1, 0, 1, 0, -97, 0, 0, 1,
+    -98, 0, 0, 0, 0, 0, 0, -101, 0, 0,
+    1, 0, 0, 1, -102, -103, 0, 0, 0, -104,
+    0, 0, 0, -111, -112, 0, 0, 0, -113, 0,
+    -117, 0, 0, 0, -118, -122, -126, 0, -128, -137,
+    0, -142, 1, 0, 0, -144, 0, 0, -145, 0,
+    0, 0, 3, -147, 0, 0, 0, 0, 0, -149,
+    -150, -151, -153, 0, -154, -155, -157, 0, -159, 3,
+    0, -160, 2, 0, -162, -165, 0, 0, -167, 0,
+    0, 0, -169, 1, -172, 0, 0, 0, -173, 0,
+    3, 1, 0, -174, 0, 0, 0, 0, -175, 0,
+    0, -176, 0, 0, 0, -177, -178, 0, 1, -181,
+    -186, -188, 0, -189, -190, 0, 0, -201, -202, -203,
+    0, -205, -210, 0, 0, 2, 0, 0, -211, 0,
+    0, -212, 0, 0, -213, -214, 0, 1, -215, 0,
+    1, 0, 0, 0, 0, 0, 0, -216, 0, -218,
+    0, -225, -226, -229, 0, 0, -231, -232, 0, -233,
+    0, 0, -235, 3, 0, 0, -237, -245, -246, -249,
+    0, 0, 0, 0, -251, -252, 0, -253, -257, 0,
+    -259, 0, -261, 0, 0, -263, 0, -266, -269, 0,
+    -272, 0, 0, -273, 1, 0, -276, -277, -282, -283,
+    7, 0, 0, 0, -284, -286, 0, -287, 0, 2,
+    -288, 0, 0, -290, 0, 0, 1, 0, -294, 0,
+    0, -297, 0, -299, 0, -302, -304, 0, 0, -305,
+    0, 3, 0, -306, 0, -307, -308, -310, -314, -319,
+    0, 0, -320, 0, -321, 0, -325, -326, -327, 0,
+    -328, 0, 0, -332, 0, 0, 0, 0, -334, 0,
+    -335, 0, 0, -337, 0, 0, -338, -340, -344, 0,
+    0, 5, -346, 0, 1, -347, 0, 0, -349, -350,
+    5, 0, 0, -351, -353, 0, 0, 0, -357, 0,
+    3, 0, -358, -359, 0, 0, 1, 0, 0, 0,
+    0, 0, -360, 0, 0, 0, 0, 0, 0, 0,
+    -363, -366, 0, -367, -370, 3, 0, -372, 0, 0,
+    -387, 0, 0, 1, 0, 0, -390, -393, -394, -397,
+    0, 0, -398, 5, -399, 0, 0, -402, 1, -408,
+    0, 1, 0, -409, -412, -414, -416, 0, -423, 0,
+    0, 0, 0, -425, -427, 0, 0, 0, 0, 1,
+    0, 0, -429, 0, -437, 0, -438, -439, -440, -447,
+    -449, -451, 1, 0, 0, -453, 0, 1, -456, -457,
+    1, -458, 0, 0, -460, -466, 0, -468, -473, 4,
+    1, 0, 0, 0, 0, 0, -474, 1, 0, 2,
+    0, 0, 0, -475, -481, 0, -484, 0, 0, 0,
+    -487, 3, -490, -494, -502, 0, 0, -504, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -507, 2, 1, -508, 0, 0, -513, 2, -514, -519,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+    1, 0, -525, -527, 0, -531, 3, 0, 0, 0,
+    0, 2, -532, -533, 0, 0, 0, -535, 0, -536,
+    0, -537, 0, 2, 0, 4, -539, -543, 0, 0,
+    0, 0, -544, -549, -552, 0, 0, 0, -557, 0,
+    1, 0, 0, -559, -569, -570, -572, 0, 0, -574,
+    0, 0, 0, -577, 0, 0, 0, 4, -583, 2,
+    0, -584, 0, 1, 0, -586, 0, 3, 0, 0,
+    0, 0, -587, -589, 0, 0, 0, 0, 0, -592,
+    -593, 0, -594, 1, -595, -597, -599, -602, -613, -617,
+    -618, -621, 0, 2, -626, 0, 1, 0, 0, 0,
+    0, 0, -632, 3, 0, -633, 1, 0, 0, 5,
+    -637, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+    0, 3, 3, 0, -638, 2, 3, 0, 0, 2,
+    0, -639, 0, 0, -643, 2, 1, 3, 0, 0,
+    -644, 0, 0, 0, -645, 0, -646, 2, -650, 0,
+    0, -651, 0, 0, -656, 0, -657, 1, 2, -660,
+    -661, 2, -663, 0, 0, -669, 0, 0, 0, -670,
+    -672, 5, 1, -675, 0, -679, 0, -680, 0, 0,
+    -683, -684, -685, 0, 0, -689, 0, 0, 0, 0,
+    3, -690, 0, -692, 0, 0, -697, -699, 0, -700,
+    0, 0, -703, 5, -706, 0, 0, -707, 2, 0,
+    0, 0, -708, 0, -713, -715, 1, 0, 0, -716,
+    1, -717, -718, -719, 0, -720, 0, 0, -721, 6,
+    0, 0, -724, 0, -727, -731, -733, -734, 0, 0,
+    -735, -743, 0, 4, 0, 3, 1, -746, 0, 1,
+    2, 0, 0, 0, 0, -750, 1, -755, 0, 1,
+    -757, 0, 0, 0, 0, 0, 0, 0, 0, -765,
+    0, 0, -766, 0, 0, 1, -769, -771, 0, 0,
+    0, -772, -773, -774, 0, -776, -777, -778, 0, -781,
+    0, -784, 0, 0, -787, -793, 0, 0, -794, 0,
+    0, 0, 0, -795, 0, 0, 0, 0, 1, 0,
+    -797, 0, -802, 0, -806, 0, 0, 0, -816, 0,
+    -817, 0, -821, -823, 0, 1, 0, 4, -825, 0,
+    -827, 0, 0, -828, -835, -838, 0, 0, 1, -842,
+    0, 0, -844, -845, 0, 0, 0, -847, 0, 0,
+    3, -848, -849, 0, 1, 0, 2, 0, 0, 0,
+    3, -851, 0, -853, 0, -854, 0, 0, -858, 0,
+    -859, -860, 0, 4, 0, 2, -861, -862, 3, -863,
+    -866, 0, -869, 0, 0, -872, -873, -875, 0, -878,
+    0, 0, 1, -880, 0, -884, 0, -886, 0, 5,
+    0, -887, 0, 1, 4, 0, 0, -888, -894, -896,
+    0, 2, 0, 1, 0, 0, 0, -897, 0, -902,
+    0, 0, 0, 0, 0, -911, 0, 0, 2, -913,
+    0, -915, -917, 2, 0, 0, 0, -918, 0, -919,
+    0, 0, 0, 1, 0, 2, 0, 0, 0, -922,
+    5, -923, 0, 1, 3, 2, 6, 0, 0, 0,
+    1, 0, -924, -925, 0, 1, 0, -928, -929, -930,
+    -936, 0, 3, 0, 0, 0, -939, 0, -944, -951,
+    0, -959, 0, 0, -962, 0, 6, -964, -965, 0,
+    1, -969, 0, 0, 0, 4, 0, -971, 0, 0,
+    -976, -980, 2, 0, 0, 0, -981, 0, -983, 0,
+    -989, 0, 6, 0, -990, 5, 0, 6, 0, 0,
+    0, 0, 0, 0, 13, 1, -991, -994, 2, 0,
+    -997, 0, 0, 0, 0, -998, 0, 1, -999, 0,
+    -1014, 7, -1018, 0, 0, 1, 1, -1019, 0, -1025,
+    -1027, -1029, -1030, 0, 0, 0, 0, 0, -1033, 0,
+    0, 0, -1035, -1039, 0, 0, 0, 0, 0, 0,
+    -1042, -1043, -1046, -1047, 0, -1049, -1050, -1060, 0, 0,
+    -1065, 0, 0, 1, 6, 0, -1070, 0, -1071, -1072,
+    -1073, 0, -1074, -1078, 0, 0, 8, -1079, 0, -1087,
+    -1088, -1089, 0, -1092, -1094, 5, 0, 0, -1095, 0,
+    6, -1096, -1098, -1099, 0, 0, 0, -1101, -1103, 0,
+    -1106, -1107, 0, 0, -1109, -1112, 0, 0, 0, -1115,
+    0, -1118, 0, -1125, -1131, 0, 0, -1137, -1138, -1139,
+    -1141, -1142, 0, 0, -1144, 0, 0, -1150, 2, 1,
+    0, -1154, -1155, 0, 0, 0, -1159, 3, -1160, 0,
+    0, -1162, 7, 0, 0, 1, 0, 0, 0, 0,
+    -1164, 4, -1167, 5, 0, -1169, 0, 1, -1171, 0,
+    2, -1172, -1173, 0, 0, -1174, -1175, 0, 0, -1182,
+    0, -1185, 0, -1186, 0, -1188, -1191, -1193, 0, 1,
+    0, 9, -1195, 0, 0, 2, 0, 0, 2, 0,
+    -1197, -1203, 0, -1205, 0, 2, 1, -1206, -1207, 0,
+    0, 0, 1, -1209, 1, 1, -1213, 0, 0, 5,
+    0, 0, -1215, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 1, 0, 0, -1217, 3, 0, 0,
+    0, 0, 0, 0, -1219, 0, 4, 2, -1221, 0,
+    3, 0, -1222, -1223, 12, -1228, 0, 0, 0, 0,
+    0, 0, -1235, -1240, -1243, 0, -1246, 0, 0, 0,
+    -1247, 0, -1248, 8, 0, 0, -1249, 4, -1251, 0,
+    -1253, 0, 0, -1255, -1258, 5, 0, 7, 5, -1259,
+    -1264, -1268, -1272, 13, 0, 2, 0, 0, 3, 9,
+    -1273, -1274, -1277, 0, 0, 8, 0, 0, -1279, 0,
+    0, 0, 0, -1283, -1284, 0, -1285, -1286, 0, -1289,
+    0, -1292, -1293, -1295, 0, -1296, 0, 0, 0, 0,
+    -1298, 0, 0, 0, -1301, 0, 0, 0, -1306, 2,
+    0, -1308, 0, 0, 0, -1311, 0, 0, -1315, 0,
+    -1316, -1318, 0, 1, 0, -1320, 6, 0, 0, 0,
+    0, 0, 2, -1321, 0, 0, -1328, 0, -1330, 0,
+    10, 1, 0, -1341, 0, 0, 0, 0, 1, 1,
+    0, -1344, 1, 0, -1349, -1353, -1355, -1356, -1358, -1360,
+    0, 0, 0, -1361, -1364, 0, 1, -1365, -1366, 0,
+    0, -1376, -1379, -1381, 0, 0, 0, -1382, 0, 0,
+    0, -1383, 0, 0, -1385, 0, 2, 0, -1386, 0,
+    -1394, 0, -1395, -1396, -1397, 0, -1400, 0, 0, 0,
+    -1401, -1402, 0, -1403, -1404, 0, -1407, -1414, 0, -1416,
+    0, 9, 5, -1424, -1425, -1427, 2, 3, 0, 0,
+    -1428, 1, 0, -1433, 0, 8, 0, -1435, 0, 4,
+    -1440, 10, 0, -1441, -1443, -1445, -1452, -1457, -1458, 3,
+    3, 0, -1459, 2, 0, 0, 0, 0, 0, -1464,
+    6, -1466, 1, 0, 0, -1470, 5, 1, -1471, -1473,
+    0, 4, 1, 0, -1474, 0, 0, -1475, 1, -1476,
+    -1481, -1482, -1484, -1491, -1496, 2, 0, 0, 0, 0,
+    -1501, 5, 0, 0, 1, 0, 0, -1505, 0, -1507,
+    0, -1508, -1509, 0, -1511, -1512, -1513, 0, -1514, 0,
+    -1519, -1520, 0, -1521, -1522, 5, 0, 0, -1524, 0,
+    -1528, 0, -1530, 0, -1531, 4, 0, -1541, -1546, 0,
+    -1554, 0, 3, -1557, 5, -1558, 0, 0, 0, 0,
+    -1559, -1560, 0, -1561, -1563, -1568, -1569, -1570, -1573, -1576,
+    0, 0, -1578, -1584, -1593, -1595, -1597, 0, 5, -1598,
+    0, 1, 1, -1602, 0, 3, -1604, -1609, 0, 6,
+    0, 0, -1610, -1614, -1615, -1617, -1618, 0, 0, 0,
+    1, 4, -1619, 0, 0, 0, 0, -1620, -1621, -1623,
+    0, -1625, 1, 1, 0, -1626, 0, 0, 13, 0,
+    -1627, 0, 0, 1, 0, 1, -1630, 2, 0, 1,
+    -1631, 0, -1636, -1637, -1638, 25, 0, 2, 0, -1643,
+    -1645, 0, 0, 0, 0, 15, -1648, 0, 8, 0,
+    8, 5, 0, 0, 0, 0, -1650, 7, 2, -1652,
+    0, -1655, 0, -1658, -1661, -1664, -1670, 2, -1672, 0,
+    -1675, -1678, 1, 4, 4, 0, -1681, -1682, -1687, 3,
+    0, 1, 5, 0, 4, -1688, 9, -1689, -1691, 4,
+    -1700, 0, -1704, -1706, -1710, -1713, -1718, -1721, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, -1723, -1724, 0,
+    0, 0, 11, 11, 0, 0, 0, -1726, -1731, -1732,
+    0, -1736, -1737, -1740, 0, 0, 0, -1743, 0, -1749,
+    0, -1754, 0, 0, 0, 0, 3, 0, -1755, -1759,
+    0, -1761, 0, 0, 0, -1764, -1767, 1, 0, -1768,
+    7, 0, -1769, -1771, 0, 0, 0, 0, 0, 2,
+    0, 6, 0, 0, -1777, 0, 0, 0, -1778, 16,
+    15, 1, -1779, 7, -1783, -1784, 0, 0, -1785, 0,
+    0, 0, 8, 0, 0, 0, -1787, 4, -1796, 0,
+    0, -1797, 0, -1798, -1802, 0, -1804, -1805, -1807, -1811,
+    0, -1813, -1815, -1817, 0, -1818, 5, 0, 1, -1829,
+    -1833, 0, 1, -1834, 0, -1835, 0, -1839, -1847, 0,
+    -1853, 0, 0, -1854, -1856, -1858, 0, -1862, -1863, 0,
+    -1864, 2, -1865, -1872, 0, 0, 1, 0, 0, 0,
+    5, -1878, 1, 0, 11, -1879, -1882, -1886, 1, 0,
+    -1887, -1890, -1891, -1893, -1902, 0, 0, -1905, 0, -1906,
+    5, -1910, -1913, -1916, 0, 0, -1920, 1, -1923, 0,
+    -1926, 0, -1927, -1929, 0, 0, 0, 0, 3, -1940,
+    -1941, -1949, 4, 0, 0, 0, 0, 3, -1952, 0,
+    2, 0, -1954, -1958, 0, -1960, -1961, 0, -1968, -1969,
+    0, 3, 1, -1975, -1976, 0, 9, 0, 0, 0,
+    -1982, 0, 0, -1985, 0, -1995, -1998, 0, 0, -2005,
+    0, -2006, 0, 4, 0, 0, -2008, 0, -2010, -2011,
+    -2012, -2013, -2014, 3, -2015, 0, -2017, 3, 0, -2019,
+    0, -2020, 0, -2023, -2024, 0, -2025, 0, -2027, -2030,
+    0, -2032, -2035, 1, 0, 0, 0, 0, 0, 0,
+    -2042, -2045, 0, 0, 0, -2046, 1, -2050, 0, -2052,
+    0, 2, 0, -2056, 0, -2059, 4, 0, -2065, 0,
+    -2067, 0, -2068, 0, 0, -2069, -2070, 4, -2071, 0,
+    0, 0, 0, 1, -2072, -2078, 0, 0, -2083, 0,
+    0, -2085, -2088, 17, 1, 0, 0, -2090, -2091, 2,
+    2, -2096, 6, 0, 1, -2101, 2, 0, -2103, 0,
+    5, 0, 0, 0, 1, 4, 1, 0, 16, -2104,
+    -2107, 0, 0, 2, -2113, -2114, -2117, 2, -2119, -2120,
+    1, 10, -2122, 1, 0, 0, 2, -2124, 0, 0,
+    0, 3, -2129, 0, 0, 0, 0, -2134, 59, 0,
+    2, 0, -2137, -2140, -2143, 0, -2144, 1, 0, 3,
+    11, 1, -2147, 0, 0, -2150, -2151, -2152, 0, 0,
+    1, 22, -2156, -2157, -2161, 0, 0, 0, -2165, 12,
+    10, 11, 0, -2166, 16, 1, -2169, -2171, -2173, -2174,
+    0, 0, 0, 1, -2180, 0, -2186, -2193, -2195, -2197,
+    0, 7, 0, 0, 0, 0, -2198, -2199, 0, -2200,
+    -2201, 0, 0, 2, 0, 0, -2210, 2, 0, 0,
+    0, 0, -2212, -2213, -2216, 4, 6, 0, -2218, 2,
+    0, 0, 0, 0, -2219, -2220, 0, -2224, 0, -2225,
+    -2229, -2231, -2232, 0, 0, 0, 6, -2234, 0, 0,
+    0, 0, 2, 0, 0, 3, -2238, 0, 0, 0,
+    0, 7, 0, 0, 11, 5, -2239, 1, -2240, -2243,
+    0, 0, -2244, -2249, -2250, -2251, -2256, 15, -2258, -2260,
+    -2264, -2271, 0, 0, 0, 0, 0, -2282, -2285, 0,
+    0, -2286, 0, 0, 0, -2287, 7, -2291, -2292, 0,
+    0, 0, -2294, 0, 0, 0, 0, -2295, 7, 0,
+    -2299, 3, -2300, 12, 7, -2301, 0, 0, 1, -2302,
+    1, 0, 0, -2304, -2313, -2314, -2319, -2320, 0, 0,
+    15, 3, 0, -2323, 0, -2326, -2329, 0, 0, 1,
+    0, -2332, 0, 3, 0, -2334, -2336, 7, 0, 0,
+    20, -2345, -2346, -2347, 0, -2354, 0, 0, 0, 3,
+    0, 8, 0, 0, 0, 0, 0, 0, -2356, -2361,
+    -2362, 0, 14, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, -2363, -2370, 0, -2372, -2374, -2375, 0, 2,
+    0, 15, 0, -2376, -2385, -2389, 0, -2390, -2397, 2,
+    16, 3, 0, 0, 0, 0, -2401, 0, -2402, 17,
+    0, 1,
+};
+
+/* Indices into name_to_keysym. */
+static const uint16_t name_hash_entries[] = {
+    2207, 2306, 661, 2100, 2138, 2202, 1362, 1151, 1967, 514,
+    329, 2268, 79, 937, 2193, 1490, 642, 1337, 175, 213,
+    559, 428, 1873, 671, 1041, 335, 54, 1928, 446, 1607,
+    2160, 1304, 1268, 1932, 1335, 1569, 473, 1357, 1470, 1225,
+    519, 926, 899, 2350, 1049, 1134, 1264, 2166, 252, 2357,
+    1290, 484, 1927, 792, 842, 88, 1083, 64, 372, 587,
+    1540, 1354, 1497, 205, 2033, 1135, 1879, 108, 2062, 1884,
+    2277, 2377, 1891, 1764, 1173, 1788, 576, 1352, 1013, 1840,
+    435, 667, 2064, 274, 891, 640, 1599, 709, 2042, 2312,
+    382, 1723, 1698, 806, 1509, 790, 975, 447, 2076, 1500,
+    1750, 985, 1971, 1031, 1071, 2146, 665, 1859, 621, 1863,
+    1626, 1102, 1109, 2157, 1896, 420, 638, 1533, 1732, 1683,
+    1916, 858, 761, 1603, 332, 40, 2212, 2148, 442, 2249,
+    1463, 2006, 1942, 904, 357, 1637, 307, 634, 1333, 1000,
+    1486, 1202, 2068, 1089, 2144, 378, 979, 997, 911, 401,
+    1602, 929, 1687, 1472, 1780, 204, 962, 1634, 2286, 11,
+    230, 1524, 1153, 722, 747, 1193, 965, 2292, 1807, 1315,
+    1591, 1755, 1393, 961, 445, 288, 932, 1499, 489, 541,
+    650, 1565, 429, 1742, 1953, 1336, 2223, 1444, 99, 1172,
+    551, 520, 1711, 2067, 1376, 2388, 1063, 804, 1882, 1457,
+    1653, 1032, 726, 216, 2149, 2054, 852, 130, 1028, 2032,
+    468, 879, 1449, 1023, 1222, 725, 1274, 75, 402, 1317,
+    2180, 231, 262, 1661, 2094, 2245, 241, 602, 2195, 1236,
+    1170, 2066, 1082, 246, 2028, 293, 1331, 70, 2065, 450,
+    255, 1568, 732, 1598, 659, 2232, 2189, 253, 120, 885,
+    2163, 524, 2393, 1087, 1848, 2358, 1078, 2270, 1022, 1529,
+    925, 1938, 427, 1210, 674, 1008, 521, 1242, 2206, 1766,
+    2173, 1609, 422, 539, 2291, 737, 1667, 1478, 597, 1179,
+    2299, 1174, 1906, 2304, 466, 685, 1917, 2109, 2366, 235,
+    2179, 344, 1186, 149, 1002, 1730, 752, 615, 715, 633,
+    138, 556, 1854, 1006, 1532, 2379, 1968, 1458, 760, 16,
+    2201, 1649, 1516, 1722, 1678, 956, 1997, 176, 118, 1552,
+    1830, 199, 380, 414, 2115, 688, 586, 1208, 931, 1187,
+    1334, 400, 923, 1247, 981, 807, 497, 7, 2305, 1681,
+    71, 418, 1740, 87, 2316, 2260, 1504, 605, 1158, 2298,
+    692, 356, 2252, 197, 55, 1367, 2322, 1579, 2385, 797,
+    660, 2214, 2333, 1714, 1620, 1911, 1767, 2081, 826, 2323,
+    1992, 2242, 1893, 1925, 1664, 1796, 1103, 958, 426, 1798,
+    574, 2355, 1857, 2301, 772, 1799, 452, 1473, 1495, 945,
+    2352, 2273, 584, 934, 1419, 2165, 1984, 1399, 1409, 1467,
+    1781, 1165, 2339, 1481, 680, 1960, 440, 1197, 1737, 133,
+    656, 2079, 1125, 2297, 302, 780, 1505, 1306, 2342, 1822,
+    591, 374, 1935, 2140, 136, 2395, 278, 1069, 871, 2383,
+    2082, 277, 678, 1627, 1944, 1476, 247, 1622, 1877, 432,
+    1829, 1762, 1321, 441, 301, 1779, 96, 2099, 1092, 2303,
+    801, 746, 2078, 537, 1167, 1412, 405, 1300, 1739, 1501,
+    828, 1232, 397, 1188, 1820, 2253, 2310, 1717, 830, 827,
+    5, 2236, 1421, 2164, 531, 1359, 883, 2162, 1307, 1910,
+    25, 1754, 2226, 34, 1816, 1619, 1817, 143, 1324, 1572,
+    1430, 757, 9, 394, 1054, 1050, 1253, 614, 2056, 1976,
+    795, 2266, 244, 898, 1397, 930, 2208, 1828, 2215, 94,
+    2344, 1668, 2155, 924, 1616, 2341, 1014, 1488, 345, 275,
+    611, 2217, 829, 1428, 2251, 567, 1489, 1656, 142, 2336,
+    1680, 1353, 1761, 1665, 187, 2373, 1878, 861, 1160, 166,
+    2374, 2240, 641, 2029, 2216, 762, 645, 948, 237, 423,
+    1623, 2337, 2003, 1696, 543, 496, 2171, 562, 849, 896,
+    2161, 38, 1019, 1844, 1645, 1468, 68, 1437, 1721, 563,
+    500, 2239, 824, 1295, 809, 1148, 56, 918, 1892, 2343,
+    1371, 2096, 1144, 632, 114, 1991, 1243, 2313, 2293, 2276,
+    1108, 156, 1901, 395, 8, 1712, 226, 1902, 699, 977,
+    701, 938, 1272, 1905, 1403, 1459, 119, 86, 1261, 141,
+    1405, 837, 116, 477, 214, 566, 2114, 1351, 368, 647,
+    606, 260, 1834, 209, 1931, 604, 48, 129, 983, 2184,
+    283, 2136, 103, 748, 1100, 1922, 1735, 338, 2219, 90,
+    654, 2106, 2238, 1164, 1294, 1111, 449, 1036, 169, 980,
+    371, 1001, 1871, 78, 2069, 1731, 1987, 1140, 1601, 1480,
+    1163, 101, 2314, 147, 1085, 2071, 886, 2047, 526, 1104,
+    1895, 1126, 2169, 822, 2107, 831, 122, 1133, 97, 2390,
+    1952, 1021, 818, 1929, 1258, 1675, 518, 2046, 727, 1718,
+    1573, 1880, 236, 2142, 2256, 1808, 2190, 2126, 609, 306,
+    2026, 458, 1374, 228, 1554, 1818, 1231, 37, 2345, 1110,
+    2362, 1199, 1988, 128, 2102, 630, 646, 2398, 897, 1874,
+    212, 710, 251, 957, 1262, 959, 719, 1550, 1384, 1485,
+    1876, 1744, 1401, 1503, 2057, 459, 1542, 2360, 1400, 750,
+    1716, 1392, 1207, 1443, 1441, 1065, 840, 243, 12, 716,
+    1726, 1043, 352, 1851, 1760, 998, 1697, 84, 1152, 1772,
+    986, 1115, 483, 2074, 42, 2095, 1190, 1450, 334, 2265,
+    1640, 221, 1106, 643, 702, 384, 2361, 210, 1520, 2235,
+    2058, 353, 44, 360, 346, 2321, 1757, 570, 1523, 901,
+    1094, 1074, 863, 1456, 1582, 1831, 2111, 164, 1519, 1611,
+    1528, 30, 1617, 510, 2244, 2092, 22, 860, 1886, 1282,
+    657, 1205, 619, 560, 254, 462, 1246, 434, 127, 527,
+    263, 53, 1293, 2008, 799, 1184, 1417, 1219, 733, 1328,
+    1288, 272, 511, 183, 2258, 1029, 1736, 1954, 43, 1846,
+    349, 2103, 1129, 461, 516, 623, 627, 1538, 59, 76,
+    2351, 2118, 2326, 573, 2308, 963, 2199, 603, 39, 58,
+    2133, 906, 63, 952, 777, 1157, 1147, 734, 1131, 1302,
+    1017, 1915, 217, 655, 1492, 1614, 1256, 1348, 743, 2346,
+    1950, 1265, 421, 581, 1037, 523, 1249, 367, 960, 865,
+    2108, 909, 1980, 1382, 601, 407, 498, 884, 1835, 1088,
+    2296, 1701, 1240, 1522, 1729, 735, 1545, 2070, 1594, 600,
+    145, 2369, 2150, 460, 1183, 1257, 488, 653, 1909, 2061,
+    779, 2400, 689, 1120, 218, 2328, 2087, 1226, 36, 31,
+    2222, 1244, 150, 1777, 1407, 1209, 478, 1574, 2264, 2050,
+    1418, 588, 2233, 1369, 1448, 1539, 1936, 662, 1224, 1578,
+    900, 2335, 575, 1581, 1694, 1332, 1143, 878, 1774, 2282,
+    2011, 1707, 1889, 1345, 1531, 1553, 534, 1248, 179, 456,
+    1312, 988, 1169, 1648, 544, 922, 1998, 1586, 2105, 765,
+    2097, 177, 2399, 1316, 767, 1651, 1347, 1138, 1970, 1847,
+    1056, 316, 1311, 1442, 1342, 1555, 1784, 1689, 2353, 1836,
+    333, 1652, 927, 225, 2084, 984, 1395, 2397, 994, 475,
+    1223, 564, 463, 1752, 2116, 415, 1832, 741, 364, 267,
+    448, 233, 1631, 499, 2007, 381, 1700, 2034, 312, 1727,
+    2125, 1171, 1127, 1411, 1024, 1040, 1072, 211, 2315, 1900,
+    1281, 425, 812, 383, 921, 1062, 636, 1841, 2045, 1676,
+    2052, 1141, 20, 1541, 528, 1913, 317, 200, 859, 2247,
+    1810, 1963, 1339, 1825, 2183, 110, 796, 33, 2263, 1077,
+    1937, 1095, 2259, 256, 131, 1705, 1003, 1713, 222, 1890,
+    970, 2384, 299, 2113, 1511, 530, 375, 1194, 1560, 268,
+    2016, 789, 917, 754, 464, 2122, 1389, 2367, 2019, 1191,
+    1168, 1289, 1650, 1748, 769, 2039, 1563, 486, 820, 1613,
+    1035, 2120, 629, 1314, 77, 751, 791, 1770, 295, 2000,
+    465, 2174, 672, 294, 907, 2141, 1365, 1047, 1628, 309,
+    323, 1018, 2089, 2027, 281, 2320, 2288, 171, 1493, 533,
+    673, 1673, 1526, 416, 1471, 1562, 549, 1930, 2401, 370,
+    2151, 1793, 1299, 1853, 1308, 1966, 713, 905, 940, 1629,
+    259, 1738, 1510, 944, 49, 626, 1241, 742, 1957, 124,
+    1217, 1310, 472, 1672, 607, 844, 1440, 1451, 1058, 712,
+    61, 2317, 1012, 1360, 1067, 1801, 2014, 433, 565, 1887,
+    731, 1606, 973, 585, 850, 1415, 2085, 729, 1956, 2197,
+    341, 1773, 304, 583, 491, 2271, 775, 4, 2152, 193,
+    877, 1838, 784, 2139, 1121, 2365, 882, 848, 776, 322,
+    771, 1677, 398, 2147, 1674, 326, 2218, 1016, 366, 2048,
+    1220, 1663, 291, 1708, 793, 284, 841, 1136, 467, 1323,
+    1318, 3, 2090, 1491, 816, 2378, 1978, 1048, 2004, 2123,
+    286, 2234, 2040, 1590, 1875, 1279, 1866, 1325, 943, 2364,
+    1438, 1684, 2329, 946, 1358, 1794, 1466, 2086, 1285, 2221,
+    1080, 2338, 292, 1068, 2077, 794, 1783, 1765, 135, 785,
+    492, 857, 2031, 717, 224, 2060, 315, 1615, 555, 411,
+    1010, 723, 1245, 1521, 1885, 1947, 694, 1366, 296, 1662,
+    1237, 1250, 1142, 1286, 2104, 1881, 1994, 227, 188, 874,
+    391, 2194, 1995, 773, 1284, 1297, 2248, 264, 436, 310,
+    234, 152, 1559, 172, 612, 2295, 535, 1800, 1551, 2110,
+    1803, 1638, 298, 2209, 1644, 2059, 1610, 2072, 1201, 1097,
+    1949, 730, 1185, 2159, 2272, 838, 377, 13, 590, 195,
+    343, 305, 1465, 832, 17, 1813, 107, 453, 1025, 599,
+    348, 991, 1498, 1084, 2204, 1341, 529, 2176, 1557, 190,
+    1414, 1182, 1945, 635, 412, 1883, 229, 995, 481, 912,
+    942, 1107, 419, 385, 2381, 1388, 1983, 1350, 1635, 2013,
+    622, 358, 976, 2220, 1747, 167, 1564, 388, 598, 676,
+    1026, 1070, 100, 1303, 2237, 2175, 1719, 1309, 618, 182,
+    1624, 430, 987, 1474, 1496, 144, 1507, 1972, 1670, 686,
+    1535, 1155, 2181, 215, 2359, 644, 2347, 1693, 1039, 123,
+    1702, 2053, 2130, 740, 303, 1327, 104, 1123, 2289, 1940,
+    146, 1872, 1525, 80, 1558, 1537, 1786, 651, 1252, 1385,
+    1745, 1322, 328, 72, 392, 361, 1189, 2005, 2002, 1154,
+    41, 1044, 967, 45, 1149, 902, 1053, 155, 1298, 550,
+    1338, 1514, 1251, 2262, 525, 658, 787, 853, 1379, 698,
+    1363, 1398, 1420, 920, 596, 1277, 1378, 1933, 1431, 1584,
+    851, 1214, 1741, 1052, 2386, 2143, 1821, 2187, 569, 745,
+    703, 2246, 1213, 406, 2124, 2041, 933, 1530, 324, 616,
+    1045, 2018, 1918, 1046, 690, 1608, 691, 1410, 1064, 95,
+    1034, 700, 1604, 379, 106, 1305, 276, 1206, 843, 1962,
+    19, 2112, 474, 1390, 2182, 1195, 893, 2119, 1547, 1150,
+    261, 1313, 148, 1899, 1759, 2330, 1030, 408, 2020, 913,
+    457, 1116, 154, 1791, 1743, 386, 336, 369, 1543, 954,
+    1923, 996, 1494, 2073, 1375, 2290, 708, 1435, 2287, 347,
+    2309, 705, 1380, 1296, 1439, 1098, 2153, 159, 1349, 1079,
+    2063, 1769, 2167, 194, 1589, 1948, 1228, 2203, 35, 1461,
+    1612, 1122, 258, 509, 971, 808, 2269, 2172, 362, 111,
+    617, 684, 847, 245, 1792, 1487, 2356, 982, 1576, 2257,
+    928, 1059, 1301, 1919, 173, 536, 649, 91, 989, 161,
+    736, 1685, 178, 191, 1175, 1091, 1839, 480, 1720, 2035,
+    2278, 2117, 1269, 2307, 1768, 1055, 1965, 670, 2017, 1908,
+    663, 1512, 553, 1009, 1124, 1475, 887, 506, 548, 1921,
+    1903, 1221, 1181, 2224, 2391, 1396, 873, 2389, 2370, 1709,
+    2284, 1797, 1276, 864, 2213, 1643, 1951, 314, 23, 1425,
+    845, 2091, 1556, 1119, 862, 2318, 1453, 290, 1849, 953,
+    854, 1833, 781, 132, 439, 1636, 834, 1843, 1888, 894,
+    1020, 266, 1406, 1914, 1633, 1655, 387, 1132, 139, 2302,
+    916, 2021, 14, 1852, 69, 1588, 2311, 969, 2191, 814,
+    2098, 393, 1989, 192, 868, 162, 437, 330, 1856, 669,
+    1867, 908, 558, 451, 198, 557, 1850, 1267, 1416, 2030,
+    1710, 1819, 390, 1275, 2154, 1502, 1176, 589, 813, 1180,
+    855, 1570, 232, 151, 1233, 1837, 1959, 1855, 1105, 1093,
+    165, 568, 476, 1771, 753, 1534, 803, 805, 105, 778,
+    495, 1692, 365, 417, 1823, 681, 2156, 1101, 1446, 490,
+    1658, 696, 93, 1287, 1977, 625, 113, 1218, 206, 1090,
+    1178, 949, 1941, 1383, 238, 125, 577, 1506, 1805, 157,
+    639, 1826, 2025, 833, 1130, 1621, 73, 875, 102, 1686,
+    2196, 2363, 724, 1413, 1587, 1756, 992, 471, 1273, 1974,
+    1904, 282, 50, 2192, 721, 174, 652, 331, 2012, 766,
+    1387, 115, 454, 1641, 1368, 1682, 1408, 196, 340, 1571,
+    2225, 668, 836, 24, 1924, 749, 1075, 648, 517, 711,
+    1432, 1271, 337, 974, 1749, 485, 880, 220, 1361, 768,
+    1234, 1326, 2354, 280, 1695, 966, 867, 355, 1597, 582,
+    399, 2285, 6, 1113, 2010, 515, 1943, 1733, 413, 2178,
+    1007, 1329, 2227, 285, 1320, 718, 2254, 572, 872, 1215,
+    2170, 1426, 121, 941, 1907, 1864, 273, 2325, 2380, 1370,
+    1802, 1469, 1128, 1436, 1654, 2340, 18, 507, 1647, 184,
+    2319, 2375, 1646, 1280, 403, 1703, 98, 1778, 1340, 1513,
+    695, 1657, 1811, 27, 1870, 693, 1066, 26, 455, 270,
+    202, 1424, 1561, 1464, 1204, 870, 2134, 60, 739, 2243,
+    972, 2101, 613, 2241, 889, 1595, 279, 1434, 2049, 2281,
+    112, 697, 1724, 1177, 1216, 1746, 223, 57, 1815, 1824,
+    1725, 968, 117, 620, 52, 1192, 494, 1969, 1544, 782,
+    2327, 759, 2283, 1659, 2137, 404, 82, 815, 2275, 28,
+    1946, 2188, 999, 755, 32, 666, 774, 1260, 2145, 2083,
+    1259, 1630, 2376, 470, 10, 1763, 1270, 482, 1981, 1993,
+    350, 1278, 579, 373, 538, 1776, 810, 2185, 1804, 1666,
+    1861, 321, 126, 683, 513, 47, 2036, 1642, 1704, 756,
+    1483, 1386, 438, 443, 1961, 1912, 1454, 512, 240, 783,
+    1373, 1795, 1536, 919, 1548, 1999, 714, 479, 1751, 1625,
+    2135, 1688, 289, 1958, 758, 1211, 1099, 1897, 895, 1455,
+    1096, 2200, 978, 74, 1669, 817, 469, 951, 1156, 269,
+    1117, 1118, 339, 1809, 2198, 561, 1679, 85, 21, 319,
+    1753, 540, 376, 1061, 62, 444, 239, 2, 504, 51,
+    2294, 1985, 1227, 1845, 628, 2121, 1549, 170, 2023, 1381,
+    249, 311, 1447, 955, 1715, 1429, 248, 720, 1038, 2186,
+    1926, 2129, 134, 1546, 1346, 1639, 839, 508, 1139, 835,
+    869, 1706, 1394, 242, 1975, 271, 1996, 351, 2051, 1460,
+    1567, 1146, 552, 2349, 1004, 1728, 389, 83, 1869, 1858,
+    825, 1782, 821, 201, 1319, 1660, 186, 2131, 2088, 2332,
+    1372, 1515, 2127, 1758, 2080, 1812, 1060, 2211, 313, 580,
+    493, 1484, 109, 66, 546, 1073, 1239, 1200, 1137, 545,
+    1081, 1898, 15, 594, 728, 65, 1238, 1868, 1330, 168,
+    1162, 2348, 1862, 2177, 2267, 1775, 1939, 185, 1086, 92,
+    1934, 800, 89, 950, 2015, 1583, 2055, 704, 1593, 2255,
+    502, 327, 359, 2075, 819, 1842, 1015, 993, 1404, 687,
+    424, 203, 624, 1592, 1161, 160, 1166, 1344, 939, 163,
+    2043, 706, 208, 2324, 1806, 1005, 1145, 67, 409, 1527,
+    936, 990, 1920, 1254, 2279, 1203, 547, 1291, 1580, 1263,
+    1112, 2368, 2128, 1452, 431, 1033, 1986, 1691, 1605, 29,
+    2274, 2001, 1575, 677, 1734, 770, 81, 189, 1391, 1423,
+    1364, 1827, 325, 2372, 892, 2371, 487, 764, 744, 2387,
+    1482, 856, 1027, 318, 1785, 1076, 914, 610, 738, 542,
+    802, 1198, 1990, 300, 1577, 181, 2261, 1690, 903, 2038,
+    2228, 297, 2392, 1229, 592, 1011, 1982, 888, 876, 46,
+    503, 1159, 1517, 1427, 2132, 935, 2231, 158, 501, 1955,
+    287, 219, 505, 1266, 396, 1479, 595, 798, 2093, 881,
+    308, 1787, 2250, 1377, 1051, 2229, 1973, 1355, 265, 1433,
+    578, 823, 1356, 2037, 1, 1632, 1865, 664, 180, 1600,
+    631, 811, 1230, 2382, 532, 910, 1057, 2331, 1964, 846,
+    1235, 207, 1789, 788, 2158, 1343, 1699, 1114, 1518, 1255,
+    593, 320, 763, 1477, 363, 1402, 137, 554, 947, 786,
+    0, 2300, 1422, 2168, 915, 1292, 1894, 679, 2009, 1283,
+    707, 2210, 153, 140, 2396, 2230, 1790, 1566, 675, 2044,
+    2022, 1585, 1462, 410, 1445, 1671, 1979, 2024, 866, 682,
+    964, 1814, 1508, 522, 1596, 257, 1212, 608, 571, 2205,
+    890, 342, 354, 1860, 2280, 1618, 1042, 1196, 2394, 637,
+    2334, 250,
+};
+
+static const int16_t icase_name_hash_displacements[] = {
+    0, -3, 0, 0, 5, 0, 0, 0, -4, 0,
+    1, 4, -5, 2, -17, -18, -19, 0, 0, 0,
+    -22, -27, 0, 0, 0, -29, -32, 0, 0, -39,
+    0, 0, -46, -48, 0, 0, -50, 0, 0, 1,
+    0, 0, 0, -53, -54, 0, 0, -55, 0, 0,
+    0, 0, -56, 0, 0, 0, 1, -58, 0, 0,
+    3, -61, 0, 0, -62, 0, 0, 0, -67, 0,
+    0, -68, -70, 0, 0, 0, 0, -71, 1, -74,
+    -80, -82, 0, 0, 0, 1, 1, -89, -91, 1,
+    -93, 0, 2, 0, -94, 4, 0, 0, -98, 1,
+    0, 0, 0, 0, 1, 0, -101, 0, 1, 0,
+    -102, 1, -103, -104, 0, 1, 0, 1, 3, -105,
+    -110, 0, -115, 0, -116, 0, -117, -118, -119, 0,
+    0, 2, 0, 1, 0, -123, -131, 0, 1, -138,
+    0, 0, 0, 0, -140, -146, -150, 0, 0, -154,
+    0, 0, -155, 0, -159, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, -160, 2, 0, 0, 0,
+    0, 0, 0, 1, -162, 0, -163, 0, 0, 0,
+    0, -165, 1, -167, 0, 0, 0, -168, -172, 1,
+    0, -174, 0, 0, 0, 1, -177, 0, 0, 0,
+    4, -180, 0, 0, 0, 2, -182, -185, 0, 0,
+    -186, 0, 1, -187, -188, -189, 0, -190, -192, 2,
+    0, 0, 1, 0, 0, -194, -195, -196, 0, 0,
+    0, -197, 0, 0, 0, -202, -204, 0, -206, -210,
+    -212, 0, 0, 2, -220, -223, 0, -226, -229, -231,
+    -232, -235, 0, 0, 0, 1, 0, 0, 0, -238,
+    0, -239, -243, 0, -245, -248, -255, 0, 0, -258,
+    0, -261, 0, 0, 0, -265, 2, -266, -271, 3,
+    0, -275, -287, 0, 3, 0, 0, 0, 1, -288,
+    0, 0, 0, 0, 0, -290, -291, -292, 2, -293,
+    2, 0, 0, 0, -299, 0, -306, -311, 0, 0,
+    -312, -313, -314, -317, -318, -322, -332, 0, 0, 0,
+    -334, 0, -339, 2, -341, 0, 0, -345, 0, 0,
+    -346, 0, 0, -348, 0, 0, 0, -349, 0, 0,
+    0, -350, 0, 0, -351, 0, 1, -356, -362, -367,
+    0, 2, 0, -368, -369, -371, 0, -372, 0, -374,
+    0, 1, 2, 0, 0, -377, 0, 0, 0, 1,
+    0, 0, -382, 0, 0, -384, -385, 0, 0, 0,
+    -392, 0, -395, 2, 0, -399, -401, -403, -404, 1,
+    -406, 0, 0, 0, 0, 0, 0, 0, -410, 0,
+    0, -416, 0, 0, -421, 1, 1, -427, 0, 0,
+    0, 0, 0, 0, -429, -430, 0, -431, 0, 2,
+    -434, -438, -444, 2, 0, -446, 0, -448, 0, -450,
+    3, 0, -452, 0, 0, 0, -456, 0, 1, -460,
+    -462, 0, 0, 0, 1, 2, -465, 0, 0, 0,
+    0, -467, -468, 0, -472, 0, 0, 0, 3, 1,
+    0, 0, 0, -475, 0, -482, 0, 0, 0, 0,
+    -486, 1, -489, 0, 0, -492, 0, 0, -493, -499,
+    0, -510, -517, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, -518, -519, -521, 1, 6, 0, 1,
+    -526, 0, 0, 0, 0, 0, 0, -530, 3, -531,
+    0, 0, -534, 0, 0, -538, 0, 1, 0, 0,
+    0, -541, 0, 6, 0, -545, 2, 0, 0, 0,
+    0, 0, 0, -549, -550, 0, 0, -552, 1, 2,
+    -555, -556, -557, 0, 0, -558, 0, 0, 0, -561,
+    -562, 0, 0, 3, 0, -565, 0, 0, 1, 0,
+    0, -567, -568, 0, -572, 0, -578, 0, 0, -579,
+    0, 0, 0, -582, -584, 1, 1, 0, 0, 0,
+    -588, 0, 0, -599, 0, 0, -600, 0, 8, 0,
+    0, 0, 0, 0, 4, -606, -608, 0, 0, -614,
+    -617, -620, 0, -624, -625, 0, -627, -630, 0, 0,
+    -635, 0, -641, 0, -645, 0, 0, 2, -648, -654,
+    0, 0, -655, 0, 0, 0, -657, 0, 0, -661,
+    0, -663, 0, -664, -665, -668, 0, -670, 0, 0,
+    -672, 2, -676, 0, -681, 0, 0, -682, -686, -687,
+    2, 0, 2, -689, -690, 0, 1, 0, -691, -692,
+    0, 1, 0, -693, 0, 0, 3, -699, 0, 0,
+    0, 0, -702, 0, -703, 0, 0, -704, 0, 0,
+    0, 1, 0, 0, 0, -706, 0, -707, -710, 0,
+    0, 0, 0, 0, 0, 0, -713, -716, 0, 0,
+    -718, 2, 1, -721, 0, -727, 0, -728, -730, -733,
+    -737, -740, -741, 0, 0, 7, 0, 0, 0, -743,
+    1, 0, 0, 1, 1, -745, -749, 0, 0, -753,
+    -757, 8, 1, -759, -761, 0, 0, 0, 0, 0,
+    -762, -763, -764, 0, -768, 0, 0, -769, 0, -772,
+    -774, 0, 0, -778, 0, 1, 0, -779, 0, 0,
+    0, 1, 0, 1, 0, -782, 0, -786, -790, 0,
+    0, -792, 0, 0, 0, 0, 0, 0, 0, -797,
+    -801, 0, 0, 0, 0, 0, -802, -804, 0, 0,
+    0, -806, 0, -809, 9, 1, -813, 5, -816, 0,
+    -818, -820, 0, -827, -833, 0, -834, 0, 0, -839,
+    1, 0, 0, -840, 0, -841, 0, -842, 0, -845,
+    -852, -855, 0, 1, -859, 4, 0, 0, -860, 0,
+    0, 0, -864, 0, 6, -867, -868, -870, 0, 0,
+    -872, -874, 0, -877, 0, -883, 0, -884, 0, 6,
+    0, 0, 5, -885, 4, 0, 0, 0, 0, 0,
+    1, 0, -887, 0, 1, -889, 0, 0, -892, 0,
+    0, -897, 0, -899, -902, 0, -905, 0, 0, -906,
+    1, 0, 1, 1, 0, -907, 0, 1, 0, 0,
+    -908, -910, 0, 0, -911, 0, 0, -919, 1, 0,
+    -923, 1, -926, 0, 0, -928, -929, 6, 0, 0,
+    0, -930, 0, -933, 0, -934, 0, 0, 8, 0,
+    -935, 0, 0, -937, 0, -939, -941, -943, 0, -945,
+    -946, 10, 0, -948, 1, -950, -951, 0, 0, 0,
+    -952, 0, -954, 0, 0, 0, -957, -960, -962, 0,
+    0, 0, 0, -963, 0, 1, -965, 0, 0, 0,
+    -967, 0, 3, -973, 0, 0, 0, 4, 0, -979,
+    0, -980, -981, 0, -982, 0, 1, 0, -983, -986,
+    1, -987, -989, 3, 0, 3, 2, -992, 1, -995,
+    0, 0, 0, 1, 0, 5, 0, 5, 0, 0,
+    -997, 0, 2, -998, 0, 0, 0, 0, 0, -999,
+    -1000, -1003, 1, -1006, 0, -1007, -1009, -1010, -1011, 0,
+    0, 0, 4, 1, 2, -1015, -1016, -1027, -1029, -1031,
+    -1032, 2, -1033, 0, 0, 0, -1038, 0, 0, 0,
+    0, 0, 1, 0, 0, -1039, 0, 1, 0, 0,
+    -1041, 0, -1043, 4, 0, 0, -1046, -1050, -1052, 0,
+    -1057, 0, -1058, 0, -1060, 0, -1066, -1068, 0, 0,
+    0, 0, -1070, -1076, -1081, 0, -1083, 0, 0, 0,
+    0, -1086, -1088, 0, 0, 0, -1092, 2, 4, -1096,
+    0, 0, 0, -1097, 1, -1101, -1102, -1104, 0, -1105,
+    -1112, -1113, 1, -1114, 0, 0, 2, 7, 2, 0,
+    -1115, -1119, -1120, 0, -1121, 0, 4, 1, 7, 0,
+    0, -1122, 0, 6, -1125, -1126, 0, 0, -1129, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, -1130,
+    -1133, 1, 0, 0, 0, 0, 3, -1134, 0, 0,
+    -1140, 0, -1142, 0, -1147, 0, 0, 0, -1149, 0,
+    -1153, 0, 1, -1154, 1, 0, -1160, 0, -1162, 2,
+    0, 1, -1170, -1171, -1172, 0, -1174, -1176, -1177, -1183,
+    -1188, -1191, 0, -1193, -1195, 7, 0, 0, 0, 0,
+    -1197, 0, -1203, 2, 0, 0, 0, 4, 0, 0,
+    0, 0, 1, -1206, -1209, 0, -1210, -1214, 0, -1215,
+    1, -1216, -1217, 1, 0, -1219, 0, 0, 0, 0,
+    1, 1, 0, 2, 0, 11, 0, 0, 0, 0,
+    0, 0, -1220, 0, -1221, 0, 1, 0, 0, -1225,
+    1, -1228, 2, -1233, 7, 0, 0, -1235, 1, -1236,
+    -1240, 3, 0, -1243, 0, -1244, 0, 3, -1245, -1255,
+    0, 0, 3, 0, 0, 0, -1256, -1257, 3, 0,
+    -1259, -1260, -1263, -1264, 0, -1265, -1267, 0, 0, 0,
+    -1269, 0, -1271, 0, 0, 3, -1273, 0, 2, 3,
+    0, 0, 0, 2, 0, -1277, 0, 0, -1281, 0,
+    0, -1284, 0, 0, 0, 0, 2, 0, 0, 0,
+    -1286, -1287, -1290, 0, 0, 0, 0, -1291, -1293, 5,
+    0, -1298, 0, -1300, -1309, 6, -1315, -1318, -1331, 0,
+    -1334, -1335, -1337, -1338, -1342, 0, 0, 2, -1343, 0,
+    2, 2, 0, 0, 0, 3, 0, -1349, -1350, -1356,
+    3, 0, -1358, 0, 0, -1359, 0, 0, -1360, -1364,
+    0, -1368, 0, 5, 0, 0, -1372, -1373, -1377, -1378,
+    -1380, 5, -1382, 2, 1, -1383, -1387, -1389, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 2, -1390, -1391,
+    2, -1392, 0, -1394, 3, 4, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, -1399, 0, 0, 0,
+    0, 0, -1402, -1405, -1411, -1414, -1416, 0, -1418, 1,
+    0, 0, 0, 1, -1425, 0, -1426, -1433, 0, -1434,
+    0, 0, 0, 0, 0, -1440, 0, -1441, 0, -1442,
+    0, -1443, 0, 0, 15, 0, -1446, 0, -1447, -1449,
+    -1453, 0, 0, -1457, 0, 1, 0, -1459, -1462, -1463,
+    0, 3, 0, 0, 0, -1466, 0, -1468, 7, -1469,
+    0, 0, 0, -1470, 0, 2, 0, 0, 0, -1476,
+    0, -1480, 0, 1, 0, 0, -1485, -1490, -1491, 24,
+    -1492, -1496, 0, 0, 0, 0, 0, 0, -1500, 5,
+    4, -1502, -1510, 0, 3, -1512, -1516, 0, 0, 1,
+    2, 0, -1517, 12, 0, -1518, -1521, 0, 0, 0,
+    5, 0, -1525, 1, 0, -1526, 5, 0, -1528, 0,
+    2, -1529, 0, -1536, 0, 3, 0, 0, 0, 2,
+    0, 1, 0, 5, 2, 0, -1541, 1, 5, -1545,
+    -1548, -1551, 0, -1555, -1556, -1557, -1559, 0, 0, -1566,
+    -1567, -1569, -1570, 0, -1573, 0, -1575, 4, 7, 0,
+    0, 0, 0, -1576, 0, 1, 3, 0, 3, -1577,
+    2, 7, -1578, 0, -1579, 0, 0, 0, -1584, 1,
+    0, 0, 4, -1587, 0, 0, -1588, 0, 0, -1590,
+    -1591, 0, 0, -1593, -1595, -1601, -1602, -1604, -1605, 0,
+    -1606, 0, 2, 0, -1608, -1610, -1618, -1626, 1, -1628,
+    4, 0, 18, 3, 0, -1629, -1631, -1637, -1638, -1641,
+    -1645, -1647, -1652, 0, -1656, -1660, -1662, 0, 0, -1663,
+    0, 11, -1665, 0, 0, 0, -1668, -1671, -1672, 0,
+    0, 3, -1673, -1678, -1680, 0, 1, -1681, 9, -1685,
+    0, 0, 5, 0, 0, 0, 0, 8, -1690, -1691,
+    -1700, 0, 0, -1702, 0, 0, 0, 0, 7, -1703,
+    -1705, 0, 11, 0, -1706, 0, 0, 0, 1, -1707,
+    0, 0, 0, -1710, -1711, 1, 0, -1713, -1715, 0,
+    0, 5, 8, 0, -1717, 4, -1718, 0, 0, 0,
+    -1724, -1725, 0, 0, -1726, 8, 0, 0, 0, 0,
+    0, 1, -1728, -1731, -1733, 0, -1735, -1739, -1746, 0,
+    -1747, -1749, 0, 0, 0, 10, 0, 0, 0, 17,
+    -1750, 2, 0, -1753, 0, 11, -1756, 0, 0, 2,
+    0, -1757, 0, 0, -1759, 6, 0, 0, -1762, -1763,
+    1, 0, -1767, -1769, -1771, 0, 0, -1773, 0, -1779,
+    0, 0, -1781, -1783, 2, 0, -1784, -1785, 0, -1788,
+    -1789, 5, -1794, 0, 0, 0, 0, -1795, -1796, -1797,
+    -1801, 10, -1808, 0, 0, -1809, -1810, 0, -1811, 0,
+    1, -1816, 4, -1817, 0, 1, -1818, -1819, -1824, 0,
+    13, 0, 0, 0, 0, 0, 27, -1825, 0, 5,
+    -1826, -1827, 1, -1828, -1831, -1832, -1833, 0, -1836, 1,
+    -1840, 0, 14, -1847, -1849, -1851, 2, 0, 0, 0,
+    0, 0, -1854, 0, -1859, 3, 1, 0, -1860, -1862,
+    0, -1865, -1866, 0, -1868, 8, 0, -1871, 0, 8,
+    0, -1875, 0, 2, 0, 0, 0, -1880, -1883, -1884,
+    8, 5, 0, 5, 0, 0, 0, 0, 0, 1,
+    0, 5, -1885, -1889, 0, -1891, 0, -1897, 0, 0,
+    9, -1898, 1, -1902, 10, -1913, 0, 0, 0, 0,
+    0, 14, 2, -1917, -1918, -1921, 0, -1922, -1923, 0,
+    -1927, 4, -1929, -1930, 30, 0, -1937, -1938, 0, 0,
+    0, 0, -1939, 13, 11, 9, 0, -1943, 0, -1944,
+    13, 0, -1946, 25, 0, 0, 6, -1947, 0, 2,
+    0, 0, -1948, -1953, 0, 0, 10, 1, -1958, 0,
+    15, -1959, -1965, -1967, 0, -1971, 0, -1972, -1973, 0,
+    0, 6, 0, -1974, 0, 0, -1976, 0, -1977, 15,
+    -1980, -1981, 6, -1985, 0, -1986, 0, 0, 0, 0,
+    0, -1987, -1990, -1991, 0, 0, -1996, 0, 0, -1997,
+    -2001, 3, -2002, 0, 2, -2009, 6, -2013, 6, -2016,
+    0, 10, 0, 0, 0, -2019, 0, 0, 0, 0,
+    0, -2021, 0, 0, 0, 0, 0, -2029, 8, 0,
+    0, 0, -2031, 0, 9, -2033, -2035, 2, 0, 1,
+    0, -2036, 0, 0, 1, 0, -2040, 0, -2044, -2045,
+    0, 5, 27, 2, -2047, 0, 0, -2051, 0, 0,
+    -2056, -2057, 0, 6, 4, -2058, 2, 0, -2060, 2,
+};
+
+struct icase_name_range {
+    uint16_t first;
+    uint16_t count;
+};
+
+static const struct icase_name_range icase_name_hash_entries[] = {
+    { 1695, 1 }, /* overbar */
+    { 1898, 1 }, /* sinh_mba */
+    { 2275, 1 }, /* xf86mailforward */
+    { 674, 2 }, /* cyrillic_o */
+    { 205, 2 }, /* armenian_ini */
+    { 1451, 1 }, /* kp_divide */
+    { 1971, 1 }, /* sunundo */
+    { 1843, 1 }, /* sevensuperior */
+    { 328, 1 }, /* braille_dots_1235 */
+    { 537, 1 }, /* braille_dots_45678 */
+    { 712, 2 }, /* cyrillic_ze */
+    { 280, 1 }, /* because */
+    { 366, 1 }, /* braille_dots_1258 */
+    { 1901, 1 }, /* sinh_ndha */
+    { 879, 2 }, /* ezh */
+    { 1658, 1 }, /* osfclear */
+    { 1923, 1 }, /* sinh_thha */
+    { 519, 1 }, /* braille_dots_356 */
+    { 38, 1 }, /* 8 */
+    { 229, 1 }, /* armenian_question */
+    { 324, 1 }, /* braille_dots_123468 */
+    { 1310, 2 }, /* iogonek */
+    { 304, 1 }, /* braille_dot_5 */
+    { 2147, 2 }, /* ukranian_yi */
+    { 1981, 1 }, /* tab */
+    { 7, 1 }, /* 3270_changescreen */
+    { 716, 2 }, /* cyrillic_zhe_descender */
+    { 1, 1 }, /* 1 */
+    { 970, 1 }, /* georgian_en */
+    { 416, 1 }, /* braille_dots_1467 */
+    { 195, 1 }, /* armenian_full_stop */
+    { 2395, 1 }, /* zen_koho */
+    { 1932, 1 }, /* sixsubscript */
+    { 183, 1 }, /* armenian_but */
+    { 909, 1 }, /* f33 */
+    { 1443, 1 }, /* kp_7 */
+    { 1336, 1 }, /* iso_lock */
+    { 1691, 2 }, /* oslash */
+    { 853, 1 }, /* emptyset */
+    { 2329, 1 }, /* xf86suspend */
+    { 646, 2 }, /* cyrillic_ghe_bar */
+    { 2162, 1 }, /* upshoe */
+    { 1201, 1 }, /* hebrew_dalet */
+    { 1145, 1 }, /* hangul_o */
+    { 2372, 2 }, /* yacute */
+    { 1724, 1 }, /* pointer_button5 */
+    { 446, 1 }, /* braille_dots_234578 */
+    { 1535, 1 }, /* malesymbol */
+    { 1582, 1 }, /* notidentical */
+    { 1632, 2 }, /* ohorntilde */
+    { 2046, 1 }, /* thai_saraaa */
+    { 1706, 1 }, /* parenleft */
+    { 1537, 1 }, /* marker */
+    { 1550, 1 }, /* muhenkan */
+    { 2363, 1 }, /* xf86wlan */
+    { 1283, 2 }, /* ibelowdot */
+    { 823, 2 }, /* ecircumflexbelowdot */
+    { 1168, 1 }, /* hangul_ssangjieuj */
+    { 345, 1 }, /* braille_dots_12456 */
+    { 1945, 1 }, /* sunaudiolowervolume */
+    { 781, 1 }, /* decimalpoint */
+    { 900, 1 }, /* f25 */
+    { 1626, 2 }, /* ohornbelowdot */
+    { 1806, 1 }, /* romaji */
+    { 634, 2 }, /* cyrillic_em */
+    { 2359, 1 }, /* xf86view */
+    { 2237, 1 }, /* xf86explorer */
+    { 177, 2 }, /* armenian_at */
+    { 1135, 1 }, /* hangul_jieuj */
+    { 2117, 2 }, /* udoubleacute */
+    { 2318, 1 }, /* xf86select */
+    { 2186, 2 }, /* wgrave */
+    { 1276, 1 }, /* hyper_r */
+    { 2102, 1 }, /* twosubscript */
+    { 1742, 1 }, /* pointer_drag_dflt */
+    { 2205, 1 }, /* xf86audioprev */
+    { 932, 1 }, /* ff */
+    { 999, 1 }, /* georgian_xan */
+    { 1620, 2 }, /* ohook */
+    { 2322, 1 }, /* xf86spell */
+    { 1453, 1 }, /* kp_end */
+    { 561, 1 }, /* braille_dots_7 */
+    { 278, 1 }, /* ballotcross */
+    { 431, 1 }, /* braille_dots_167 */
+    { 1129, 1 }, /* hangul_j_ssangkiyeog */
+    { 489, 1 }, /* braille_dots_25678 */
+    { 1597, 2 }, /* ocaron */
+    { 728, 1 }, /* ddiaeresis */
+    { 1792, 1 }, /* return */
+    { 595, 1 }, /* checkmark */
+    { 2073, 1 }, /* thai_yoyak */
+    { 2229, 1 }, /* xf86copy */
+    { 315, 1 }, /* braille_dots_1234567 */
+    { 989, 1 }, /* georgian_phar */
+    { 1107, 1 }, /* hangul_j_jieuj */
+    { 1454, 1 }, /* kp_enter */
+    { 402, 1 }, /* braille_dots_1368 */
+    { 2101, 1 }, /* twofifths */
+    { 65, 2 }, /* acircumflexbelowdot */
+    { 928, 1 }, /* farsi_8 */
+    { 1149, 1 }, /* hangul_pieub */
+    { 112, 1 }, /* arabic_farsi_yeh */
+    { 395, 1 }, /* braille_dots_13568 */
+    { 2176, 1 }, /* voidsymbol */
+    { 1450, 1 }, /* kp_delete */
+    { 913, 1 }, /* f5 */
+    { 2195, 1 }, /* xf86applicationright */
+    { 759, 1 }, /* dead_greek */
+    { 152, 1 }, /* arabic_semicolon */
+    { 1425, 2 }, /* kana_yo */
+    { 352, 1 }, /* braille_dots_1246 */
+    { 804, 1 }, /* dremove */
+    { 439, 1 }, /* braille_dots_234 */
+    { 1849, 1 }, /* similarequal */
+    { 1345, 1 }, /* iso_prev_group */
+    { 1056, 2 }, /* greek_pi */
+    { 164, 1 }, /* arabic_theh */
+    { 1130, 1 }, /* hangul_j_ssangsios */
+    { 1393, 1 }, /* kana_ni */
+    { 660, 2 }, /* cyrillic_io */
+    { 1982, 2 }, /* tabovedot */
+    { 1455, 1 }, /* kp_equal */
+    { 1855, 1 }, /* sinh_ae */
+    { 1334, 1 }, /* iso_level5_lock */
+    { 478, 1 }, /* braille_dots_2458 */
+    { 142, 1 }, /* arabic_noon */
+    { 2312, 1 }, /* xf86save */
+    { 2039, 1 }, /* thai_phophan */
+    { 827, 2 }, /* ecircumflexhook */
+    { 1510, 1 }, /* less */
+    { 1918, 1 }, /* sinh_ruu2 */
+    { 1776, 1 }, /* r5 */
+    { 762, 2 }, /* dead_i */
+    { 1501, 1 }, /* leftdoublequotemark */
+    { 40, 2 }, /* a */
+    { 1899, 1 }, /* sinh_na */
+    { 2085, 1 }, /* tintegral */
+    { 2257, 1 }, /* xf86launch3 */
+    { 2214, 1 }, /* xf86backforward */
+    { 1685, 1 }, /* osfrestore */
+    { 785, 1 }, /* deleteline */
+    { 1835, 2 }, /* serbian_lje */
+    { 1888, 1 }, /* sinh_ka */
+    { 2330, 1 }, /* xf86switch_vt_1 */
+    { 1139, 1 }, /* hangul_kkogjidalrinieung */
+    { 1569, 2 }, /* ncedilla */
+    { 2236, 1 }, /* xf86excel */
+    { 1372, 1 }, /* kana_he */
+    { 2206, 1 }, /* xf86audioraisevolume */
+    { 1942, 1 }, /* stricteq */
+    { 405, 1 }, /* braille_dots_138 */
+    { 407, 1 }, /* braille_dots_145 */
+    { 1754, 1 }, /* prolongedsound */
+    { 1189, 1 }, /* hangul_yi */
+    { 1681, 1 }, /* osfprevmenu */
+    { 60, 1 }, /* accessx_feedback_enable */
+    { 1549, 1 }, /* mu */
+    { 848, 1 }, /* emdash */
+    { 1280, 1 }, /* iabovedot */
+    { 1229, 1 }, /* hebrew_teth */
+    { 845, 1 }, /* em4space */
+    { 170, 1 }, /* arabic_zah */
+    { 162, 1 }, /* arabic_tehmarbuta */
+    { 1216, 1 }, /* hebrew_lamed */
+    { 360, 1 }, /* braille_dots_1256 */
+    { 1134, 1 }, /* hangul_jeonja */
+    { 1867, 1 }, /* sinh_cha */
+    { 700, 2 }, /* cyrillic_u_straight */
+    { 614, 2 }, /* cyrillic_a */
+    { 1313, 1 }, /* iso_continuous_underline */
+    { 2023, 1 }, /* thai_maichattawa */
+    { 1808, 2 }, /* s */
+    { 136, 1 }, /* arabic_keheh */
+    { 624, 2 }, /* cyrillic_de */
+    { 1155, 1 }, /* hangul_rieulhieuh */
+    { 535, 1 }, /* braille_dots_456 */
+    { 1449, 1 }, /* kp_decimal */
+    { 378, 1 }, /* braille_dots_134567 */
+    { 350, 1 }, /* braille_dots_124578 */
+    { 971, 1 }, /* georgian_fi */
+    { 1172, 1 }, /* hangul_start */
+    { 1222, 1 }, /* hebrew_samech */
+    { 1185, 1 }, /* hangul_yae */
+    { 1386, 1 }, /* kana_mi */
+    { 1652, 1 }, /* osfaddmode */
+    { 751, 1 }, /* dead_currency */
+    { 100, 1 }, /* arabic_8 */
+    { 644, 2 }, /* cyrillic_ghe */
+    { 1484, 1 }, /* l7 */
+    { 566, 1 }, /* brokenbar */
+    { 1778, 1 }, /* r7 */
+    { 735, 1 }, /* dead_aboveverticalline */
+    { 743, 1 }, /* dead_belowring */
+    { 92, 1 }, /* arabic_0 */
+    { 1223, 1 }, /* hebrew_samekh */
+    { 1228, 1 }, /* hebrew_tet */
+    { 1445, 1 }, /* kp_9 */
+    { 1351, 1 }, /* iso_set_margin_right */
+    { 1618, 2 }, /* ograve */
+    { 354, 1 }, /* braille_dots_124678 */
+    { 319, 1 }, /* braille_dots_1234578 */
+    { 202, 2 }, /* armenian_ho */
+    { 2044, 1 }, /* thai_ru */
+    { 1296, 2 }, /* ihook */
+    { 8, 1 }, /* 3270_copy */
+    { 2154, 1 }, /* union */
+    { 1197, 1 }, /* hebrew_ayin */
+    { 1746, 1 }, /* pointer_up */
+    { 931, 1 }, /* femalesymbol */
+    { 119, 1 }, /* arabic_ha */
+    { 227, 2 }, /* armenian_pyur */
+    { 2067, 1 }, /* thai_thothan */
+    { 965, 1 }, /* georgian_can */
+    { 1407, 1 }, /* kana_shift */
+    { 1972, 1 }, /* sunvideodegauss */
+    { 356, 1 }, /* braille_dots_1247 */
+    { 581, 1 }, /* caret */
+    { 2366, 1 }, /* xf86xfer */
+    { 1655, 1 }, /* osfbegindata */
+    { 114, 1 }, /* arabic_fathatan */
+    { 1539, 1 }, /* massyo */
+    { 1762, 1 }, /* quoteleft */
+    { 353, 1 }, /* braille_dots_12467 */
+    { 1006, 2 }, /* greek_alpha */
+    { 1781, 2 }, /* racute */
+    { 2288, 1 }, /* xf86new */
+    { 905, 1 }, /* f3 */
+    { 2099, 2 }, /* tslash */
+    { 1421, 1 }, /* kana_wa */
+    { 1422, 1 }, /* kana_wo */
+    { 438, 1 }, /* braille_dots_23 */
+    { 1707, 1 }, /* parenright */
+    { 1207, 1 }, /* hebrew_finalpe */
+    { 36, 1 }, /* 6 */
+    { 2007, 1 }, /* thai_khorakhang */
+    { 1533, 1 }, /* macron */
+    { 111, 1 }, /* arabic_ddal */
+    { 2266, 1 }, /* xf86launchc */
+    { 302, 1 }, /* braille_dot_3 */
+    { 351, 1 }, /* braille_dots_12458 */
+    { 1208, 1 }, /* hebrew_finalzade */
+    { 951, 2 }, /* g */
+    { 720, 2 }, /* dabovedot */
+    { 1400, 1 }, /* kana_re */
+    { 1261, 1 }, /* hpmodelock1 */
+    { 1126, 1 }, /* hangul_j_rieulsios */
+    { 1862, 1 }, /* sinh_au */
+    { 1249, 1 }, /* hpbacktab */
+    { 1684, 1 }, /* osfreselect */
+    { 2315, 1 }, /* xf86scrolldown */
+    { 2253, 1 }, /* xf86kbdlightonoff */
+    { 1587, 1 }, /* numbersign */
+    { 2084, 1 }, /* threesuperior */
+    { 1226, 1 }, /* hebrew_taf */
+    { 492, 1 }, /* braille_dots_2578 */
+    { 99, 1 }, /* arabic_7 */
+    { 798, 1 }, /* down */
+    { 1761, 1 }, /* quotedbl */
+    { 1257, 1 }, /* hpio */
+    { 151, 1 }, /* arabic_seen */
+    { 523, 1 }, /* braille_dots_357 */
+    { 1914, 1 }, /* sinh_ra */
+    { 463, 1 }, /* braille_dots_236 */
+    { 1663, 1 }, /* osfdown */
+    { 555, 1 }, /* braille_dots_578 */
+    { 1173, 1 }, /* hangul_sunkyeongeummieum */
+    { 1925, 1 }, /* sinh_ttha */
+    { 331, 1 }, /* braille_dots_1235678 */
+    { 1179, 1 }, /* hangul_wa */
+    { 1241, 1 }, /* hiragana_katakana */
+    { 978, 1 }, /* georgian_hoe */
+    { 2280, 1 }, /* xf86menupb */
+    { 1999, 1 }, /* thai_fofa */
+    { 1046, 2 }, /* greek_omega */
+    { 1850, 1 }, /* singlecandidate */
+    { 132, 1 }, /* arabic_jeh */
+    { 543, 1 }, /* braille_dots_467 */
+    { 1309, 1 }, /* io */
+    { 1716, 1 }, /* phonographcopyright */
+    { 1584, 2 }, /* ntilde */
+    { 672, 2 }, /* cyrillic_nje */
+    { 603, 1 }, /* comma */
+    { 589, 1 }, /* cedilla */
+    { 935, 1 }, /* filledlefttribullet */
+    { 1891, 1 }, /* sinh_la */
+    { 1375, 1 }, /* kana_hu */
+    { 161, 1 }, /* arabic_teh */
+    { 1767, 1 }, /* r10 */
+    { 244, 2 }, /* armenian_tsa */
+    { 1220, 1 }, /* hebrew_qoph */
+    { 1073, 1 }, /* greek_upsilonaccentdieresis */
+    { 800, 1 }, /* downcaret */
+    { 1924, 1 }, /* sinh_tta */
+    { 1567, 2 }, /* ncaron */
+    { 437, 1 }, /* braille_dots_2 */
+    { 2284, 1 }, /* xf86monbrightnessup */
+    { 237, 2 }, /* armenian_sha */
+    { 2024, 1 }, /* thai_maiek */
+    { 2200, 1 }, /* xf86audiomicmute */
+    { 1915, 1 }, /* sinh_ri */
+    { 1505, 1 }, /* leftradical */
+    { 1087, 1 }, /* hangul_a */
+    { 1478, 1 }, /* l10 */
+    { 312, 1 }, /* braille_dots_1234 */
+    { 547, 1 }, /* braille_dots_478 */
+    { 601, 1 }, /* colon */
+    { 275, 1 }, /* backslash */
+    { 1967, 1 }, /* sunprint_screen */
+    { 1926, 1 }, /* sinh_u */
+    { 2184, 2 }, /* wdiaeresis */
+    { 230, 2 }, /* armenian_ra */
+    { 1664, 1 }, /* osfenddata */
+    { 1457, 1 }, /* kp_f2 */
+    { 1693, 2 }, /* otilde */
+    { 540, 1 }, /* braille_dots_4578 */
+    { 1740, 1 }, /* pointer_drag4 */
+    { 240, 2 }, /* armenian_tche */
+    { 1790, 1 }, /* repeatkeys_enable */
+    { 37, 1 }, /* 7 */
+    { 1104, 1 }, /* hangul_j_dikeud */
+    { 1657, 1 }, /* osfcancel */
+    { 821, 2 }, /* ecircumflexacute */
+    { 1731, 1 }, /* pointer_dblclick_dflt */
+    { 2175, 1 }, /* voicedsound */
+    { 2139, 2 }, /* ukrainian_ie */
+    { 1304, 1 }, /* insert */
+    { 1337, 1 }, /* iso_move_line_down */
+    { 1995, 1 }, /* thai_choching */
+    { 2245, 1 }, /* xf86green */
+    { 1302, 1 }, /* includes */
+    { 436, 1 }, /* braille_dots_18 */
+    { 1071, 2 }, /* greek_upsilonaccent */
+    { 1074, 2 }, /* greek_upsilondieresis */
+    { 899, 1 }, /* f24 */
+    { 784, 1 }, /* deletechar */
+    { 752, 1 }, /* dead_dasia */
+    { 1799, 1 }, /* rightmiddlesummation */
+    { 1165, 1 }, /* hangul_sios */
+    { 2004, 1 }, /* thai_khokhon */
+    { 251, 2 }, /* armenian_vev */
+    { 385, 1 }, /* braille_dots_13467 */
+    { 1140, 1 }, /* hangul_mieum */
+    { 74, 2 }, /* adiaeresis */
+    { 618, 2 }, /* cyrillic_che */
+    { 1363, 1 }, /* kana_chi */
+    { 684, 2 }, /* cyrillic_shcha */
+    { 1732, 1 }, /* pointer_dfltbtnnext */
+    { 2204, 1 }, /* xf86audioplay */
+    { 1509, 1 }, /* lefttack */
+    { 1789, 1 }, /* registered */
+    { 236, 1 }, /* armenian_separation_mark */
+    { 1493, 2 }, /* lcaron */
+    { 1504, 1 }, /* leftpointer */
+    { 1369, 1 }, /* kana_fu */
+    { 2035, 1 }, /* thai_nonu */
+    { 2234, 1 }, /* xf86dos */
+    { 406, 1 }, /* braille_dots_14 */
+    { 363, 1 }, /* braille_dots_12568 */
+    { 155, 1 }, /* arabic_sukun */
+    { 1036, 2 }, /* greek_kappa */
+    { 2259, 1 }, /* xf86launch5 */
+    { 911, 1 }, /* f35 */
+    { 123, 1 }, /* arabic_hamza_below */
+    { 469, 1 }, /* braille_dots_238 */
+    { 498, 1 }, /* braille_dots_27 */
+    { 1788, 1 }, /* redo */
+    { 1667, 1 }, /* osfextend */
+    { 825, 2 }, /* ecircumflexgrave */
+    { 1094, 1 }, /* hangul_dikeud */
+    { 1489, 1 }, /* last_virtual_screen */
+    { 455, 1 }, /* braille_dots_235 */
+    { 1794, 1 }, /* rightanglebracket */
+    { 565, 1 }, /* breve */
+    { 1877, 1 }, /* sinh_ga */
+    { 1736, 1 }, /* pointer_downright */
+    { 1463, 1 }, /* kp_multiply */
+    { 1674, 1 }, /* osfnextmenu */
+    { 1125, 1 }, /* hangul_j_rieulpieub */
+    { 265, 1 }, /* asciitilde */
+    { 1572, 1 }, /* next */
+    { 1933, 1 }, /* sixsuperior */
+    { 2143, 2 }, /* ukranian_i */
+    { 1227, 1 }, /* hebrew_taw */
+    { 692, 2 }, /* cyrillic_te */
+    { 2249, 1 }, /* xf86hotlinks */
+    { 1403, 1 }, /* kana_ru */
+    { 2071, 1 }, /* thai_totao */
+    { 1583, 1 }, /* notsign */
+    { 571, 3 }, /* c_h */
+    { 2345, 1 }, /* xf86todolist */
+    { 451, 1 }, /* braille_dots_23468 */
+    { 393, 1 }, /* braille_dots_13567 */
+    { 71, 2 }, /* acircumflextilde */
+    { 1613, 2 }, /* odoubleacute */
+    { 2133, 2 }, /* uhorntilde */
+    { 1991, 1 }, /* thai_baht */
+    { 2243, 1 }, /* xf86game */
+    { 1749, 1 }, /* prescription */
+    { 1250, 1 }, /* hpblock */
+    { 914, 1 }, /* f6 */
+    { 787, 1 }, /* diaeresis */
+    { 215, 1 }, /* armenian_ligature_ew */
+    { 291, 1 }, /* bott */
+    { 1797, 1 }, /* rightdoublequotemark */
+    { 740, 1 }, /* dead_belowdiaeresis */
+    { 1200, 1 }, /* hebrew_chet */
+    { 2060, 1 }, /* thai_sosala */
+    { 874, 1 }, /* exclam */
+    { 2378, 2 }, /* ydiaeresis */
+    { 1517, 1 }, /* logicalor */
+    { 2145, 2 }, /* ukranian_je */
+    { 1650, 1 }, /* ordfeminine */
+    { 1935, 1 }, /* slowkeys_enable */
+    { 1081, 1 }, /* guillemotleft */
+    { 1091, 1 }, /* hangul_banja */
+    { 1560, 1 }, /* mute_grave */
+    { 326, 1 }, /* braille_dots_123478 */
+    { 696, 2 }, /* cyrillic_u */
+    { 1078, 2 }, /* greek_zeta */
+    { 497, 1 }, /* braille_dots_268 */
+    { 2289, 1 }, /* xf86news */
+    { 2349, 1 }, /* xf86touchpadon */
+    { 1067, 2 }, /* greek_theta */
+    { 1240, 1 }, /* hiragana */
+    { 1689, 1 }, /* osfundo */
+    { 1703, 1 }, /* page_down */
+    { 2287, 1 }, /* xf86mysites */
+    { 90, 1 }, /* approxeq */
+    { 2005, 1 }, /* thai_khokhuat */
+    { 1231, 1 }, /* hebrew_yod */
+    { 2290, 1 }, /* xf86next_vmode */
+    { 2225, 1 }, /* xf86cleargrab */
+    { 2278, 1 }, /* xf86memo */
+    { 1405, 1 }, /* kana_se */
+    { 128, 1 }, /* arabic_heh */
+    { 885, 1 }, /* f11 */
+    { 1523, 2 }, /* m */
+    { 2292, 1 }, /* xf86open */
+    { 1668, 1 }, /* osfhelp */
+    { 1763, 1 }, /* quoteright */
+    { 2076, 1 }, /* thinspace */
+    { 2347, 1 }, /* xf86topmenu */
+    { 145, 1 }, /* arabic_percent */
+    { 2207, 1 }, /* xf86audiorandomplay */
+    { 797, 1 }, /* doublelowquotemark */
+    { 2358, 1 }, /* xf86video */
+    { 776, 1 }, /* dead_stroke */
+    { 1848, 1 }, /* signifblank */
+    { 1204, 1 }, /* hebrew_finalkaph */
+    { 2334, 1 }, /* xf86switch_vt_2 */
+    { 2043, 1 }, /* thai_rorua */
+    { 2387, 2 }, /* z */
+    { 2058, 1 }, /* thai_sarauu */
+    { 1868, 1 }, /* sinh_dda */
+    { 591, 3 }, /* ch */
+    { 1470, 1 }, /* kp_space */
+    { 1723, 1 }, /* pointer_button4 */
+    { 2191, 2 }, /* xabovedot */
+    { 1301, 1 }, /* includedin */
+    { 2010, 1 }, /* thai_lekchet */
+    { 271, 2 }, /* b */
+    { 1936, 1 }, /* soliddiamond */
+    { 1917, 1 }, /* sinh_ru2 */
+    { 1268, 1 }, /* hpreset */
+    { 107, 1 }, /* arabic_dad */
+    { 1001, 1 }, /* georgian_zhar */
+    { 2301, 1 }, /* xf86q */
+    { 1733, 1 }, /* pointer_dfltbtnprev */
+    { 654, 2 }, /* cyrillic_i */
+    { 2274, 1 }, /* xf86mail */
+    { 920, 1 }, /* farsi_0 */
+    { 175, 1 }, /* armenian_amanak */
+    { 1490, 1 }, /* latincross */
+    { 1885, 1 }, /* sinh_ja */
+    { 612, 1 }, /* currency */
+    { 883, 1 }, /* f1 */
+    { 337, 1 }, /* braille_dots_12367 */
+    { 2281, 1 }, /* xf86messenger */
+    { 211, 2 }, /* armenian_ken */
+    { 2027, 1 }, /* thai_maitaikhu */
+    { 1611, 2 }, /* odiaeresis */
+    { 726, 1 }, /* dcedilla_accent */
+    { 968, 1 }, /* georgian_cil */
+    { 2223, 1 }, /* xf86cd */
+    { 1507, 1 }, /* leftsinglequotemark */
+    { 122, 1 }, /* arabic_hamza_above */
+    { 1251, 1 }, /* hpclearline */
+    { 2048, 1 }, /* thai_saraaimaimalai */
+    { 733, 1 }, /* dead_abovereversedcomma */
+    { 2173, 1 }, /* vertbar */
+    { 1887, 1 }, /* sinh_jnya */
+    { 750, 1 }, /* dead_circumflex */
+    { 1344, 1 }, /* iso_partial_space_right */
+    { 756, 2 }, /* dead_e */
+    { 741, 1 }, /* dead_belowdot */
+    { 2050, 1 }, /* thai_saraam */
+    { 1358, 1 }, /* jot */
+    { 447, 1 }, /* braille_dots_23458 */
+    { 419, 1 }, /* braille_dots_147 */
+    { 1132, 1 }, /* hangul_j_yeorinhieuh */
+    { 1705, 1 }, /* paragraph */
+    { 1671, 1 }, /* osfmenu */
+    { 630, 2 }, /* cyrillic_ef */
+    { 357, 1 }, /* braille_dots_12478 */
+    { 1219, 1 }, /* hebrew_pe */
+    { 1861, 1 }, /* sinh_al */
+    { 2089, 1 }, /* topleftsqbracket */
+    { 937, 1 }, /* filledrighttribullet */
+    { 1959, 1 }, /* sunfind */
+    { 93, 1 }, /* arabic_1 */
+    { 809, 2 }, /* e */
+    { 2389, 2 }, /* zabovedot */
+    { 2396, 1 }, /* zenkaku */
+    { 2037, 1 }, /* thai_paiyannoi */
+    { 329, 1 }, /* braille_dots_12356 */
+    { 2151, 1 }, /* underbar */
+    { 2065, 1 }, /* thai_thophuthao */
+    { 2137, 2 }, /* ukrainian_i */
+    { 850, 1 }, /* emfilledrect */
+    { 1996, 1 }, /* thai_chochoe */
+    { 1300, 1 }, /* implies */
+    { 1187, 1 }, /* hangul_yeo */
+    { 308, 1 }, /* braille_dot_9 */
+    { 731, 1 }, /* dead_abovecomma */
+    { 309, 1 }, /* braille_dots_1 */
+    { 1314, 1 }, /* iso_discontinuous_underline */
+    { 1184, 1 }, /* hangul_ya */
+    { 1298, 2 }, /* imacron */
+    { 738, 1 }, /* dead_belowcircumflex */
+    { 600, 1 }, /* codeinput */
+    { 1058, 2 }, /* greek_psi */
+    { 2321, 1 }, /* xf86sleep */
+    { 2178, 2 }, /* w */
+    { 1044, 2 }, /* greek_nu */
+    { 2397, 1 }, /* zenkaku_hankaku */
+    { 1875, 1 }, /* sinh_ee2 */
+    { 777, 1 }, /* dead_tilde */
+    { 1854, 1 }, /* sinh_aa2 */
+    { 854, 1 }, /* emspace */
+    { 1527, 2 }, /* macedonia_dse */
+    { 2273, 1 }, /* xf86logwindowtree */
+    { 1682, 1 }, /* osfprimarypaste */
+    { 1831, 2 }, /* serbian_dze */
+    { 1381, 1 }, /* kana_ko */
+    { 1728, 1 }, /* pointer_dblclick3 */
+    { 472, 1 }, /* braille_dots_2456 */
+    { 1242, 1 }, /* home */
+    { 2219, 1 }, /* xf86brightnessadjust */
+    { 1174, 1 }, /* hangul_sunkyeongeumphieuf */
+    { 89, 1 }, /* apostrophe */
+    { 339, 1 }, /* braille_dots_12368 */
+    { 1497, 1 }, /* left */
+    { 325, 1 }, /* braille_dots_12347 */
+    { 2131, 2 }, /* uhornhook */
+    { 2, 1 }, /* 2 */
+    { 597, 1 }, /* clear */
+    { 926, 1 }, /* farsi_6 */
+    { 1768, 1 }, /* r11 */
+    { 534, 1 }, /* braille_dots_45 */
+    { 1436, 1 }, /* kp_0 */
+    { 690, 2 }, /* cyrillic_softsign */
+    { 1871, 1 }, /* sinh_dhha */
+    { 1318, 1 }, /* iso_fast_cursor_left */
+    { 2341, 1 }, /* xf86switch_vt_9 */
+    { 1911, 1 }, /* sinh_oo2 */
+    { 1482, 1 }, /* l5 */
+    { 398, 1 }, /* braille_dots_1358 */
+    { 552, 1 }, /* braille_dots_5678 */
+    { 981, 1 }, /* georgian_jil */
+    { 1404, 1 }, /* kana_sa */
+    { 2299, 1 }, /* xf86poweroff */
+    { 1347, 1 }, /* iso_release_both_margins */
+    { 902, 1 }, /* f27 */
+    { 2369, 1 }, /* xf86zoomout */
+    { 1259, 1 }, /* hplira */
+    { 1846, 1 }, /* shift_r */
+    { 1780, 1 }, /* r9 */
+    { 2025, 1 }, /* thai_maihanakat */
+    { 434, 1 }, /* braille_dots_17 */
+    { 1884, 1 }, /* sinh_ii2 */
+    { 2055, 1 }, /* thai_sarau */
+    { 2063, 1 }, /* thai_thanthakhat */
+    { 1747, 1 }, /* pointer_upleft */
+    { 2221, 1 }, /* xf86calculator */
+    { 2194, 1 }, /* xf86applicationleft */
+    { 1774, 1 }, /* r3 */
+    { 1022, 2 }, /* greek_etaaccent */
+    { 1842, 1 }, /* sevensubscript */
+    { 2030, 1 }, /* thai_maiyamok */
+    { 222, 2 }, /* armenian_o */
+    { 508, 1 }, /* braille_dots_3457 */
+    { 580, 1 }, /* careof */
+    { 1370, 1 }, /* kana_fullstop */
+    { 1411, 1 }, /* kana_ta */
+    { 468, 1 }, /* braille_dots_2378 */
+    { 1802, 1 }, /* rightshoe */
+    { 1341, 1 }, /* iso_partial_line_down */
+    { 2053, 1 }, /* thai_saraii */
+    { 2174, 1 }, /* vertconnector */
+    { 997, 1 }, /* georgian_vin */
+    { 430, 1 }, /* braille_dots_16 */
+    { 1206, 1 }, /* hebrew_finalnun */
+    { 232, 2 }, /* armenian_re */
+    { 2197, 1 }, /* xf86audioforward */
+    { 2320, 1 }, /* xf86shop */
+    { 121, 1 }, /* arabic_hamza */
+    { 1750, 1 }, /* prev_virtual_screen */
+    { 945, 1 }, /* fivesuperior */
+    { 124, 1 }, /* arabic_hamzaonalef */
+    { 1003, 1 }, /* greater */
+    { 2052, 1 }, /* thai_sarai */
+    { 2088, 1 }, /* topleftradical */
+    { 342, 1 }, /* braille_dots_1238 */
+    { 1518, 1 }, /* longminus */
+    { 1111, 1 }, /* hangul_j_kkogjidalrinieung */
+    { 698, 2 }, /* cyrillic_u_macron */
+    { 1239, 1 }, /* hexagram */
+    { 313, 1 }, /* braille_dots_12345 */
+    { 299, 1 }, /* braille_dot_1 */
+    { 321, 1 }, /* braille_dots_12346 */
+    { 368, 1 }, /* braille_dots_1267 */
+    { 1737, 1 }, /* pointer_drag1 */
+    { 2080, 1 }, /* threeeighths */
+    { 1546, 1 }, /* mode_switch */
+    { 908, 1 }, /* f32 */
+    { 411, 1 }, /* braille_dots_14568 */
+    { 1270, 1 }, /* hpuser */
+    { 2232, 1 }, /* xf86display */
+    { 1676, 1 }, /* osfpageleft */
+    { 2014, 1 }, /* thai_leknung */
+    { 887, 1 }, /* f13 */
+    { 509, 1 }, /* braille_dots_34578 */
+    { 454, 1 }, /* braille_dots_2348 */
+    { 1865, 1 }, /* sinh_bha */
+    { 994, 1 }, /* georgian_tan */
+    { 2356, 1 }, /* xf86uwb */
+    { 884, 1 }, /* f10 */
+    { 1343, 1 }, /* iso_partial_space_left */
+    { 163, 1 }, /* arabic_thal */
+    { 2217, 1 }, /* xf86bluetooth */
+    { 67, 2 }, /* acircumflexgrave */
+    { 1333, 1 }, /* iso_level5_latch */
+    { 420, 1 }, /* braille_dots_1478 */
+    { 514, 1 }, /* braille_dots_3468 */
+    { 708, 2 }, /* cyrillic_yeru */
+    { 1180, 1 }, /* hangul_wae */
+    { 1743, 1 }, /* pointer_enablekeys */
+    { 2272, 1 }, /* xf86logoff */
+    { 841, 1 }, /* eisu_toggle */
+    { 1086, 1 }, /* hangul */
+    { 1882, 1 }, /* sinh_i2 */
+    { 1274, 1 }, /* ht */
+    { 1033, 1 }, /* greek_iotadiaeresis */
+    { 1064, 1 }, /* greek_switch */
+    { 791, 1 }, /* division */
+    { 2016, 1 }, /* thai_leksam */
+    { 1869, 1 }, /* sinh_ddha */
+    { 1402, 1 }, /* kana_ro */
+    { 193, 2 }, /* armenian_fe */
+    { 1688, 1 }, /* osfselectall */
+    { 1293, 1 }, /* ifonlyif */
+    { 2199, 1 }, /* xf86audiomedia */
+    { 2188, 1 }, /* wonsign */
+    { 1116, 1 }, /* hangul_j_pansios */
+    { 106, 1 }, /* arabic_comma */
+    { 1192, 1 }, /* hankaku */
+    { 1088, 1 }, /* hangul_ae */
+    { 636, 2 }, /* cyrillic_en */
+    { 282, 1 }, /* blank */
+    { 22, 1 }, /* 3270_pa1 */
+    { 15, 1 }, /* 3270_eraseinput */
+    { 1371, 1 }, /* kana_ha */
+    { 799, 1 }, /* downarrow */
+    { 1714, 1 }, /* permille */
+    { 44, 2 }, /* abelowdot */
+    { 270, 1 }, /* audiblebell_enable */
+    { 1900, 1 }, /* sinh_ndda */
+    { 988, 1 }, /* georgian_par */
+    { 1136, 1 }, /* hangul_khieuq */
+    { 1095, 1 }, /* hangul_e */
+    { 941, 1 }, /* first_virtual_screen */
+    { 2351, 1 }, /* xf86travel */
+    { 558, 1 }, /* braille_dots_67 */
+    { 386, 1 }, /* braille_dots_134678 */
+    { 266, 1 }, /* asterisk */
+    { 948, 1 }, /* foursuperior */
+    { 2123, 2 }, /* uhorn */
+    { 2069, 1 }, /* thai_thothung */
+    { 1858, 1 }, /* sinh_aee2 */
+    { 729, 2 }, /* dead_a */
+    { 1040, 2 }, /* greek_lamda */
+    { 1547, 1 }, /* mousekeys_accel_enable */
+    { 1332, 1 }, /* iso_level3_shift */
+    { 1324, 1 }, /* iso_group_lock */
+    { 318, 1 }, /* braille_dots_123457 */
+    { 1538, 1 }, /* masculine */
+    { 1474, 1 }, /* kra */
+    { 1730, 1 }, /* pointer_dblclick5 */
+    { 1651, 1 }, /* osfactivate */
+    { 1636, 1 }, /* oneeighth */
+    { 2196, 1 }, /* xf86audiocycletrack */
+    { 817, 2 }, /* ecaron */
+    { 977, 1 }, /* georgian_hie */
+    { 1974, 1 }, /* sunvideoraisebrightness */
+    { 811, 2 }, /* eabovedot */
+    { 1851, 1 }, /* singlelowquotemark */
+    { 375, 1 }, /* braille_dots_134 */
+    { 388, 1 }, /* braille_dots_1347 */
+    { 2216, 1 }, /* xf86blue */
+    { 1960, 1 }, /* sunfront */
+    { 843, 1 }, /* ellipsis */
+    { 1796, 1 }, /* rightcaret */
+    { 218, 2 }, /* armenian_men */
+    { 1751, 1 }, /* previouscandidate */
+    { 1413, 1 }, /* kana_ti */
+    { 2337, 1 }, /* xf86switch_vt_5 */
+    { 1481, 1 }, /* l4 */
+    { 1417, 2 }, /* kana_tu */
+    { 975, 1 }, /* georgian_har */
+    { 1729, 1 }, /* pointer_dblclick4 */
+    { 1503, 1 }, /* leftopentriangle */
+    { 1919, 1 }, /* sinh_sa */
+    { 220, 2 }, /* armenian_nu */
+    { 234, 2 }, /* armenian_se */
+    { 1947, 1 }, /* sunaudioraisevolume */
+    { 476, 1 }, /* braille_dots_2457 */
+    { 296, 1 }, /* bracketleft */
+    { 1460, 1 }, /* kp_home */
+    { 1148, 1 }, /* hangul_phieuf */
+    { 1213, 1 }, /* hebrew_het */
+    { 286, 1 }, /* botleftsqbracket */
+    { 2314, 1 }, /* xf86scrollclick */
+    { 298, 1 }, /* braille_blank */
+    { 1346, 1 }, /* iso_prev_group_lock */
+    { 1247, 1 }, /* horizlinescan7 */
+    { 349, 1 }, /* braille_dots_12457 */
+    { 1287, 2 }, /* icircumflex */
+    { 503, 1 }, /* braille_dots_345 */
+    { 1639, 1 }, /* onequarter */
+    { 520, 1 }, /* braille_dots_3567 */
+    { 2105, 2 }, /* u */
+    { 84, 2 }, /* amacron */
+    { 2306, 1 }, /* xf86rockerdown */
+    { 174, 1 }, /* armenian_accent */
+    { 1648, 1 }, /* opentribulletdown */
+    { 1938, 1 }, /* squareroot */
+    { 1328, 1 }, /* iso_left_tab */
+    { 998, 1 }, /* georgian_we */
+    { 12, 1 }, /* 3270_duplicate */
+    { 188, 2 }, /* armenian_dza */
+    { 1726, 1 }, /* pointer_dblclick1 */
+    { 490, 1 }, /* braille_dots_2568 */
+    { 587, 2 }, /* ccircumflex */
+    { 578, 1 }, /* cancel */
+    { 1622, 2 }, /* ohorn */
+    { 1176, 1 }, /* hangul_switch */
+    { 579, 1 }, /* caps_lock */
+    { 1687, 1 }, /* osfselect */
+    { 532, 1 }, /* braille_dots_38 */
+    { 1272, 2 }, /* hstroke */
+    { 862, 1 }, /* enopensquarebullet */
+    { 1004, 1 }, /* greaterthanequal */
+    { 1644, 2 }, /* ooblique */
+    { 30, 1 }, /* 3270_right2 */
+    { 113, 1 }, /* arabic_fatha */
+    { 648, 2 }, /* cyrillic_ha */
+    { 764, 1 }, /* dead_invertedbreve */
+    { 892, 1 }, /* f18 */
+    { 200, 2 }, /* armenian_hi */
+    { 417, 1 }, /* braille_dots_14678 */
+    { 192, 1 }, /* armenian_exclam */
+    { 49, 2 }, /* abreveacute */
+    { 889, 1 }, /* f15 */
+    { 2003, 1 }, /* thai_khokhai */
+    { 1752, 1 }, /* print */
+    { 2262, 1 }, /* xf86launch8 */
+    { 1191, 1 }, /* hangul_yu */
+    { 1634, 2 }, /* omacron */
+    { 9, 1 }, /* 3270_cursorblink */
+    { 1829, 2 }, /* serbian_dje */
+    { 425, 1 }, /* braille_dots_15678 */
+    { 846, 2 }, /* emacron */
+    { 2350, 1 }, /* xf86touchpadtoggle */
+    { 1902, 1 }, /* sinh_ng */
+    { 2353, 1 }, /* xf86user1kb */
+    { 512, 1 }, /* braille_dots_3467 */
+    { 2103, 1 }, /* twosuperior */
+    { 2006, 1 }, /* thai_khokhwai */
+    { 364, 1 }, /* braille_dots_1257 */
+    { 611, 1 }, /* cuberoot */
+    { 1308, 1 }, /* intersection */
+    { 2264, 1 }, /* xf86launcha */
+    { 942, 1 }, /* fiveeighths */
+    { 1121, 1 }, /* hangul_j_rieulhieuh */
+    { 2019, 1 }, /* thai_leksun */
+    { 10, 1 }, /* 3270_cursorselect */
+    { 116, 1 }, /* arabic_fullstop */
+    { 344, 1 }, /* braille_dots_1245 */
+    { 1472, 1 }, /* kp_tab */
+    { 1534, 1 }, /* mae_koho */
+    { 1940, 1 }, /* sterling */
+    { 20, 1 }, /* 3270_keyclick */
+    { 1697, 1 }, /* overlay2_enable */
+    { 413, 1 }, /* braille_dots_14578 */
+    { 59, 1 }, /* accessx_enable */
+    { 1903, 1 }, /* sinh_ng2 */
+    { 895, 1 }, /* f20 */
+    { 1892, 1 }, /* sinh_lla */
+    { 2022, 1 }, /* thai_lu */
+    { 950, 1 }, /* function */
+    { 2242, 1 }, /* xf86frameforward */
+    { 150, 1 }, /* arabic_sad */
+    { 2013, 1 }, /* thai_lekkao */
+    { 2218, 1 }, /* xf86book */
+    { 927, 1 }, /* farsi_7 */
+    { 925, 1 }, /* farsi_5 */
+    { 87, 2 }, /* aogonek */
+    { 1721, 1 }, /* pointer_button2 */
+    { 976, 1 }, /* georgian_he */
+    { 1769, 1 }, /* r12 */
+    { 1235, 1 }, /* hebrew_zayin */
+    { 1452, 1 }, /* kp_down */
+    { 2252, 1 }, /* xf86kbdbrightnessup */
+    { 449, 1 }, /* braille_dots_23467 */
+    { 1099, 1 }, /* hangul_hanja */
+    { 255, 2 }, /* armenian_vyun */
+    { 1928, 1 }, /* sinh_uu */
+    { 1329, 1 }, /* iso_level2_latch */
+    { 1382, 1 }, /* kana_ku */
+    { 2231, 1 }, /* xf86cycleangle */
+    { 1725, 1 }, /* pointer_button_dflt */
+    { 1930, 1 }, /* sinh_va */
+    { 179, 2 }, /* armenian_ayb */
+    { 1027, 1 }, /* greek_horizbar */
+    { 1471, 1 }, /* kp_subtract */
+    { 294, 1 }, /* braceleft */
+    { 103, 1 }, /* arabic_alef */
+    { 656, 2 }, /* cyrillic_i_macron */
+    { 1605, 2 }, /* ocircumflexgrave */
+    { 290, 1 }, /* botrightsummation */
+    { 1975, 1 }, /* super_l */
+    { 1054, 2 }, /* greek_phi */
+    { 1133, 1 }, /* hangul_jamo */
+    { 154, 1 }, /* arabic_sheen */
+    { 1230, 1 }, /* hebrew_waw */
+    { 1483, 1 }, /* l6 */
+    { 2047, 1 }, /* thai_saraae */
+    { 2210, 1 }, /* xf86audiorewind */
+    { 536, 1 }, /* braille_dots_4567 */
+    { 493, 1 }, /* braille_dots_258 */
+    { 1758, 1 }, /* quad */
+    { 47, 2 }, /* abreve */
+    { 1144, 1 }, /* hangul_nieunjieuj */
+    { 1146, 1 }, /* hangul_oe */
+    { 1521, 2 }, /* lstroke */
+    { 966, 1 }, /* georgian_char */
+    { 1456, 1 }, /* kp_f1 */
+    { 947, 1 }, /* foursubscript */
+    { 1322, 1 }, /* iso_first_group_lock */
+    { 2212, 1 }, /* xf86away */
+    { 1937, 1 }, /* space */
+    { 2319, 1 }, /* xf86send */
+    { 4, 1 }, /* 3270_altcursor */
+    { 901, 1 }, /* f26 */
+    { 1852, 1 }, /* sinh_a */
+    { 2000, 1 }, /* thai_fofan */
+    { 594, 1 }, /* checkerboard */
+    { 1366, 1 }, /* kana_conjunctive */
+    { 1100, 1 }, /* hangul_hieuh */
+    { 858, 1 }, /* enfilledsqbullet */
+    { 1338, 1 }, /* iso_move_line_up */
+    { 2029, 1 }, /* thai_maitri */
+    { 73, 1 }, /* acute */
+    { 396, 1 }, /* braille_dots_1357 */
+    { 771, 1 }, /* dead_ogonek */
+    { 973, 1 }, /* georgian_ghan */
+    { 765, 1 }, /* dead_iota */
+    { 748, 1 }, /* dead_caron */
+    { 2090, 1 }, /* topleftsummation */
+    { 11, 1 }, /* 3270_deleteword */
+    { 1978, 1 }, /* system */
+    { 1859, 1 }, /* sinh_ai */
+    { 1536, 1 }, /* maltesecross */
+    { 1367, 2 }, /* kana_e */
+    { 2296, 1 }, /* xf86phone */
+    { 916, 1 }, /* f8 */
+    { 1166, 1 }, /* hangul_special */
+    { 1491, 2 }, /* lbelowdot */
+    { 1466, 1 }, /* kp_page_up */
+    { 957, 2 }, /* gcaron */
+    { 1556, 1 }, /* mute_acute */
+    { 1167, 1 }, /* hangul_ssangdikeud */
+    { 401, 1 }, /* braille_dots_13678 */
+    { 143, 1 }, /* arabic_noon_ghunna */
+    { 1680, 1 }, /* osfprevfield */
+    { 918, 2 }, /* fabovedot */
+    { 2098, 1 }, /* trademarkincircle */
+    { 1060, 2 }, /* greek_rho */
+    { 546, 1 }, /* braille_dots_47 */
+    { 1315, 1 }, /* iso_emphasize */
+    { 1973, 1 }, /* sunvideolowerbrightness */
+    { 839, 1 }, /* eightsuperior */
+    { 805, 1 }, /* dring_accent */
+    { 1440, 1 }, /* kp_4 */
+    { 1827, 1 }, /* semicolon */
+    { 343, 1 }, /* braille_dots_124 */
+    { 2002, 1 }, /* thai_honokhuk */
+    { 63, 2 }, /* acircumflexacute */
+    { 598, 1 }, /* clearline */
+    { 1383, 1 }, /* kana_lock */
+    { 2248, 1 }, /* xf86homepage */
+    { 2250, 1 }, /* xf86itouch */
+    { 1502, 1 }, /* leftmiddlecurlybrace */
+    { 0, 1 }, /* 0 */
+    { 2153, 1 }, /* undo */
+    { 2017, 1 }, /* thai_leksi */
+    { 2357, 1 }, /* xf86vendorhome */
+    { 774, 1 }, /* dead_semivoiced_sound */
+    { 1160, 1 }, /* hangul_rieulsios */
+    { 1152, 1 }, /* hangul_prehanja */
+    { 110, 1 }, /* arabic_dammatan */
+    { 330, 1 }, /* braille_dots_123567 */
+    { 2193, 1 }, /* xf86addfavorite */
+    { 1254, 1 }, /* hpguilder */
+    { 2095, 1 }, /* topvertsummationconnector */
+    { 2331, 1 }, /* xf86switch_vt_10 */
+    { 1893, 1 }, /* sinh_lu */
+    { 1953, 1 }, /* sunfa_acute */
+    { 1431, 1 }, /* kappa */
+    { 1269, 1 }, /* hpsystem */
+    { 1810, 2 }, /* sabovedot */
+    { 461, 1 }, /* braille_dots_23578 */
+    { 538, 1 }, /* braille_dots_4568 */
+    { 1874, 1 }, /* sinh_ee */
+    { 1389, 1 }, /* kana_mu */
+    { 2092, 1 }, /* toprightsqbracket */
+    { 1661, 1 }, /* osfdelete */
+    { 877, 1 }, /* ext16bit_l */
+    { 1557, 1 }, /* mute_asciicircum */
+    { 361, 1 }, /* braille_dots_12567 */
+    { 284, 1 }, /* botintegral */
+    { 423, 1 }, /* braille_dots_156 */
+    { 1904, 1 }, /* sinh_nga */
+    { 450, 1 }, /* braille_dots_234678 */
+    { 1124, 1 }, /* hangul_j_rieulphieuf */
+    { 1316, 1 }, /* iso_enter */
+    { 1753, 1 }, /* prior */
+    { 1577, 1 }, /* nobreakspace */
+    { 819, 2 }, /* ecircumflex */
+    { 521, 1 }, /* braille_dots_35678 */
+    { 2222, 1 }, /* xf86calendar */
+    { 262, 2 }, /* armenian_zhe */
+    { 295, 1 }, /* braceright */
+    { 139, 1 }, /* arabic_madda_above */
+    { 1348, 1 }, /* iso_release_margin_left */
+    { 1076, 2 }, /* greek_xi */
+    { 1554, 1 }, /* musicalflat */
+    { 982, 1 }, /* georgian_kan */
+    { 525, 1 }, /* braille_dots_358 */
+    { 531, 1 }, /* braille_dots_378 */
+    { 1988, 1 }, /* telephone */
+    { 1243, 1 }, /* horizconnector */
+    { 2336, 1 }, /* xf86switch_vt_4 */
+    { 2141, 2 }, /* ukrainian_yi */
+    { 2097, 1 }, /* trademark */
+    { 1908, 1 }, /* sinh_o */
+    { 1030, 2 }, /* greek_iotaaccent */
+    { 1379, 1 }, /* kana_ke */
+    { 1467, 1 }, /* kp_prior */
+    { 1385, 1 }, /* kana_me */
+    { 2381, 2 }, /* ygrave */
+    { 2111, 2 }, /* ubreve */
+    { 1498, 1 }, /* leftanglebracket */
+    { 856, 1 }, /* endash */
+    { 1271, 1 }, /* hpydiaeresis */
+    { 745, 1 }, /* dead_belowverticalline */
+    { 198, 2 }, /* armenian_gim */
+    { 527, 1 }, /* braille_dots_367 */
+    { 394, 1 }, /* braille_dots_135678 */
+    { 1793, 1 }, /* right */
+    { 1559, 1 }, /* mute_diaeresis */
+    { 2198, 1 }, /* xf86audiolowervolume */
+    { 2307, 1 }, /* xf86rockerenter */
+    { 548, 1 }, /* braille_dots_48 */
+    { 1525, 2 }, /* mabovedot */
+    { 1708, 1 }, /* partdifferential */
+    { 1082, 1 }, /* guillemotright */
+    { 104, 1 }, /* arabic_alefmaksura */
+    { 466, 1 }, /* braille_dots_2368 */
+    { 1949, 1 }, /* suncopy */
+    { 518, 1 }, /* braille_dots_35 */
+    { 515, 1 }, /* braille_dots_347 */
+    { 32, 1 }, /* 3270_setup */
+    { 1997, 1 }, /* thai_dochada */
+    { 1005, 1 }, /* greek_accentdieresis */
+    { 1401, 1 }, /* kana_ri */
+    { 893, 1 }, /* f19 */
+    { 1878, 1 }, /* sinh_gha */
+    { 1461, 1 }, /* kp_insert */
+    { 1034, 2 }, /* greek_iotadieresis */
+    { 678, 2 }, /* cyrillic_pe */
+    { 1939, 1 }, /* ssharp */
+    { 1442, 1 }, /* kp_6 */
+    { 1825, 1 }, /* section */
+    { 470, 1 }, /* braille_dots_24 */
+    { 355, 1 }, /* braille_dots_12468 */
+    { 2209, 1 }, /* xf86audiorepeat */
+    { 949, 1 }, /* fourthroot */
+    { 338, 1 }, /* braille_dots_123678 */
+    { 307, 1 }, /* braille_dot_8 */
+    { 1963, 1 }, /* sunpageup */
+    { 2294, 1 }, /* xf86option */
+    { 2159, 1 }, /* upcaret */
+    { 1807, 1 }, /* rupeesign */
+    { 1153, 1 }, /* hangul_previouscandidate */
+    { 408, 1 }, /* braille_dots_1456 */
+    { 1281, 2 }, /* iacute */
+    { 906, 1 }, /* f30 */
+    { 1662, 1 }, /* osfdeselectall */
+    { 2383, 2 }, /* yhook */
+    { 1210, 1 }, /* hebrew_gimel */
+    { 1574, 1 }, /* ninesubscript */
+    { 130, 1 }, /* arabic_heh_goal */
+    { 1519, 1 }, /* lowleftcorner */
+    { 526, 1 }, /* braille_dots_36 */
+    { 496, 1 }, /* braille_dots_2678 */
+    { 608, 1 }, /* cr */
+    { 367, 1 }, /* braille_dots_126 */
+    { 1745, 1 }, /* pointer_right */
+    { 2189, 2 }, /* x */
+    { 494, 1 }, /* braille_dots_26 */
+    { 443, 1 }, /* braille_dots_2345678 */
+    { 1262, 1 }, /* hpmodelock2 */
+    { 1080, 1 }, /* guilder */
+    { 802, 1 }, /* downstile */
+    { 563, 1 }, /* braille_dots_8 */
+    { 260, 2 }, /* armenian_za */
+    { 1798, 1 }, /* rightmiddlecurlybrace */
+    { 727, 1 }, /* dcircumflex_accent */
+    { 528, 1 }, /* braille_dots_3678 */
+    { 1090, 1 }, /* hangul_araeae */
+    { 1609, 2 }, /* ocircumflextilde */
+    { 2161, 1 }, /* uprightcorner */
+    { 2399, 1 }, /* zerosuperior */
+    { 1907, 1 }, /* sinh_nya */
+    { 1720, 1 }, /* pointer_button1 */
+    { 1853, 1 }, /* sinh_aa */
+    { 1741, 1 }, /* pointer_drag5 */
+    { 2028, 1 }, /* thai_maitho */
+    { 1770, 1 }, /* r13 */
+    { 782, 1 }, /* degree */
+    { 2109, 2 }, /* ubelowdot */
+    { 992, 1 }, /* georgian_san */
+    { 620, 2 }, /* cyrillic_che_descender */
+    { 1236, 1 }, /* help */
+    { 166, 1 }, /* arabic_veh */
+    { 2344, 1 }, /* xf86time */
+    { 1163, 1 }, /* hangul_romaja */
+    { 248, 2 }, /* armenian_tyun */
+    { 34, 1 }, /* 4 */
+    { 300, 1 }, /* braille_dot_10 */
+    { 1717, 1 }, /* plus */
+    { 1319, 1 }, /* iso_fast_cursor_right */
+    { 1803, 1 }, /* rightsinglequotemark */
+    { 1093, 1 }, /* hangul_codeinput */
+    { 1649, 1 }, /* opentribulletup */
+    { 1992, 1 }, /* thai_bobaimai */
+    { 429, 1 }, /* braille_dots_158 */
+    { 390, 1 }, /* braille_dots_1348 */
+    { 1698, 1 }, /* overline */
+    { 440, 1 }, /* braille_dots_2345 */
+    { 2081, 1 }, /* threefifths */
+    { 2297, 1 }, /* xf86pictures */
+    { 1760, 1 }, /* questiondown */
+    { 1545, 1 }, /* minutes */
+    { 287, 1 }, /* botleftsummation */
+    { 118, 1 }, /* arabic_ghain */
+    { 283, 1 }, /* block */
+    { 127, 1 }, /* arabic_hamzaunderalef */
+    { 551, 1 }, /* braille_dots_567 */
+    { 1238, 1 }, /* henkan_mode */
+    { 1089, 1 }, /* hangul_araea */
+    { 2064, 1 }, /* thai_thonangmontho */
+    { 2182, 2 }, /* wcircumflex */
+    { 242, 2 }, /* armenian_to */
+    { 422, 1 }, /* braille_dots_15 */
+    { 1289, 1 }, /* identical */
+    { 2293, 1 }, /* xf86openurl */
+    { 1415, 2 }, /* kana_tsu */
+    { 875, 1 }, /* exclamdown */
+    { 2385, 2 }, /* ytilde */
+    { 1161, 1 }, /* hangul_rieultieut */
+    { 718, 2 }, /* d */
+    { 409, 1 }, /* braille_dots_14567 */
+    { 1791, 1 }, /* reset */
+    { 1571, 1 }, /* newsheqelsign */
+    { 1002, 1 }, /* grave */
+    { 739, 1 }, /* dead_belowcomma */
+    { 2015, 1 }, /* thai_lekpaet */
+    { 747, 1 }, /* dead_capital_schwa */
+    { 2119, 2 }, /* ugrave */
+    { 961, 2 }, /* gcircumflex */
+    { 1317, 1 }, /* iso_fast_cursor_down */
+    { 392, 1 }, /* braille_dots_1356 */
+    { 2302, 1 }, /* xf86red */
+    { 876, 1 }, /* execute */
+    { 545, 1 }, /* braille_dots_468 */
+    { 1607, 2 }, /* ocircumflexhook */
+    { 334, 1 }, /* braille_dots_123578 */
+    { 1575, 1 }, /* ninesuperior */
+    { 786, 1 }, /* dgrave_accent */
+    { 896, 1 }, /* f21 */
+    { 327, 1 }, /* braille_dots_12348 */
+    { 147, 1 }, /* arabic_question_mark */
+    { 2032, 1 }, /* thai_ngongu */
+    { 1599, 2 }, /* ocircumflex */
+    { 1872, 1 }, /* sinh_e */
+    { 33, 1 }, /* 3270_test */
+    { 1118, 1 }, /* hangul_j_pieub */
+    { 2107, 2 }, /* uacute */
+    { 969, 1 }, /* georgian_don */
+    { 1601, 2 }, /* ocircumflexacute */
+    { 485, 1 }, /* braille_dots_248 */
+    { 1032, 1 }, /* greek_iotaaccentdieresis */
+    { 213, 2 }, /* armenian_khe */
+    { 2235, 1 }, /* xf86eject */
+    { 2008, 1 }, /* thai_kokai */
+    { 1929, 1 }, /* sinh_uu2 */
+    { 382, 1 }, /* braille_dots_134578 */
+    { 894, 1 }, /* f2 */
+    { 506, 1 }, /* braille_dots_345678 */
+    { 867, 1 }, /* escape */
+    { 314, 1 }, /* braille_dots_123456 */
+    { 311, 1 }, /* braille_dots_123 */
+    { 599, 1 }, /* club */
+    { 1890, 1 }, /* sinh_kunddaliya */
+    { 1083, 2 }, /* h */
+    { 1303, 1 }, /* infinity */
+    { 399, 1 }, /* braille_dots_136 */
+    { 167, 1 }, /* arabic_waw */
+    { 2056, 1 }, /* thai_saraue */
+    { 1392, 1 }, /* kana_ne */
+    { 1182, 1 }, /* hangul_weo */
+    { 544, 1 }, /* braille_dots_4678 */
+    { 886, 1 }, /* f12 */
+    { 2226, 1 }, /* xf86close */
+    { 2203, 1 }, /* xf86audiopause */
+    { 583, 2 }, /* ccaron */
+    { 2332, 1 }, /* xf86switch_vt_11 */
+    { 303, 1 }, /* braille_dot_4 */
+    { 2263, 1 }, /* xf86launch9 */
+    { 1048, 2 }, /* greek_omegaaccent */
+    { 2368, 1 }, /* xf86zoomin */
+    { 1912, 1 }, /* sinh_pa */
+    { 1579, 1 }, /* notapproxeq */
+    { 144, 1 }, /* arabic_peh */
+    { 1718, 1 }, /* plusminus */
+    { 1103, 1 }, /* hangul_j_cieuc */
+    { 606, 1 }, /* control_r */
+    { 1320, 1 }, /* iso_fast_cursor_up */
+    { 2400, 2 }, /* zstroke */
+    { 505, 1 }, /* braille_dots_34567 */
+    { 2074, 1 }, /* thai_yoying */
+    { 452, 1 }, /* braille_dots_2347 */
+    { 938, 1 }, /* filledtribulletdown */
+    { 1961, 1 }, /* sunopen */
+    { 1642, 1 }, /* onesuperior */
+    { 491, 1 }, /* braille_dots_257 */
+    { 831, 1 }, /* ecusign */
+    { 1586, 1 }, /* num_lock */
+    { 1065, 2 }, /* greek_tau */
+    { 462, 1 }, /* braille_dots_2358 */
+    { 772, 1 }, /* dead_perispomeni */
+    { 1395, 1 }, /* kana_nu */
+    { 2254, 1 }, /* xf86launch0 */
+    { 1679, 1 }, /* osfpaste */
+    { 1448, 1 }, /* kp_begin */
+    { 1701, 2 }, /* pabovedot */
+    { 963, 1 }, /* georgian_an */
+    { 1255, 1 }, /* hpinsertchar */
+    { 1437, 1 }, /* kp_1 */
+    { 383, 1 }, /* braille_dots_13458 */
+    { 82, 1 }, /* alt_l */
+    { 138, 1 }, /* arabic_lam */
+    { 768, 1 }, /* dead_macron */
+    { 1818, 2 }, /* schwa */
+    { 1516, 1 }, /* logicaland */
+    { 184, 2 }, /* armenian_cha */
+    { 3, 1 }, /* 3 */
+    { 1551, 1 }, /* multi_key */
+    { 1020, 2 }, /* greek_eta */
+    { 2049, 1 }, /* thai_saraaimaimuan */
+    { 1211, 1 }, /* hebrew_gimmel */
+    { 204, 1 }, /* armenian_hyphen */
+    { 1218, 1 }, /* hebrew_nun */
+    { 279, 1 }, /* bar */
+    { 445, 1 }, /* braille_dots_23457 */
+    { 335, 1 }, /* braille_dots_12358 */
+    { 1102, 1 }, /* hangul_ieung */
+    { 1656, 1 }, /* osfbeginline */
+    { 2361, 1 }, /* xf86webcam */
+    { 2163, 1 }, /* upstile */
+    { 1950, 1 }, /* suncut */
+    { 1994, 1 }, /* thai_chochang */
+    { 1264, 1 }, /* hpmute_asciicircum */
+    { 1147, 1 }, /* hangul_pansios */
+    { 1968, 1 }, /* sunprops */
+    { 808, 1 }, /* dtilde */
+    { 289, 1 }, /* botrightsqbracket */
+    { 297, 1 }, /* bracketright */
+    { 1306, 1 }, /* insertline */
+    { 1833, 2 }, /* serbian_je */
+    { 397, 1 }, /* braille_dots_13578 */
+    { 1880, 1 }, /* sinh_ha */
+    { 2339, 1 }, /* xf86switch_vt_7 */
+    { 1711, 1 }, /* percent */
+    { 259, 1 }, /* armenian_yentamna */
+    { 358, 1 }, /* braille_dots_1248 */
+    { 1234, 1 }, /* hebrew_zain */
+    { 1196, 1 }, /* hebrew_aleph */
+    { 1265, 1 }, /* hpmute_asciitilde */
+    { 559, 1 }, /* braille_dots_678 */
+    { 95, 1 }, /* arabic_3 */
+    { 596, 1 }, /* circle */
+    { 2305, 1 }, /* xf86reply */
+    { 1137, 1 }, /* hangul_kiyeog */
+    { 944, 1 }, /* fivesubscript */
+    { 2270, 1 }, /* xf86lightbulb */
+    { 1748, 1 }, /* pointer_upright */
+    { 486, 1 }, /* braille_dots_25 */
+    { 2051, 1 }, /* thai_sarae */
+    { 487, 1 }, /* braille_dots_256 */
+    { 511, 1 }, /* braille_dots_346 */
+    { 574, 2 }, /* cabovedot */
+    { 1895, 1 }, /* sinh_luu */
+    { 96, 1 }, /* arabic_4 */
+    { 888, 1 }, /* f14 */
+    { 1795, 1 }, /* rightarrow */
+    { 873, 1 }, /* eurosign */
+    { 464, 1 }, /* braille_dots_2367 */
+    { 501, 1 }, /* braille_dots_3 */
+    { 1624, 2 }, /* ohornacute */
+    { 1224, 1 }, /* hebrew_shin */
+    { 1515, 1 }, /* lirasign */
+    { 990, 1 }, /* georgian_qar */
+    { 1475, 2 }, /* l */
+    { 516, 1 }, /* braille_dots_3478 */
+    { 1558, 1 }, /* mute_asciitilde */
+    { 1563, 1 }, /* nabla */
+    { 2031, 1 }, /* thai_moma */
+    { 500, 1 }, /* braille_dots_28 */
+    { 1398, 1 }, /* kana_openingbracket */
+    { 1578, 1 }, /* nosymbol */
+    { 1412, 1 }, /* kana_te */
+    { 421, 1 }, /* braille_dots_148 */
+    { 1990, 1 }, /* terminate_server */
+    { 1441, 1 }, /* kp_5 */
+    { 1955, 1 }, /* sunfa_circum */
+    { 2220, 1 }, /* xf86calculater */
+    { 2104, 1 }, /* twothirds */
+    { 1934, 1 }, /* slash */
+    { 1423, 2 }, /* kana_ya */
+    { 1643, 1 }, /* onethird */
+    { 1640, 1 }, /* onesixth */
+    { 137, 1 }, /* arabic_khah */
+    { 1120, 1 }, /* hangul_j_rieul */
+    { 2238, 1 }, /* xf86favorites */
+    { 792, 1 }, /* dollar */
+    { 181, 2 }, /* armenian_ben */
+    { 1638, 1 }, /* onehalf */
+    { 412, 1 }, /* braille_dots_1457 */
+    { 1462, 1 }, /* kp_left */
+    { 1617, 1 }, /* ogonek */
+    { 2129, 2 }, /* uhorngrave */
+    { 281, 1 }, /* begin */
+    { 722, 1 }, /* dacute_accent */
+    { 1779, 1 }, /* r8 */
+    { 207, 2 }, /* armenian_je */
+    { 1458, 1 }, /* kp_f3 */
+    { 504, 1 }, /* braille_dots_3456 */
+    { 1331, 1 }, /* iso_level3_lock */
+    { 216, 2 }, /* armenian_lyun */
+    { 1447, 1 }, /* kp_backtab */
+    { 744, 1 }, /* dead_belowtilde */
+    { 524, 1 }, /* braille_dots_3578 */
+    { 923, 1 }, /* farsi_3 */
+    { 2308, 1 }, /* xf86rockerup */
+    { 838, 1 }, /* eightsubscript */
+    { 479, 1 }, /* braille_dots_246 */
+    { 638, 2 }, /* cyrillic_en_descender */
+    { 1128, 1 }, /* hangul_j_sios */
+    { 159, 1 }, /* arabic_tatweel */
+    { 1465, 1 }, /* kp_page_down */
+    { 51, 2 }, /* abrevebelowdot */
+    { 83, 1 }, /* alt_r */
+    { 510, 1 }, /* braille_dots_3458 */
+    { 1122, 1 }, /* hangul_j_rieulkiyeog */
+    { 2113, 2 }, /* ucircumflex */
+    { 1876, 1 }, /* sinh_fa */
+    { 2072, 1 }, /* thai_wowaen */
+    { 2172, 1 }, /* variation */
+    { 55, 2 }, /* abrevehook */
+    { 2045, 1 }, /* thai_saraa */
+    { 1756, 2 }, /* q */
+    { 736, 1 }, /* dead_acute */
+    { 1195, 1 }, /* heart */
+    { 1927, 1 }, /* sinh_u2 */
+    { 348, 1 }, /* braille_dots_124568 */
+    { 604, 1 }, /* containsas */
+    { 1722, 1 }, /* pointer_button3 */
+    { 517, 1 }, /* braille_dots_348 */
+    { 946, 1 }, /* fourfifths */
+    { 1970, 1 }, /* sunsys_req */
+    { 1350, 1 }, /* iso_set_margin_left */
+    { 844, 1 }, /* em3space */
+    { 1464, 1 }, /* kp_next */
+    { 855, 1 }, /* end */
+    { 723, 1 }, /* dagger */
+    { 1783, 1 }, /* radical */
+    { 1581, 1 }, /* notequal */
+    { 1012, 2 }, /* greek_chi */
+    { 2087, 1 }, /* topleftparens */
+    { 1979, 2 }, /* t */
+    { 1956, 1 }, /* sunfa_diaeresis */
+    { 1529, 2 }, /* macedonia_gje */
+    { 465, 1 }, /* braille_dots_23678 */
+    { 5, 1 }, /* 3270_attn */
+    { 790, 1 }, /* dintegral */
+    { 2251, 1 }, /* xf86kbdbrightnessdown */
+    { 2083, 1 }, /* threesubscript */
+    { 2360, 1 }, /* xf86wakeup */
+    { 1998, 1 }, /* thai_dodek */
+    { 1101, 1 }, /* hangul_i */
+    { 165, 1 }, /* arabic_tteh */
+    { 529, 1 }, /* braille_dots_368 */
+    { 2282, 1 }, /* xf86modelock */
+    { 2398, 1 }, /* zerosubscript */
+    { 370, 1 }, /* braille_dots_1268 */
+    { 57, 2 }, /* abrevetilde */
+    { 1433, 2 }, /* kcedilla */
+    { 761, 1 }, /* dead_horn */
+    { 1246, 1 }, /* horizlinescan5 */
+    { 424, 1 }, /* braille_dots_1567 */
+    { 391, 1 }, /* braille_dots_135 */
+    { 866, 1 }, /* equal */
+    { 2057, 1 }, /* thai_sarauee */
+    { 1962, 1 }, /* sunpagedown */
+    { 2317, 1 }, /* xf86search */
+    { 1396, 2 }, /* kana_o */
+    { 1591, 2 }, /* oacute */
+    { 1540, 1 }, /* menu */
+    { 2291, 1 }, /* xf86officehome */
+    { 1237, 1 }, /* henkan */
+    { 1177, 1 }, /* hangul_tieut */
+    { 1555, 1 }, /* musicalsharp */
+    { 153, 1 }, /* arabic_shadda */
+    { 1800, 1 }, /* rightopentriangle */
+    { 1941, 1 }, /* stickykeys_enable */
+    { 46, 1 }, /* abovedot */
+    { 2135, 2 }, /* ukrainian_ghe_with_upturn */
+    { 1169, 1 }, /* hangul_ssangkiyeog */
+    { 120, 1 }, /* arabic_hah */
+    { 1826, 1 }, /* select */
+    { 1025, 2 }, /* greek_gamma */
+    { 1847, 1 }, /* signaturemark */
+    { 475, 1 }, /* braille_dots_24568 */
+    { 19, 1 }, /* 3270_jump */
+    { 1820, 2 }, /* scircumflex */
+    { 1479, 1 }, /* l2 */
+    { 495, 1 }, /* braille_dots_267 */
+    { 2066, 1 }, /* thai_thothahan */
+    { 1784, 2 }, /* rcaron */
+    { 2367, 1 }, /* xf86yellow */
+    { 542, 1 }, /* braille_dots_46 */
+    { 984, 1 }, /* georgian_las */
+    { 316, 1 }, /* braille_dots_12345678 */
+    { 1896, 1 }, /* sinh_luu2 */
+    { 688, 2 }, /* cyrillic_shorti */
+    { 158, 1 }, /* arabic_tah */
+    { 1487, 2 }, /* lacute */
+    { 1727, 1 }, /* pointer_dblclick2 */
+    { 907, 1 }, /* f31 */
+    { 1857, 1 }, /* sinh_aee */
+    { 650, 2 }, /* cyrillic_ha_descender */
+    { 2096, 1 }, /* touroku */
+    { 1673, 1 }, /* osfnextfield */
+    { 1217, 1 }, /* hebrew_mem */
+    { 435, 1 }, /* braille_dots_178 */
+    { 1008, 2 }, /* greek_alphaaccent */
+    { 332, 1 }, /* braille_dots_123568 */
+    { 987, 1 }, /* georgian_on */
+    { 1879, 1 }, /* sinh_h2 */
+    { 1105, 1 }, /* hangul_j_hieuh */
+    { 1675, 1 }, /* osfpagedown */
+    { 347, 1 }, /* braille_dots_1245678 */
+    { 766, 1 }, /* dead_longsolidusoverlay */
+    { 276, 1 }, /* backspace */
+    { 1845, 1 }, /* shift_lock */
+    { 694, 2 }, /* cyrillic_tse */
+    { 1325, 1 }, /* iso_group_shift */
+    { 6, 1 }, /* 3270_backtab */
+    { 1469, 1 }, /* kp_separator */
+    { 1110, 1 }, /* hangul_j_kiyeogsios */
+    { 1000, 1 }, /* georgian_zen */
+    { 1690, 1 }, /* osfup */
+    { 1719, 1 }, /* pointer_accelerate */
+    { 1580, 1 }, /* notelementof */
+    { 859, 2 }, /* eng */
+    { 849, 1 }, /* emfilledcircle */
+    { 1414, 1 }, /* kana_to */
+    { 2333, 1 }, /* xf86switch_vt_12 */
+    { 1513, 1 }, /* linefeed */
+    { 1593, 2 }, /* obarred */
+    { 582, 1 }, /* caron */
+    { 484, 1 }, /* braille_dots_2478 */
+    { 1805, 1 }, /* righttack */
+    { 1958, 1 }, /* sunfa_tilde */
+    { 1028, 2 }, /* greek_iota */
+    { 362, 1 }, /* braille_dots_125678 */
+    { 1098, 1 }, /* hangul_eu */
+    { 2021, 1 }, /* thai_loling */
+    { 533, 1 }, /* braille_dots_4 */
+    { 1480, 1 }, /* l3 */
+    { 706, 2 }, /* cyrillic_ya */
+    { 171, 1 }, /* arabic_zain */
+    { 2041, 1 }, /* thai_phosamphao */
+    { 2310, 1 }, /* xf86rotationkb */
+    { 499, 1 }, /* braille_dots_278 */
+    { 632, 2 }, /* cyrillic_el */
+    { 1388, 1 }, /* kana_mo */
+    { 2393, 2 }, /* zcaron */
+    { 1244, 1 }, /* horizlinescan1 */
+    { 1916, 1 }, /* sinh_rii */
+    { 160, 1 }, /* arabic_tcheh */
+    { 842, 1 }, /* elementof */
+    { 881, 2 }, /* f */
+    { 1931, 1 }, /* sinh_ya */
+    { 1954, 1 }, /* sunfa_cedilla */
+    { 1186, 1 }, /* hangul_ye */
+    { 2020, 1 }, /* thai_lochula */
+    { 1202, 1 }, /* hebrew_daleth */
+    { 1889, 1 }, /* sinh_kha */
+    { 1566, 1 }, /* nairasign */
+    { 836, 2 }, /* ehook */
+    { 1552, 1 }, /* multiplecandidate */
+    { 2228, 1 }, /* xf86contrastadjust */
+    { 507, 1 }, /* braille_dots_34568 */
+    { 539, 1 }, /* braille_dots_457 */
+    { 1158, 1 }, /* hangul_rieulphieuf */
+    { 1473, 1 }, /* kp_up */
+    { 2244, 1 }, /* xf86go */
+    { 724, 2 }, /* dcaron */
+    { 1641, 1 }, /* onesubscript */
+    { 1225, 1 }, /* hebrew_switch */
+    { 1171, 1 }, /* hangul_ssangsios */
+    { 1486, 1 }, /* l9 */
+    { 2125, 2 }, /* uhornacute */
+    { 628, 2 }, /* cyrillic_e */
+    { 1468, 1 }, /* kp_right */
+    { 133, 1 }, /* arabic_kaf */
+    { 149, 1 }, /* arabic_rreh */
+    { 2155, 2 }, /* uogonek */
+    { 1543, 1 }, /* millsign */
+    { 1352, 2 }, /* itilde */
+    { 1342, 1 }, /* iso_partial_line_up */
+    { 2338, 1 }, /* xf86switch_vt_6 */
+    { 1326, 1 }, /* iso_last_group */
+    { 513, 1 }, /* braille_dots_34678 */
+    { 2276, 1 }, /* xf86market */
+    { 1114, 1 }, /* hangul_j_nieunhieuh */
+    { 190, 2 }, /* armenian_e */
+    { 933, 1 }, /* ffrancsign */
+    { 1678, 1 }, /* osfpageup */
+    { 852, 1 }, /* emopenrectangle */
+    { 23, 1 }, /* 3270_pa2 */
+    { 1323, 1 }, /* iso_group_latch */
+    { 1109, 1 }, /* hangul_j_kiyeog */
+    { 2068, 1 }, /* thai_thothong */
+    { 1024, 1 }, /* greek_finalsmallsigma */
+    { 2311, 1 }, /* xf86rotationpb */
+    { 1142, 1 }, /* hangul_nieun */
+    { 2042, 1 }, /* thai_popla */
+    { 1511, 1 }, /* lessthanequal */
+    { 25, 1 }, /* 3270_play */
+    { 622, 2 }, /* cyrillic_che_vertstroke */
+    { 1628, 2 }, /* ohorngrave */
+    { 1672, 1 }, /* osfmenubar */
+    { 1108, 1 }, /* hangul_j_khieuq */
+    { 1715, 1 }, /* pesetasign */
+    { 148, 1 }, /* arabic_ra */
+    { 1378, 1 }, /* kana_ka */
+    { 2164, 1 }, /* uptack */
+    { 448, 1 }, /* braille_dots_2346 */
+    { 444, 1 }, /* braille_dots_234568 */
+    { 2170, 2 }, /* v */
+    { 156, 1 }, /* arabic_superscript_alef */
+    { 488, 1 }, /* braille_dots_2567 */
+    { 626, 2 }, /* cyrillic_dzhe */
+    { 562, 1 }, /* braille_dots_78 */
+    { 1531, 2 }, /* macedonia_kje */
+    { 2352, 1 }, /* xf86ungrab */
+    { 1112, 1 }, /* hangul_j_mieum */
+    { 903, 1 }, /* f28 */
+    { 2325, 1 }, /* xf86start */
+    { 1576, 1 }, /* nl */
+    { 1312, 1 }, /* iso_center_object */
+    { 13, 1 }, /* 3270_enter */
+    { 1127, 1 }, /* hangul_j_rieultieut */
+    { 2180, 2 }, /* wacute */
+    { 2326, 1 }, /* xf86stop */
+    { 1164, 1 }, /* hangul_singlecandidate */
+    { 97, 1 }, /* arabic_5 */
+    { 1349, 1 }, /* iso_release_margin_right */
+    { 1340, 1 }, /* iso_next_group_lock */
+    { 959, 2 }, /* gcedilla */
+    { 1946, 1 }, /* sunaudiomute */
+    { 1709, 1 }, /* partialderivative */
+    { 1615, 2 }, /* oe */
+    { 1823, 1 }, /* scroll_lock */
+    { 2224, 1 }, /* xf86clear */
+    { 1964, 1 }, /* sunpaste */
+    { 1275, 1 }, /* hyper_l */
+    { 2271, 1 }, /* xf86loggrabinfo */
+    { 979, 1 }, /* georgian_in */
+    { 2241, 1 }, /* xf86frameback */
+    { 560, 1 }, /* braille_dots_68 */
+    { 2165, 2 }, /* uring */
+    { 1215, 1 }, /* hebrew_kuf */
+    { 1906, 1 }, /* sinh_nna */
+    { 2215, 1 }, /* xf86battery */
+    { 857, 1 }, /* enfilledcircbullet */
+    { 42, 2 }, /* aacute */
+    { 795, 1 }, /* doubleacute */
+    { 264, 1 }, /* asciicircum */
+    { 1038, 2 }, /* greek_lambda */
+    { 400, 1 }, /* braille_dots_1367 */
+    { 904, 1 }, /* f29 */
+    { 1647, 1 }, /* openstar */
+    { 758, 1 }, /* dead_grave */
+    { 428, 1 }, /* braille_dots_1578 */
+    { 480, 1 }, /* braille_dots_2467 */
+    { 2157, 1 }, /* up */
+    { 732, 1 }, /* dead_abovedot */
+    { 2255, 1 }, /* xf86launch1 */
+    { 157, 1 }, /* arabic_switch */
+    { 277, 1 }, /* backtab */
+    { 1175, 1 }, /* hangul_sunkyeongeumpieub */
+    { 457, 1 }, /* braille_dots_23567 */
+    { 680, 2 }, /* cyrillic_schwa */
+    { 176, 1 }, /* armenian_apostrophe */
+    { 2267, 1 }, /* xf86launchd */
+    { 69, 2 }, /* acircumflexhook */
+    { 1739, 1 }, /* pointer_drag3 */
+    { 864, 2 }, /* eogonek */
+    { 2285, 1 }, /* xf86music */
+    { 1292, 1 }, /* idotless */
+    { 1866, 1 }, /* sinh_ca */
+    { 1822, 1 }, /* script_switch */
+    { 1143, 1 }, /* hangul_nieunhieuh */
+    { 86, 1 }, /* ampersand */
+    { 1542, 1 }, /* meta_r */
+    { 1764, 2 }, /* r */
+    { 1154, 1 }, /* hangul_rieul */
+    { 1969, 1 }, /* sunstop */
+    { 522, 1 }, /* braille_dots_3568 */
+    { 16, 1 }, /* 3270_exselect */
+    { 1696, 1 }, /* overlay1_enable */
+    { 1883, 1 }, /* sinh_ii */
+    { 1548, 1 }, /* mousekeys_enable */
+    { 414, 1 }, /* braille_dots_1458 */
+    { 2283, 1 }, /* xf86monbrightnessdown */
+    { 793, 1 }, /* dongsign */
+    { 1307, 1 }, /* integral */
+    { 1595, 2 }, /* obelowdot */
+    { 922, 1 }, /* farsi_2 */
+    { 333, 1 }, /* braille_dots_12357 */
+    { 1330, 1 }, /* iso_level3_latch */
+    { 426, 1 }, /* braille_dots_1568 */
+    { 2167, 1 }, /* user */
+    { 2324, 1 }, /* xf86standby */
+    { 29, 1 }, /* 3270_reset */
+    { 851, 1 }, /* emopencircle */
+    { 1986, 2 }, /* tcedilla */
+    { 2239, 1 }, /* xf86finance */
+    { 1816, 2 }, /* scedilla */
+    { 1157, 1 }, /* hangul_rieulmieum */
+    { 829, 2 }, /* ecircumflextilde */
+    { 1432, 1 }, /* katakana */
+    { 1710, 1 }, /* pause */
+    { 483, 1 }, /* braille_dots_247 */
+    { 322, 1 }, /* braille_dots_123467 */
+    { 1804, 1 }, /* rightt */
+    { 1390, 1 }, /* kana_n */
+    { 668, 2 }, /* cyrillic_ka_vertstroke */
+    { 590, 1 }, /* cent */
+    { 936, 1 }, /* filledrectbullet */
+    { 14, 1 }, /* 3270_eraseeof */
+    { 18, 1 }, /* 3270_ident */
+    { 1406, 1 }, /* kana_shi */
+    { 1248, 1 }, /* horizlinescan9 */
+    { 374, 1 }, /* braille_dots_13 */
+    { 1387, 1 }, /* kana_middledot */
+    { 209, 2 }, /* armenian_ke */
+    { 993, 1 }, /* georgian_shin */
+    { 934, 1 }, /* figdash */
+    { 1659, 1 }, /* osfcopy */
+    { 24, 1 }, /* 3270_pa3 */
+    { 292, 1 }, /* botvertsummationconnector */
+    { 1653, 1 }, /* osfbackspace */
+    { 742, 1 }, /* dead_belowmacron */
+    { 2160, 1 }, /* upleftcorner */
+    { 794, 1 }, /* doubbaselinedot */
+    { 432, 1 }, /* braille_dots_1678 */
+    { 369, 1 }, /* braille_dots_12678 */
+    { 169, 1 }, /* arabic_yeh_baree */
+    { 131, 1 }, /* arabic_jeem */
+    { 890, 1 }, /* f16 */
+    { 1193, 2 }, /* hcircumflex */
+    { 983, 1 }, /* georgian_khar */
+    { 473, 1 }, /* braille_dots_24567 */
+    { 442, 1 }, /* braille_dots_234567 */
+    { 980, 1 }, /* georgian_jhan */
+    { 754, 1 }, /* dead_doubleacute */
+    { 1894, 1 }, /* sinh_lu2 */
+    { 35, 1 }, /* 5 */
+    { 801, 1 }, /* downshoe */
+    { 1010, 2 }, /* greek_beta */
+    { 2227, 1 }, /* xf86community */
+    { 1564, 2 }, /* nacute */
+    { 140, 1 }, /* arabic_maddaonalef */
+    { 1508, 1 }, /* leftt */
+    { 662, 2 }, /* cyrillic_je */
+    { 710, 2 }, /* cyrillic_yu */
+    { 1092, 1 }, /* hangul_cieuc */
+    { 1245, 1 }, /* horizlinescan3 */
+    { 1837, 2 }, /* serbian_nje */
+    { 863, 1 }, /* enspace */
+    { 1159, 1 }, /* hangul_rieulpieub */
+    { 471, 1 }, /* braille_dots_245 */
+    { 320, 1 }, /* braille_dots_123458 */
+    { 549, 1 }, /* braille_dots_5 */
+    { 2038, 1 }, /* thai_phinthu */
+    { 336, 1 }, /* braille_dots_1236 */
+    { 2247, 1 }, /* xf86history */
+    { 773, 1 }, /* dead_psili */
+    { 1181, 1 }, /* hangul_we */
+    { 832, 2 }, /* ediaeresis */
+    { 1824, 1 }, /* seconds */
+    { 1646, 1 }, /* openrectbullet */
+    { 1162, 1 }, /* hangul_rieulyeorinhieuh */
+    { 433, 1 }, /* braille_dots_168 */
+    { 1427, 2 }, /* kana_yu */
+    { 1212, 1 }, /* hebrew_he */
+    { 1957, 1 }, /* sunfa_grave */
+    { 253, 2 }, /* armenian_vo */
+    { 995, 1 }, /* georgian_tar */
+    { 1738, 1 }, /* pointer_drag2 */
+    { 1520, 1 }, /* lowrightcorner */
+    { 2365, 1 }, /* xf86www */
+    { 640, 2 }, /* cyrillic_er */
+    { 377, 1 }, /* braille_dots_13456 */
+    { 1356, 2 }, /* jcircumflex */
+    { 2300, 1 }, /* xf86prev_vmode */
+    { 98, 1 }, /* arabic_6 */
+    { 2298, 1 }, /* xf86powerdown */
+    { 1561, 2 }, /* n */
+    { 186, 2 }, /* armenian_da */
+    { 2277, 1 }, /* xf86meeting */
+    { 1909, 1 }, /* sinh_o2 */
+    { 78, 2 }, /* agrave */
+    { 755, 1 }, /* dead_doublegrave */
+    { 753, 1 }, /* dead_diaeresis */
+    { 134, 1 }, /* arabic_kasra */
+    { 1589, 2 }, /* o */
+    { 1844, 1 }, /* shift_l */
+    { 1772, 1 }, /* r15 */
+    { 2258, 1 }, /* xf86launch4 */
+    { 1683, 1 }, /* osfquickpaste */
+    { 878, 1 }, /* ext16bit_r */
+    { 778, 2 }, /* dead_u */
+    { 2348, 1 }, /* xf86touchpadoff */
+    { 2012, 1 }, /* thai_lekhok */
+    { 109, 1 }, /* arabic_damma */
+    { 891, 1 }, /* f17 */
+    { 1364, 1 }, /* kana_closingbracket */
+    { 1801, 1 }, /* rightpointer */
+    { 2304, 1 }, /* xf86reload */
+    { 2260, 1 }, /* xf86launch6 */
+    { 1786, 2 }, /* rcedilla */
+    { 381, 1 }, /* braille_dots_13457 */
+    { 1252, 1 }, /* hpdeletechar */
+    { 1439, 1 }, /* kp_3 */
+    { 769, 2 }, /* dead_o */
+    { 1285, 2 }, /* ibreve */
+    { 1394, 1 }, /* kana_no */
+    { 1654, 1 }, /* osfbacktab */
+    { 609, 1 }, /* crossinglines */
+    { 1976, 1 }, /* super_r */
+    { 2152, 1 }, /* underscore */
+    { 115, 1 }, /* arabic_feh */
+    { 125, 1 }, /* arabic_hamzaonwaw */
+    { 376, 1 }, /* braille_dots_1345 */
+    { 1294, 2 }, /* igrave */
+    { 1374, 1 }, /* kana_ho */
+    { 2240, 1 }, /* xf86forward */
+    { 652, 2 }, /* cyrillic_hardsign */
+    { 2391, 2 }, /* zacute */
+    { 323, 1 }, /* braille_dots_1234678 */
+    { 943, 1 }, /* fivesixths */
+    { 1500, 1 }, /* leftcaret */
+    { 2011, 1 }, /* thai_lekha */
+    { 734, 1 }, /* dead_abovering */
+    { 1190, 1 }, /* hangul_yo */
+    { 1069, 2 }, /* greek_upsilon */
+    { 2313, 1 }, /* xf86screensaver */
+    { 840, 1 }, /* eisu_shift */
+    { 257, 2 }, /* armenian_yech */
+    { 1209, 1 }, /* hebrew_finalzadi */
+    { 380, 1 }, /* braille_dots_134568 */
+    { 1444, 1 }, /* kp_8 */
+    { 1277, 1 }, /* hyphen */
+    { 861, 1 }, /* enopencircbullet */
+    { 1150, 1 }, /* hangul_pieubsios */
+    { 456, 1 }, /* braille_dots_2356 */
+    { 1948, 1 }, /* suncompose */
+    { 676, 2 }, /* cyrillic_o_bar */
+    { 2127, 2 }, /* uhornbelowdot */
+    { 477, 1 }, /* braille_dots_24578 */
+    { 1373, 1 }, /* kana_hi */
+    { 224, 1 }, /* armenian_paruyk */
+    { 1921, 1 }, /* sinh_ssha */
+    { 1042, 2 }, /* greek_mu */
+    { 2370, 2 }, /* y */
+    { 682, 2 }, /* cyrillic_sha */
+    { 1327, 1 }, /* iso_last_group_lock */
+    { 246, 2 }, /* armenian_tso */
+    { 359, 1 }, /* braille_dots_125 */
+    { 985, 1 }, /* georgian_man */
+    { 225, 2 }, /* armenian_pe */
+    { 2018, 1 }, /* thai_leksong */
+    { 1266, 1 }, /* hpmute_diaeresis */
+    { 1409, 1 }, /* kana_su */
+    { 2168, 2 }, /* utilde */
+    { 686, 2 }, /* cyrillic_shha */
+    { 2202, 1 }, /* xf86audionext */
+    { 458, 1 }, /* braille_dots_235678 */
+    { 2009, 1 }, /* thai_lakkhangyao */
+    { 1097, 1 }, /* hangul_eo */
+    { 1864, 1 }, /* sinh_ba */
+    { 1839, 2 }, /* serbian_tshe */
+    { 567, 2 }, /* byelorussian_shortu */
+    { 541, 1 }, /* braille_dots_458 */
+    { 788, 1 }, /* diamond */
+    { 2342, 1 }, /* xf86taskpane */
+    { 91, 1 }, /* approximate */
+    { 1446, 1 }, /* kp_add */
+    { 1993, 1 }, /* thai_chochan */
+    { 387, 1 }, /* braille_dots_13468 */
+    { 2327, 1 }, /* xf86subtitle */
+    { 1734, 1 }, /* pointer_down */
+    { 664, 2 }, /* cyrillic_ka */
+    { 967, 1 }, /* georgian_chin */
+    { 267, 1 }, /* at */
+    { 1773, 1 }, /* r2 */
+    { 80, 2 }, /* ahook */
+    { 101, 1 }, /* arabic_9 */
+    { 1735, 1 }, /* pointer_downleft */
+    { 1755, 1 }, /* punctspace */
+    { 1477, 1 }, /* l1 */
+    { 1016, 2 }, /* greek_epsilon */
+    { 1670, 1 }, /* osfleft */
+    { 1278, 2 }, /* i */
+    { 2115, 2 }, /* udiaeresis */
+    { 749, 1 }, /* dead_cedilla */
+    { 239, 1 }, /* armenian_shesht */
+    { 1359, 2 }, /* k */
+    { 1380, 1 }, /* kana_ki */
+    { 415, 1 }, /* braille_dots_146 */
+    { 502, 1 }, /* braille_dots_34 */
+    { 1860, 1 }, /* sinh_ai2 */
+    { 1199, 1 }, /* hebrew_beth */
+    { 341, 1 }, /* braille_dots_12378 */
+    { 94, 1 }, /* arabic_2 */
+    { 834, 2 }, /* egrave */
+    { 1989, 1 }, /* telephonerecorder */
+    { 1256, 1 }, /* hpinsertline */
+    { 1886, 1 }, /* sinh_jha */
+    { 1910, 1 }, /* sinh_oo */
+    { 2362, 1 }, /* xf86wheelbutton */
+    { 2094, 1 }, /* topt */
+    { 108, 1 }, /* arabic_dal */
+    { 550, 1 }, /* braille_dots_56 */
+    { 481, 1 }, /* braille_dots_24678 */
+    { 1151, 1 }, /* hangul_posthanja */
+    { 1232, 1 }, /* hebrew_zade */
+    { 2062, 1 }, /* thai_sosua */
+    { 1514, 1 }, /* lira */
+    { 1085, 1 }, /* hairspace */
+    { 371, 1 }, /* braille_dots_127 */
+    { 955, 2 }, /* gbreve */
+    { 972, 1 }, /* georgian_gan */
+    { 1321, 1 }, /* iso_first_group */
+    { 2335, 1 }, /* xf86switch_vt_3 */
+    { 2061, 1 }, /* thai_soso */
+    { 1258, 1 }, /* hpkp_backtab */
+    { 1018, 2 }, /* greek_epsilonaccent */
+    { 1870, 1 }, /* sinh_dha */
+    { 775, 1 }, /* dead_small_schwa */
+    { 1339, 1 }, /* iso_next_group */
+    { 1665, 1 }, /* osfendline */
+    { 1141, 1 }, /* hangul_multiplecandidate */
+    { 2303, 1 }, /* xf86refresh */
+    { 953, 2 }, /* gabovedot */
+    { 930, 1 }, /* farsi_yeh */
+    { 2355, 1 }, /* xf86userpb */
+    { 1828, 1 }, /* semivoicedsound */
+    { 1873, 1 }, /* sinh_e2 */
+    { 459, 1 }, /* braille_dots_23568 */
+    { 2268, 1 }, /* xf86launche */
+    { 1096, 1 }, /* hangul_end */
+    { 1841, 1 }, /* seveneighths */
+    { 2177, 1 }, /* vt */
+    { 1573, 1 }, /* next_virtual_screen */
+    { 389, 1 }, /* braille_dots_13478 */
+    { 27, 1 }, /* 3270_quit */
+    { 39, 1 }, /* 9 */
+    { 135, 1 }, /* arabic_kasratan */
+    { 427, 1 }, /* braille_dots_157 */
+    { 1856, 1 }, /* sinh_ae2 */
+    { 1123, 1 }, /* hangul_j_rieulmieum */
+    { 780, 1 }, /* dead_voiced_sound */
+    { 1253, 1 }, /* hpdeleteline */
+    { 482, 1 }, /* braille_dots_2468 */
+    { 105, 1 }, /* arabic_beh */
+    { 1814, 2 }, /* scaron */
+    { 21, 1 }, /* 3270_left2 */
+    { 1435, 1 }, /* korean_won */
+    { 404, 1 }, /* braille_dots_1378 */
+    { 365, 1 }, /* braille_dots_12578 */
+    { 1290, 2 }, /* idiaeresis */
+    { 31, 1 }, /* 3270_rule */
+    { 1354, 2 }, /* j */
+    { 1495, 2 }, /* lcedilla */
+    { 806, 2 }, /* dstroke */
+    { 803, 1 }, /* downtack */
+    { 605, 1 }, /* control_l */
+    { 2121, 2 }, /* uhook */
+    { 1512, 1 }, /* lf */
+    { 929, 1 }, /* farsi_9 */
+    { 714, 2 }, /* cyrillic_zhe */
+    { 616, 2 }, /* cyrillic_be */
+    { 2077, 3 }, /* thorn */
+    { 554, 1 }, /* braille_dots_57 */
+    { 453, 1 }, /* braille_dots_23478 */
+    { 1812, 2 }, /* sacute */
+    { 991, 1 }, /* georgian_rae */
+    { 898, 1 }, /* f23 */
+    { 1541, 1 }, /* meta_l */
+    { 2376, 2 }, /* ycircumflex */
+    { 1050, 2 }, /* greek_omicron */
+    { 1666, 1 }, /* osfescape */
+    { 1553, 1 }, /* multiply */
+    { 921, 1 }, /* farsi_1 */
+    { 285, 1 }, /* botleftparens */
+    { 1863, 1 }, /* sinh_au2 */
+    { 2093, 1 }, /* toprightsummation */
+    { 2346, 1 }, /* xf86tools */
+    { 2091, 1 }, /* toprightparens */
+    { 1506, 1 }, /* leftshoe */
+    { 474, 1 }, /* braille_dots_245678 */
+    { 602, 1 }, /* colonsign */
+    { 1766, 1 }, /* r1 */
+    { 301, 1 }, /* braille_dot_2 */
+    { 2309, 1 }, /* xf86rotatewindows */
+    { 310, 1 }, /* braille_dots_12 */
+    { 410, 1 }, /* braille_dots_145678 */
+    { 17, 1 }, /* 3270_fieldmark */
+    { 1205, 1 }, /* hebrew_finalmem */
+    { 917, 1 }, /* f9 */
+    { 293, 1 }, /* bouncekeys_enable */
+    { 1376, 2 }, /* kana_i */
+    { 1686, 1 }, /* osfright */
+    { 897, 1 }, /* f22 */
+    { 1183, 1 }, /* hangul_wi */
+    { 1630, 2 }, /* ohornhook */
+    { 1113, 1 }, /* hangul_j_nieun */
+    { 2354, 1 }, /* xf86user2kb */
+    { 403, 1 }, /* braille_dots_137 */
+    { 1361, 2 }, /* kana_a */
+    { 2040, 1 }, /* thai_phophung */
+    { 557, 1 }, /* braille_dots_6 */
+    { 1459, 1 }, /* kp_f4 */
+    { 1984, 2 }, /* tcaron */
+    { 1260, 1 }, /* hplongminus */
+    { 1771, 1 }, /* r14 */
+    { 2034, 1 }, /* thai_nonen */
+    { 2316, 1 }, /* xf86scrollup */
+    { 642, 2 }, /* cyrillic_es */
+    { 2082, 1 }, /* threequarters */
+    { 986, 1 }, /* georgian_nar */
+    { 789, 1 }, /* digitspace */
+    { 1588, 1 }, /* numerosign */
+    { 2246, 1 }, /* xf86hibernate */
+    { 2036, 1 }, /* thai_oang */
+    { 964, 1 }, /* georgian_ban */
+    { 704, 2 }, /* cyrillic_ve */
+    { 783, 1 }, /* delete */
+    { 1922, 1 }, /* sinh_tha */
+    { 1920, 1 }, /* sinh_sha */
+    { 767, 1 }, /* dead_lowline */
+    { 1905, 1 }, /* sinh_nja */
+    { 910, 1 }, /* f34 */
+    { 1897, 1 }, /* sinh_ma */
+    { 273, 2 }, /* babovedot */
+    { 1052, 2 }, /* greek_omicronaccent */
+    { 1263, 1 }, /* hpmute_acute */
+    { 467, 1 }, /* braille_dots_237 */
+    { 1669, 1 }, /* osfinsert */
+    { 2075, 1 }, /* therefore */
+    { 924, 1 }, /* farsi_4 */
+    { 1365, 1 }, /* kana_comma */
+    { 915, 1 }, /* f7 */
+    { 2211, 1 }, /* xf86audiostop */
+    { 418, 1 }, /* braille_dots_1468 */
+    { 1119, 1 }, /* hangul_j_pieubsios */
+    { 305, 1 }, /* braille_dot_6 */
+    { 1178, 1 }, /* hangul_u */
+    { 1399, 1 }, /* kana_ra */
+    { 760, 1 }, /* dead_hook */
+    { 2001, 1 }, /* thai_hohip */
+    { 1759, 1 }, /* question */
+    { 1062, 2 }, /* greek_sigma */
+    { 1951, 1 }, /* sunf36 */
+    { 2343, 1 }, /* xf86terminal */
+    { 1712, 1 }, /* period */
+    { 146, 1 }, /* arabic_qaf */
+    { 129, 1 }, /* arabic_heh_doachashmee */
+    { 346, 1 }, /* braille_dots_124567 */
+    { 813, 2 }, /* eacute */
+    { 670, 2 }, /* cyrillic_lje */
+    { 1965, 1 }, /* sunpowerswitch */
+    { 1198, 1 }, /* hebrew_bet */
+    { 373, 1 }, /* braille_dots_128 */
+    { 384, 1 }, /* braille_dots_1346 */
+    { 737, 1 }, /* dead_belowbreve */
+    { 585, 2 }, /* ccedilla */
+    { 340, 1 }, /* braille_dots_1237 */
+    { 117, 1 }, /* arabic_gaf */
+    { 607, 1 }, /* copyright */
+    { 1335, 1 }, /* iso_level5_shift */
+    { 53, 2 }, /* abrevegrave */
+    { 2158, 1 }, /* uparrow */
+    { 2256, 1 }, /* xf86launch2 */
+    { 2213, 1 }, /* xf86back */
+    { 974, 1 }, /* georgian_hae */
+    { 1214, 1 }, /* hebrew_kaph */
+    { 2279, 1 }, /* xf86menukb */
+    { 796, 1 }, /* doubledagger */
+    { 288, 1 }, /* botrightparens */
+    { 556, 1 }, /* braille_dots_58 */
+    { 141, 1 }, /* arabic_meem */
+    { 2265, 1 }, /* xf86launchb */
+    { 1117, 1 }, /* hangul_j_phieuf */
+    { 2208, 1 }, /* xf86audiorecord */
+    { 1115, 1 }, /* hangul_j_nieunjieuj */
+    { 1677, 1 }, /* osfpageright */
+    { 666, 2 }, /* cyrillic_ka_descender */
+    { 2149, 2 }, /* umacron */
+    { 317, 1 }, /* braille_dots_1234568 */
+    { 1419, 2 }, /* kana_u */
+    { 702, 2 }, /* cyrillic_u_straight_bar */
+    { 1305, 1 }, /* insertchar */
+    { 1943, 1 }, /* sunagain */
+    { 1188, 1 }, /* hangul_yeorinhieuh */
+    { 1499, 1 }, /* leftarrow */
+    { 460, 1 }, /* braille_dots_2357 */
+    { 1384, 1 }, /* kana_ma */
+    { 1106, 1 }, /* hangul_j_ieung */
+    { 2070, 1 }, /* thai_topatak */
+    { 126, 1 }, /* arabic_hamzaonyeh */
+    { 2323, 1 }, /* xf86splitscreen */
+    { 871, 2 }, /* etilde */
+    { 306, 1 }, /* braille_dot_7 */
+    { 2286, 1 }, /* xf86mycomputer */
+    { 26, 1 }, /* 3270_printscreen */
+    { 613, 1 }, /* cursor */
+    { 1744, 1 }, /* pointer_left */
+    { 564, 1 }, /* break */
+    { 1233, 1 }, /* hebrew_zadi */
+    { 2374, 2 }, /* ybelowdot */
+    { 1267, 1 }, /* hpmute_grave */
+    { 2059, 1 }, /* thai_sorusi */
+    { 61, 2 }, /* acircumflex */
+    { 2261, 1 }, /* xf86launch7 */
+    { 1775, 1 }, /* r4 */
+    { 1544, 1 }, /* minus */
+    { 2340, 1 }, /* xf86switch_vt_8 */
+    { 250, 1 }, /* armenian_verjaket */
+    { 102, 1 }, /* arabic_ain */
+    { 1881, 1 }, /* sinh_i */
+    { 168, 1 }, /* arabic_yeh */
+    { 1699, 2 }, /* p */
+    { 1713, 1 }, /* periodcentered */
+    { 2233, 1 }, /* xf86documents */
+    { 939, 1 }, /* filledtribulletup */
+    { 569, 2 }, /* c */
+    { 2086, 1 }, /* topintegral */
+    { 196, 2 }, /* armenian_ghat */
+    { 1637, 1 }, /* onefifth */
+    { 1944, 1 }, /* sunaltgraph */
+    { 912, 1 }, /* f4 */
+    { 1138, 1 }, /* hangul_kiyeogsios */
+    { 996, 1 }, /* georgian_un */
+    { 1952, 1 }, /* sunf37 */
+    { 1777, 1 }, /* r6 */
+    { 2201, 1 }, /* xf86audiomute */
+    { 268, 2 }, /* atilde */
+    { 372, 1 }, /* braille_dots_1278 */
+    { 1014, 2 }, /* greek_delta */
+    { 1430, 1 }, /* kanji_bangou */
+    { 1966, 1 }, /* sunpowerswitchshift */
+    { 379, 1 }, /* braille_dots_1345678 */
+    { 1203, 1 }, /* hebrew_doublelowline */
+    { 1977, 1 }, /* sys_req */
+    { 746, 1 }, /* dead_breve */
+    { 1704, 1 }, /* page_up */
+    { 2380, 1 }, /* yen */
+    { 1131, 1 }, /* hangul_j_tieut */
+    { 1221, 1 }, /* hebrew_resh */
+    { 2295, 1 }, /* xf86paste */
+    { 1660, 1 }, /* osfcut */
+    { 1156, 1 }, /* hangul_rieulkiyeog */
+    { 530, 1 }, /* braille_dots_37 */
+    { 868, 3 }, /* eth */
+    { 576, 2 }, /* cacute */
+    { 1485, 1 }, /* l8 */
+    { 815, 2 }, /* ebelowdot */
+    { 2269, 1 }, /* xf86launchf */
+    { 28, 1 }, /* 3270_record */
+    { 940, 1 }, /* find */
+    { 1391, 1 }, /* kana_na */
+    { 2026, 1 }, /* thai_maihanakat_maitho */
+    { 658, 2 }, /* cyrillic_ie */
+    { 172, 2 }, /* aring */
+    { 76, 2 }, /* ae */
+    { 553, 1 }, /* braille_dots_568 */
+    { 1170, 1 }, /* hangul_ssangpieub */
+    { 1410, 1 }, /* kana_switch */
+    { 1603, 2 }, /* ocircumflexbelowdot */
+    { 1429, 1 }, /* kanji */
+    { 1438, 1 }, /* kp_2 */
+    { 610, 1 }, /* cruzeirosign */
+    { 2054, 1 }, /* thai_sarao */
+    { 1408, 1 }, /* kana_so */
+    { 441, 1 }, /* braille_dots_23456 */
+    { 2033, 1 }, /* thai_nikhahit */
+    { 2230, 1 }, /* xf86cut */
+    { 1913, 1 }, /* sinh_pha */
+    { 2364, 1 }, /* xf86word */
+    { 2328, 1 }, /* xf86support */
+};
+
+/* Indices into name_to_keysym. */
+static const uint16_t name_first_char_index[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    2, 3, 34, 35, 36, 37, 38, 39, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 271, 569,
+    718, 809, 881, 951, 1083, 1278, 1354, 1359, 1475, 1523,
+    1561, 1589, 1699, 1756, 1764, 1808, 1979, 2105, 2170, 2178,
+    2189, 2370, 2387, 2402, 2402, 2402, 2402, 2402, 2402,
+};
+
+/* Page of keysym_class_pages for each high byte. */
+static const uint8_t keysym_class_page_index[] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0,
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 19,
+};
+
+/* The enum xkb_keysym_class of each low byte. */
+static const uint8_t keysym_class_pages[][256] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,
+        0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20,
+        0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+        0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20,
+        0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20,
+        0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20,
+        0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x20,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+        0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+        0x22, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+        0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+        0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x02, 0x02, 0x22, 0x04, 0x04,
+        0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+        0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+        0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+};
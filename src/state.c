@@ -61,6 +61,7 @@
 
 #include "keymap.h"
 #include "keysym.h"
+#include "stats.h"
 #include "utf8.h"
 
 struct xkb_filter {
@@ -251,6 +252,7 @@ xkb_filter_new(struct xkb_state *state)
         filter = &darray_item(state->filters, darray_size(state->filters) -1);
     }
 
+    stats_count(state->keymap->ctx, filters_created, 1);
     filter->refcnt = 1;
     return filter;
 }
@@ -617,6 +619,7 @@ xkb_state_led_update_all(struct xkb_state *state)
     xkb_led_index_t idx;
     const struct xkb_led *led;
 
+    stats_count(state->keymap->ctx, led_updates, 1);
     state->components.leds = 0;
 
     xkb_leds_enumerate(idx, led, state->keymap) {
@@ -984,6 +987,7 @@ xkb_state_key_get_utf8(struct xkb_state *state, xkb_keycode_t kc,
     const xkb_keysym_t *syms;
     int nsyms;
     int offset;
+    uint32_t cp;
     char tmp[7];
 
     sym = get_one_sym_for_string(state, kc);
@@ -997,11 +1001,15 @@ xkb_state_key_get_utf8(struct xkb_state *state, xkb_keycode_t kc,
     /* Make sure not to truncate in the middle of a UTF-8 sequence. */
     offset = 0;
     for (int i = 0; i < nsyms; i++) {
-        int ret = xkb_keysym_to_utf8(syms[i], tmp, sizeof(tmp));
-        if (ret <= 0)
+        int ret;
+
+        /* Valid codepoints make valid UTF-8, so there is no need to check
+         * the result. */
+        cp = xkb_keysym_to_utf32(syms[i]);
+        if (cp == 0 || utf32_utf8_length(cp) == 0)
             goto err_bad;
 
-        ret--;
+        ret = utf32_to_utf8(cp, tmp) - 1;
         if ((size_t) (offset + ret) <= size)
             memcpy(buffer + offset, tmp, ret);
         offset += ret;
@@ -1011,9 +1019,6 @@ xkb_state_key_get_utf8(struct xkb_state *state, xkb_keycode_t kc,
         goto err_trunc;
     buffer[offset] = '\0';
 
-    if (!is_valid_utf8(buffer, offset))
-        goto err_bad;
-
     if (offset == 1 && (unsigned int) buffer[0] <= 127u &&
         should_do_ctrl_transformation(state, kc))
         buffer[0] = XkbToControl(buffer[0]);
@@ -1134,13 +1139,8 @@ xkb_state_mod_index_is_active(struct xkb_state *state,
  * xkb_state_mod_names_are_active.
  */
 static int
-match_mod_masks(struct xkb_state *state,
-                enum xkb_state_component type,
-                enum xkb_state_match match,
-                xkb_mod_mask_t wanted)
+match_masks(uint32_t active, enum xkb_state_match match, uint32_t wanted)
 {
-    xkb_mod_mask_t active = xkb_state_serialize_mods(state, type);
-
     if (!(match & XKB_STATE_MATCH_NON_EXCLUSIVE) && (active & ~wanted))
         return 0;
 
@@ -1152,6 +1152,36 @@ match_mod_masks(struct xkb_state *state,
     return 0;
 }
 
+static int
+match_mod_masks(struct xkb_state *state,
+                enum xkb_state_component type,
+                enum xkb_state_match match,
+                xkb_mod_mask_t wanted)
+{
+    xkb_mod_mask_t active = xkb_state_serialize_mods(state, type);
+
+    return match_masks(active, match, wanted);
+}
+
+/**
+ * Returns 1 if the modifiers in the mask are active with the specified
+ * type(s), 0 if not, or -1 if the mask is empty or contains invalid
+ * modifiers.
+ */
+XKB_EXPORT int
+xkb_state_mod_mask_is_active(struct xkb_state *state, xkb_mod_mask_t mask,
+                             enum xkb_state_component type,
+                             enum xkb_state_match match)
+{
+    xkb_mod_index_t num_mods = xkb_keymap_num_mods(state->keymap);
+
+    /* An empty mask usually comes from a name which wasn't found. */
+    if (mask == 0 || (num_mods < 32 && (mask >> num_mods) != 0))
+        return -1;
+
+    return match_mod_masks(state, type, match, mask);
+}
+
 /**
  * Returns 1 if the modifiers are active with the specified type(s), 0 if
  * not, or -1 if any of the modifiers are invalid.
@@ -1307,6 +1337,20 @@ xkb_state_led_name_is_active(struct xkb_state *state, const char *name)
     return xkb_state_led_index_is_active(state, idx);
 }
 
+/**
+ * Returns 1 if the LEDs in the mask are active, 0 if not, or -1 if the
+ * mask is empty or contains invalid LEDs.
+ */
+XKB_EXPORT int
+xkb_state_led_mask_is_active(struct xkb_state *state, xkb_led_mask_t mask,
+                             enum xkb_state_match match)
+{
+    if (mask == 0 || (mask & ~state->keymap->valid_leds))
+        return -1;
+
+    return match_masks(state->components.leds, match, mask);
+}
+
 static xkb_mod_mask_t
 key_get_consumed(struct xkb_state *state, const struct xkb_key *key)
 {
@@ -0,0 +1,196 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <time.h>
+
+#include "keymap.h"
+#include "stats.h"
+
+#ifdef HAVE_PTHREAD
+#define fetch_add(ptr, val) __atomic_fetch_add((ptr), (val), __ATOMIC_RELAXED)
+#define load_relaxed(ptr) __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define store_relaxed(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELAXED)
+#define compare_exchange(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), true, \
+                                __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+#define fetch_add(ptr, val) ((*(ptr) += (val)) - (val))
+#define load_relaxed(ptr) (*(ptr))
+#define store_relaxed(ptr, val) (*(ptr) = (val))
+#define compare_exchange(ptr, expected, desired) \
+    (*(ptr) == *(expected) ? (*(ptr) = (desired), true) : false)
+#endif
+
+uint64_t
+stats_now(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 1;
+
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+void
+stats_add(uint64_t *counter, uint64_t value)
+{
+    fetch_add(counter, value);
+}
+
+void
+stats_max(uint64_t *counter, uint64_t value)
+{
+    uint64_t old = load_relaxed(counter);
+
+    while (old < value && !compare_exchange(counter, &old, value))
+        ;
+}
+
+static void
+update_atoms(struct context_stats *stats, struct xkb_context *ctx)
+{
+    store_relaxed(&stats->totals.atoms_interned,
+                  atom_table_size(ctx->atom_table) -
+                  load_relaxed(&stats->atoms_base));
+}
+
+/*
+ * All of the fields are counters of the same type, which other threads
+ * may be updating; copy them one by one.
+ */
+static void
+copy_totals(struct xkb_context_stats *out, const struct xkb_context_stats *in)
+{
+    const uint64_t *from = (const uint64_t *) in;
+    uint64_t *to = (uint64_t *) out;
+
+    for (size_t i = 0; i < sizeof(*out) / sizeof(*to); i++)
+        to[i] = load_relaxed(&from[i]);
+}
+
+void
+stats_compile_begin(struct xkb_context *ctx, struct stats_compile *compile)
+{
+    struct context_stats *stats = ctx->stats;
+
+    compile->start = 0;
+    if (!stats)
+        return;
+
+    update_atoms(stats, ctx);
+    store_relaxed(&stats->include_depth, 0);
+    copy_totals(&compile->before, &stats->totals);
+    compile->start = stats_now();
+}
+
+void
+stats_compile_end(struct xkb_context *ctx, struct stats_compile *compile,
+                  bool ok)
+{
+    struct context_stats *stats = ctx->stats;
+    struct xkb_context_stats diff;
+    const uint64_t *before;
+    uint64_t *out;
+    uint64_t include_depth;
+
+    if (!stats || compile->start == 0)
+        return;
+
+    include_depth = load_relaxed(&stats->include_depth);
+    if (ok)
+        stats_add(&stats->totals.keymaps_compiled, 1);
+    stats_add(&stats->totals.compile_time, stats_now() - compile->start);
+    stats_max(&stats->totals.max_include_depth, include_depth);
+    update_atoms(stats, ctx);
+
+    if (!ctx->stats_fn)
+        return;
+
+    copy_totals(&diff, &stats->totals);
+    before = (const uint64_t *) &compile->before;
+    out = (uint64_t *) &diff;
+    for (size_t i = 0; i < sizeof(diff) / sizeof(*out); i++)
+        out[i] -= before[i];
+    diff.max_include_depth = include_depth;
+
+    ctx->stats_fn(ctx, &diff, ctx->stats_fn_data);
+}
+
+XKB_EXPORT int
+xkb_context_set_stats_enabled(struct xkb_context *ctx, int enabled)
+{
+    if (!enabled) {
+        free(ctx->stats);
+        ctx->stats = NULL;
+        return 1;
+    }
+
+    if (ctx->stats)
+        return 1;
+
+    ctx->stats = calloc(1, sizeof(*ctx->stats));
+    if (!ctx->stats)
+        return 0;
+
+    ctx->stats->atoms_base = atom_table_size(ctx->atom_table);
+    return 1;
+}
+
+XKB_EXPORT int
+xkb_context_get_stats(struct xkb_context *ctx,
+                      struct xkb_context_stats *stats_out)
+{
+    if (!ctx->stats) {
+        memset(stats_out, 0, sizeof(*stats_out));
+        return 0;
+    }
+
+    update_atoms(ctx->stats, ctx);
+    copy_totals(stats_out, &ctx->stats->totals);
+    return 1;
+}
+
+XKB_EXPORT void
+xkb_context_reset_stats(struct xkb_context *ctx)
+{
+    struct context_stats *stats = ctx->stats;
+    uint64_t *counters;
+
+    if (!stats)
+        return;
+
+    counters = (uint64_t *) &stats->totals;
+    for (size_t i = 0; i < sizeof(stats->totals) / sizeof(*counters); i++)
+        store_relaxed(&counters[i], 0);
+    store_relaxed(&stats->atoms_base, atom_table_size(ctx->atom_table));
+    store_relaxed(&stats->include_depth, 0);
+}
+
+XKB_EXPORT void
+xkb_context_set_stats_fn(struct xkb_context *ctx,
+                         xkb_context_stats_fn stats_fn, void *data)
+{
+    ctx->stats_fn = stats_fn;
+    ctx->stats_fn_data = data;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "context.h"
+
+/*
+ * Statistics are only collected while ctx->stats is set.  The counters
+ * may be updated from several threads at once, e.g. while includes are
+ * prefetched, so they are only accessed atomically: changed with
+ * stats_add() and stats_max(), and read by stats.c one by one.
+ */
+struct context_stats {
+    struct xkb_context_stats totals;
+    /* The size of the atom table when the counters were reset. */
+    unsigned int atoms_base;
+    /* The deepest include nesting of the current compilation. */
+    uint64_t include_depth;
+};
+
+/* Kept on the stack while a keymap is compiled. */
+struct stats_compile {
+    uint64_t start;
+    struct xkb_context_stats before;
+};
+
+/* Nanoseconds of a monotonic clock. */
+uint64_t
+stats_now(void);
+
+void
+stats_add(uint64_t *counter, uint64_t value);
+
+void
+stats_max(uint64_t *counter, uint64_t value);
+
+void
+stats_compile_begin(struct xkb_context *ctx, struct stats_compile *compile);
+
+void
+stats_compile_end(struct xkb_context *ctx, struct stats_compile *compile,
+                  bool ok);
+
+/* Returns 0 if statistics are not enabled. */
+static inline uint64_t
+stats_start(struct xkb_context *ctx)
+{
+    return ctx->stats ? stats_now() : 0;
+}
+
+#define stats_count(ctx, field, n) do { \
+    if ((ctx)->stats) \
+        stats_add(&(ctx)->stats->totals.field, (n)); \
+} while (0)
+
+/* Adds the time since @start, as returned by stats_start(). */
+#define stats_time(ctx, field, start) do { \
+    if ((ctx)->stats && (start) != 0) \
+        stats_add(&(ctx)->stats->totals.field, stats_now() - (start)); \
+} while (0)
+
+#define stats_include_depth(ctx, depth) do { \
+    if ((ctx)->stats) \
+        stats_max(&(ctx)->stats->include_depth, (depth)); \
+} while (0)
+
+#endif
@@ -30,6 +30,26 @@
 int
 utf32_to_utf8(uint32_t unichar, char *buffer);
 
+/*
+ * Returns the length of the UTF-8 encoding of @unichar, or 0 if it is not
+ * a Unicode scalar value, i.e. it is a surrogate or beyond U+10FFFF.
+ */
+static inline int
+utf32_utf8_length(uint32_t unichar)
+{
+    if (unichar <= 0x7f)
+        return 1;
+    if (unichar <= 0x7ff)
+        return 2;
+    if (unichar >= 0xd800 && unichar <= 0xdfff)
+        return 0;
+    if (unichar <= 0xffff)
+        return 3;
+    if (unichar <= 0x10ffff)
+        return 4;
+    return 0;
+}
+
 bool
 is_valid_utf8(const char *ss, size_t len);
 
@@ -316,6 +316,65 @@ translate_action(union xkb_action *action, const xcb_xkb_action_t *wire)
     }
 }
 
+static bool
+translate_type(struct xkb_keymap *keymap, struct xkb_key_type *type,
+               xcb_xkb_key_type_t *wire_type)
+{
+    FAIL_UNLESS(wire_type->numLevels > 0);
+
+    type->mods.mods = translate_mods(wire_type->mods_mods,
+                                     wire_type->mods_vmods, 0);
+    type->mods.mask = translate_mods(wire_type->mods_mask, 0, 0);
+    type->num_levels = wire_type->numLevels;
+
+    {
+        int entries_length = xcb_xkb_key_type_map_length(wire_type);
+        xcb_xkb_kt_map_entry_iterator_t entries_iter =
+            xcb_xkb_key_type_map_iterator(wire_type);
+
+        type->num_entries = wire_type->nMapEntries;
+        ALLOC_OR_FAIL(type->entries, type->num_entries);
+
+        for (int j = 0; j < entries_length; j++) {
+            xcb_xkb_kt_map_entry_t *wire_entry = entries_iter.data;
+            struct xkb_key_type_entry *entry = &type->entries[j];
+
+            FAIL_UNLESS(wire_entry->level < type->num_levels);
+
+            entry->level = wire_entry->level;
+            entry->mods.mods = translate_mods(wire_entry->mods_mods,
+                                              wire_entry->mods_vmods, 0);
+            entry->mods.mask = translate_mods(wire_entry->mods_mask, 0, 0);
+
+            xcb_xkb_kt_map_entry_next(&entries_iter);
+        }
+    }
+
+    {
+        int preserves_length = xcb_xkb_key_type_preserve_length(wire_type);
+        xcb_xkb_mod_def_iterator_t preserves_iter =
+            xcb_xkb_key_type_preserve_iterator(wire_type);
+
+        FAIL_UNLESS((unsigned) preserves_length <= type->num_entries);
+
+        for (int j = 0; j < preserves_length; j++) {
+            xcb_xkb_mod_def_t *wire_preserve = preserves_iter.data;
+            struct xkb_key_type_entry *entry = &type->entries[j];
+
+            entry->preserve.mods = translate_mods(wire_preserve->realMods,
+                                                  wire_preserve->vmods, 0);
+            entry->preserve.mask = translate_mods(wire_preserve->mask, 0, 0);
+
+            xcb_xkb_mod_def_next(&preserves_iter);
+        }
+    }
+
+    return true;
+
+fail:
+    return false;
+}
+
 static bool
 get_types(struct xkb_keymap *keymap, xcb_connection_t *conn,
           xcb_xkb_get_map_reply_t *reply, xcb_xkb_get_map_map_t *map)
@@ -330,59 +389,63 @@ get_types(struct xkb_keymap *keymap, xcb_connection_t *conn,
     ALLOC_OR_FAIL(keymap->types, keymap->num_types);
 
     for (int i = 0; i < types_length; i++) {
-        xcb_xkb_key_type_t *wire_type = types_iter.data;
-        struct xkb_key_type *type = &keymap->types[i];
+        if (!translate_type(keymap, &keymap->types[i], types_iter.data))
+            goto fail;
 
-        FAIL_UNLESS(wire_type->numLevels > 0);
+        xcb_xkb_key_type_next(&types_iter);
+    }
 
-        type->mods.mods = translate_mods(wire_type->mods_mods,
-                                         wire_type->mods_vmods, 0);
-        type->mods.mask = translate_mods(wire_type->mods_mask, 0, 0);
-        type->num_levels = wire_type->numLevels;
+    return true;
 
-        {
-            int entries_length = xcb_xkb_key_type_map_length(wire_type);
-            xcb_xkb_kt_map_entry_iterator_t entries_iter =
-                xcb_xkb_key_type_map_iterator(wire_type);
+fail:
+    return false;
+}
 
-            type->num_entries = wire_type->nMapEntries;
-            ALLOC_OR_FAIL(type->entries, type->num_entries);
+static bool
+translate_sym_map(struct xkb_keymap *keymap, struct xkb_key *key,
+                  xcb_xkb_key_sym_map_t *wire_sym_map)
+{
+    key->num_groups = wire_sym_map->groupInfo & 0x0f;
+    FAIL_UNLESS(key->num_groups <= ARRAY_SIZE(wire_sym_map->kt_index));
+    ALLOC_OR_FAIL(key->groups, key->num_groups);
 
-            for (int j = 0; j < entries_length; j++) {
-                xcb_xkb_kt_map_entry_t *wire_entry = entries_iter.data;
-                struct xkb_key_type_entry *entry = &type->entries[j];
+    for (unsigned j = 0; j < key->num_groups; j++) {
+        FAIL_UNLESS(wire_sym_map->kt_index[j] < keymap->num_types);
+        key->groups[j].type = &keymap->types[wire_sym_map->kt_index[j]];
 
-                FAIL_UNLESS(wire_entry->level < type->num_levels);
+        ALLOC_OR_FAIL(key->groups[j].levels, key->groups[j].type->num_levels);
+    }
 
-                entry->level = wire_entry->level;
-                entry->mods.mods = translate_mods(wire_entry->mods_mods,
-                                                  wire_entry->mods_vmods, 0);
-                entry->mods.mask = translate_mods(wire_entry->mods_mask, 0, 0);
+    key->out_of_range_group_number = (wire_sym_map->groupInfo & 0x30) >> 4;
 
-                xcb_xkb_kt_map_entry_next(&entries_iter);
-            }
-        }
+    FAIL_UNLESS(key->out_of_range_group_number <= key->num_groups);
 
-        {
-            int preserves_length = xcb_xkb_key_type_preserve_length(wire_type);
-            xcb_xkb_mod_def_iterator_t preserves_iter =
-                xcb_xkb_key_type_preserve_iterator(wire_type);
+    if (wire_sym_map->groupInfo & XCB_XKB_GROUPS_WRAP_CLAMP_INTO_RANGE)
+        key->out_of_range_group_action = RANGE_SATURATE;
+    else if (wire_sym_map->groupInfo & XCB_XKB_GROUPS_WRAP_REDIRECT_INTO_RANGE)
+        key->out_of_range_group_action = RANGE_REDIRECT;
+    else
+        key->out_of_range_group_action = RANGE_WRAP;
 
-            FAIL_UNLESS((unsigned) preserves_length <= type->num_entries);
+    {
+        int syms_length = xcb_xkb_key_sym_map_syms_length(wire_sym_map);
+        xcb_keysym_t *syms_iter = xcb_xkb_key_sym_map_syms(wire_sym_map);
 
-            for (int j = 0; j < preserves_length; j++) {
-                xcb_xkb_mod_def_t *wire_preserve = preserves_iter.data;
-                struct xkb_key_type_entry *entry = &type->entries[j];
+        FAIL_UNLESS((unsigned) syms_length == wire_sym_map->width * key->num_groups);
 
-                entry->preserve.mods = translate_mods(wire_preserve->realMods,
-                                                      wire_preserve->vmods, 0);
-                entry->preserve.mask = translate_mods(wire_preserve->mask, 0, 0);
+        for (int j = 0; j < syms_length; j++) {
+            xcb_keysym_t wire_keysym = *syms_iter;
+            const xkb_layout_index_t group = j / wire_sym_map->width;
+            const xkb_level_index_t level = j % wire_sym_map->width;
 
-                xcb_xkb_mod_def_next(&preserves_iter);
+            if (level < key->groups[group].type->num_levels &&
+                wire_keysym != XKB_KEY_NoSymbol) {
+                key->groups[group].levels[level].num_syms = 1;
+                key->groups[group].levels[level].u.sym = wire_keysym;
             }
-        }
 
-        xcb_xkb_key_type_next(&types_iter);
+            syms_iter++;
+        }
     }
 
     return true;
@@ -412,51 +475,10 @@ get_sym_maps(struct xkb_keymap *keymap, xcb_connection_t *conn,
         keymap->keys[kc].keycode = kc;
 
     for (int i = 0; i < sym_maps_length; i++) {
-        xcb_xkb_key_sym_map_t *wire_sym_map = sym_maps_iter.data;
         struct xkb_key *key = &keymap->keys[reply->firstKeySym + i];
 
-        key->num_groups = wire_sym_map->groupInfo & 0x0f;
-        FAIL_UNLESS(key->num_groups <= ARRAY_SIZE(wire_sym_map->kt_index));
-        ALLOC_OR_FAIL(key->groups, key->num_groups);
-
-        for (unsigned j = 0; j < key->num_groups; j++) {
-            FAIL_UNLESS(wire_sym_map->kt_index[j] < keymap->num_types);
-            key->groups[j].type = &keymap->types[wire_sym_map->kt_index[j]];
-
-            ALLOC_OR_FAIL(key->groups[j].levels, key->groups[j].type->num_levels);
-        }
-
-        key->out_of_range_group_number = (wire_sym_map->groupInfo & 0x30) >> 4;
-
-        FAIL_UNLESS(key->out_of_range_group_number <= key->num_groups);
-
-        if (wire_sym_map->groupInfo & XCB_XKB_GROUPS_WRAP_CLAMP_INTO_RANGE)
-            key->out_of_range_group_action = RANGE_SATURATE;
-        else if (wire_sym_map->groupInfo & XCB_XKB_GROUPS_WRAP_REDIRECT_INTO_RANGE)
-            key->out_of_range_group_action = RANGE_REDIRECT;
-        else
-            key->out_of_range_group_action = RANGE_WRAP;
-
-        {
-            int syms_length = xcb_xkb_key_sym_map_syms_length(wire_sym_map);
-            xcb_keysym_t *syms_iter = xcb_xkb_key_sym_map_syms(wire_sym_map);
-
-            FAIL_UNLESS((unsigned) syms_length == wire_sym_map->width * key->num_groups);
-
-            for (int j = 0; j < syms_length; j++) {
-                xcb_keysym_t wire_keysym = *syms_iter;
-                const xkb_layout_index_t group = j / wire_sym_map->width;
-                const xkb_level_index_t level = j % wire_sym_map->width;
-
-                if (level < key->groups[group].type->num_levels &&
-                    wire_keysym != XKB_KEY_NoSymbol) {
-                    key->groups[group].levels[level].num_syms = 1;
-                    key->groups[group].levels[level].u.sym = wire_keysym;
-                }
-
-                syms_iter++;
-            }
-        }
+        if (!translate_sym_map(keymap, key, sym_maps_iter.data))
+            goto fail;
 
         xcb_xkb_key_sym_map_next(&sym_maps_iter);
     }
@@ -479,9 +501,9 @@ get_actions(struct xkb_keymap *keymap, xcb_connection_t *conn,
     xcb_xkb_key_sym_map_iterator_t sym_maps_iter =
         xcb_xkb_get_map_map_syms_rtrn_iterator(reply, map);
 
-    FAIL_UNLESS(reply->firstKeyAction == keymap->min_key_code);
-    FAIL_UNLESS(reply->firstKeyAction + reply->nKeyActions ==
-                keymap->max_key_code + 1);
+    /* The actions are matched with the sym maps of the same keys. */
+    FAIL_UNLESS(reply->firstKeyAction == reply->firstKeySym);
+    FAIL_UNLESS(reply->nKeyActions == reply->nKeySyms);
 
     for (int i = 0; i < acts_count_length; i++) {
         xcb_xkb_key_sym_map_t *wire_sym_map = sym_maps_iter.data;
@@ -522,9 +544,7 @@ get_vmods(struct xkb_keymap *keymap, xcb_connection_t *conn,
 {
     uint8_t *iter = xcb_xkb_get_map_map_vmods_rtrn(map);
 
-    keymap->mods.num_mods =
-        NUM_REAL_MODS + MIN(msb_pos(reply->virtualMods), NUM_VMODS);
-
+    /* The number of modifiers is set by get_vmod_names(). */
     for (unsigned i = 0; i < NUM_VMODS; i++) {
         if (reply->virtualMods & (1u << i)) {
             uint8_t wire = *iter;
@@ -639,27 +659,25 @@ fail:
     return false;
 }
 
+static const xcb_xkb_map_part_t required_map_components =
+    (XCB_XKB_MAP_PART_KEY_TYPES |
+     XCB_XKB_MAP_PART_KEY_SYMS |
+     XCB_XKB_MAP_PART_MODIFIER_MAP |
+     XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS |
+     XCB_XKB_MAP_PART_KEY_ACTIONS |
+     XCB_XKB_MAP_PART_VIRTUAL_MODS |
+     XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP);
+
 static bool
-get_map(struct xkb_keymap *keymap, xcb_connection_t *conn, uint16_t device_id)
+get_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
+        xcb_xkb_get_map_cookie_t cookie)
 {
-    static const xcb_xkb_map_part_t required_components =
-        (XCB_XKB_MAP_PART_KEY_TYPES |
-         XCB_XKB_MAP_PART_KEY_SYMS |
-         XCB_XKB_MAP_PART_MODIFIER_MAP |
-         XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS |
-         XCB_XKB_MAP_PART_KEY_ACTIONS |
-         XCB_XKB_MAP_PART_VIRTUAL_MODS |
-         XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP);
-
-    xcb_xkb_get_map_cookie_t cookie =
-        xcb_xkb_get_map(conn, device_id, required_components,
-                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
     xcb_xkb_get_map_reply_t *reply = xcb_xkb_get_map_reply(conn, cookie, NULL);
     xcb_xkb_get_map_map_t map;
 
     FAIL_IF_BAD_REPLY(reply, "XkbGetMap");
 
-    if ((reply->present & required_components) != required_components)
+    if ((reply->present & required_map_components) != required_map_components)
         goto fail;
 
     xcb_xkb_get_map_map_unpack(xcb_xkb_get_map_map(reply),
@@ -744,10 +762,8 @@ get_indicators(struct xkb_keymap *keymap, xcb_connection_t *conn,
 
 static bool
 get_indicator_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
-                  uint16_t device_id)
+                  xcb_xkb_get_indicator_map_cookie_t cookie)
 {
-    xcb_xkb_get_indicator_map_cookie_t cookie =
-        xcb_xkb_get_indicator_map(conn, device_id, ALL_INDICATORS_MASK);
     xcb_xkb_get_indicator_map_reply_t *reply =
         xcb_xkb_get_indicator_map_reply(conn, cookie, NULL);
 
@@ -826,10 +842,8 @@ fail:
 
 static bool
 get_compat_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
-               uint16_t device_id)
+               xcb_xkb_get_compat_map_cookie_t cookie)
 {
-    xcb_xkb_get_compat_map_cookie_t cookie =
-        xcb_xkb_get_compat_map(conn, device_id, 0, true, 0, 0);
     xcb_xkb_get_compat_map_reply_t *reply =
         xcb_xkb_get_compat_map_reply(conn, cookie, NULL);
 
@@ -847,7 +861,7 @@ fail:
 }
 
 static bool
-get_type_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
+get_type_names(struct xkb_keymap *keymap, struct x11_atom_interner *interner,
                xcb_xkb_get_names_reply_t *reply,
                xcb_xkb_get_names_value_list_t *list)
 {
@@ -875,13 +889,10 @@ get_type_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
 
         ALLOC_OR_FAIL(type->level_names, type->num_levels);
 
-        if (!adopt_atom(keymap->ctx, conn, wire_type_name, &type->name))
-            goto fail;
-
-        if (!adopt_atoms(keymap->ctx, conn,
-                         kt_level_names_iter, type->level_names,
-                         wire_num_levels))
-            goto fail;
+        x11_atom_interner_adopt_atom(interner, wire_type_name, &type->name);
+        for (size_t j = 0; j < wire_num_levels; j++)
+            x11_atom_interner_adopt_atom(interner, kt_level_names_iter[j],
+                                         &type->level_names[j]);
 
         kt_level_names_iter += wire_num_levels;
         key_type_names_iter++;
@@ -895,7 +906,8 @@ fail:
 }
 
 static bool
-get_indicator_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
+get_indicator_names(struct xkb_keymap *keymap,
+                    struct x11_atom_interner *interner,
                     xcb_xkb_get_names_reply_t *reply,
                     xcb_xkb_get_names_value_list_t *list)
 {
@@ -908,8 +920,7 @@ get_indicator_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
             xcb_atom_t wire = *iter;
             struct xkb_led *led = &keymap->leds[i];
 
-            if (!adopt_atom(keymap->ctx, conn, wire, &led->name))
-                return false;
+            x11_atom_interner_adopt_atom(interner, wire, &led->name);
 
             iter++;
         }
@@ -922,7 +933,7 @@ fail:
 }
 
 static bool
-get_vmod_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
+get_vmod_names(struct xkb_keymap *keymap, struct x11_atom_interner *interner,
                xcb_xkb_get_names_reply_t *reply,
                xcb_xkb_get_names_value_list_t *list)
 {
@@ -941,8 +952,7 @@ get_vmod_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
             xcb_atom_t wire = *iter;
             struct xkb_mod *mod = &keymap->mods.mods[NUM_REAL_MODS + i];
 
-            if (!adopt_atom(keymap->ctx, conn, wire, &mod->name))
-                return false;
+            x11_atom_interner_adopt_atom(interner, wire, &mod->name);
 
             iter++;
         }
@@ -952,7 +962,7 @@ get_vmod_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
 }
 
 static bool
-get_group_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
+get_group_names(struct xkb_keymap *keymap, struct x11_atom_interner *interner,
                 xcb_xkb_get_names_reply_t *reply,
                 xcb_xkb_get_names_value_list_t *list)
 {
@@ -962,9 +972,9 @@ get_group_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
     keymap->num_group_names = msb_pos(reply->groupNames);
     ALLOC_OR_FAIL(keymap->group_names, keymap->num_group_names);
 
-    if (!adopt_atoms(keymap->ctx, conn,
-                     iter, keymap->group_names, length))
-        goto fail;
+    for (int i = 0; i < length; i++)
+        x11_atom_interner_adopt_atom(interner, iter[i],
+                                     &keymap->group_names[i]);
 
     return true;
 
@@ -1044,30 +1054,30 @@ fail:
     return false;
 }
 
+static const xcb_xkb_name_detail_t wanted_names =
+    (XCB_XKB_NAME_DETAIL_KEYCODES |
+     XCB_XKB_NAME_DETAIL_SYMBOLS |
+     XCB_XKB_NAME_DETAIL_TYPES |
+     XCB_XKB_NAME_DETAIL_COMPAT |
+     XCB_XKB_NAME_DETAIL_KEY_TYPE_NAMES |
+     XCB_XKB_NAME_DETAIL_KT_LEVEL_NAMES |
+     XCB_XKB_NAME_DETAIL_INDICATOR_NAMES |
+     XCB_XKB_NAME_DETAIL_KEY_NAMES |
+     XCB_XKB_NAME_DETAIL_KEY_ALIASES |
+     XCB_XKB_NAME_DETAIL_VIRTUAL_MOD_NAMES |
+     XCB_XKB_NAME_DETAIL_GROUP_NAMES);
+
 static bool
-get_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
-          uint16_t device_id)
+get_names(struct xkb_keymap *keymap, struct x11_atom_interner *interner,
+          xcb_xkb_get_names_cookie_t cookie)
 {
-    static const xcb_xkb_name_detail_t wanted =
-        (XCB_XKB_NAME_DETAIL_KEYCODES |
-         XCB_XKB_NAME_DETAIL_SYMBOLS |
-         XCB_XKB_NAME_DETAIL_TYPES |
-         XCB_XKB_NAME_DETAIL_COMPAT |
-         XCB_XKB_NAME_DETAIL_KEY_TYPE_NAMES |
-         XCB_XKB_NAME_DETAIL_KT_LEVEL_NAMES |
-         XCB_XKB_NAME_DETAIL_INDICATOR_NAMES |
-         XCB_XKB_NAME_DETAIL_KEY_NAMES |
-         XCB_XKB_NAME_DETAIL_KEY_ALIASES |
-         XCB_XKB_NAME_DETAIL_VIRTUAL_MOD_NAMES |
-         XCB_XKB_NAME_DETAIL_GROUP_NAMES);
     static const xcb_xkb_name_detail_t required =
         (XCB_XKB_NAME_DETAIL_KEY_TYPE_NAMES |
          XCB_XKB_NAME_DETAIL_KT_LEVEL_NAMES |
          XCB_XKB_NAME_DETAIL_KEY_NAMES |
          XCB_XKB_NAME_DETAIL_VIRTUAL_MOD_NAMES);
 
-    xcb_xkb_get_names_cookie_t cookie =
-        xcb_xkb_get_names(conn, device_id, wanted);
+    xcb_connection_t *conn = interner->conn;
     xcb_xkb_get_names_reply_t *reply =
         xcb_xkb_get_names_reply(conn, cookie, NULL);
     xcb_xkb_get_names_value_list_t list;
@@ -1087,23 +1097,23 @@ get_names(struct xkb_keymap *keymap, xcb_connection_t *conn,
                                         reply->which,
                                         &list);
 
-    if (!get_atom_name(conn, list.keycodesName, &keymap->keycodes_section_name) ||
-        !get_atom_name(conn, list.symbolsName, &keymap->symbols_section_name) ||
-        !get_atom_name(conn, list.typesName, &keymap->types_section_name) ||
-        !get_atom_name(conn, list.compatName, &keymap->compat_section_name) ||
-        !get_type_names(keymap, conn, reply, &list) ||
-        !get_indicator_names(keymap, conn, reply, &list) ||
-        !get_vmod_names(keymap, conn, reply, &list) ||
-        !get_group_names(keymap, conn, reply, &list) ||
+    x11_atom_interner_get_atom_name(interner, list.keycodesName,
+                                    &keymap->keycodes_section_name);
+    x11_atom_interner_get_atom_name(interner, list.symbolsName,
+                                    &keymap->symbols_section_name);
+    x11_atom_interner_get_atom_name(interner, list.typesName,
+                                    &keymap->types_section_name);
+    x11_atom_interner_get_atom_name(interner, list.compatName,
+                                    &keymap->compat_section_name);
+
+    if (!get_type_names(keymap, interner, reply, &list) ||
+        !get_indicator_names(keymap, interner, reply, &list) ||
+        !get_vmod_names(keymap, interner, reply, &list) ||
+        !get_group_names(keymap, interner, reply, &list) ||
         !get_key_names(keymap, conn, reply, &list) ||
         !get_aliases(keymap, conn, reply, &list))
         goto fail;
 
-    XkbEscapeMapName(keymap->keycodes_section_name);
-    XkbEscapeMapName(keymap->symbols_section_name);
-    XkbEscapeMapName(keymap->types_section_name);
-    XkbEscapeMapName(keymap->compat_section_name);
-
     free(reply);
     return true;
 
@@ -1114,10 +1124,8 @@ fail:
 
 static bool
 get_controls(struct xkb_keymap *keymap, xcb_connection_t *conn,
-             uint16_t device_id)
+             xcb_xkb_get_controls_cookie_t cookie)
 {
-    xcb_xkb_get_controls_cookie_t cookie =
-        xcb_xkb_get_controls(conn, device_id);
     xcb_xkb_get_controls_reply_t *reply =
         xcb_xkb_get_controls_reply(conn, cookie, NULL);
 
@@ -1148,6 +1156,12 @@ xkb_x11_keymap_new_from_device(struct xkb_context *ctx,
 {
     struct xkb_keymap *keymap;
     const enum xkb_keymap_format format = XKB_KEYMAP_FORMAT_TEXT_V1;
+    struct x11_atom_interner interner;
+    xcb_xkb_get_map_cookie_t map_cookie;
+    xcb_xkb_get_indicator_map_cookie_t indicator_map_cookie;
+    xcb_xkb_get_compat_map_cookie_t compat_map_cookie;
+    xcb_xkb_get_names_cookie_t names_cookie;
+    xcb_xkb_get_controls_cookie_t controls_cookie;
 
     if (flags & ~(XKB_KEYMAP_COMPILE_NO_FLAGS)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
@@ -1163,14 +1177,376 @@ xkb_x11_keymap_new_from_device(struct xkb_context *ctx,
     if (!keymap)
         return NULL;
 
-    if (!get_map(keymap, conn, device_id) ||
-        !get_indicator_map(keymap, conn, device_id) ||
-        !get_compat_map(keymap, conn, device_id) ||
-        !get_names(keymap, conn, device_id) ||
-        !get_controls(keymap, conn, device_id)) {
-        xkb_keymap_unref(keymap);
+    /*
+     * Send all of the requests first, and only then wait for the replies,
+     * so that fetching the keymap takes a single round trip, plus another
+     * one for the names of the atoms.  When something fails, the replies
+     * which were not collected yet must be discarded, or they would sit
+     * in the XCB queue forever.
+     */
+    map_cookie =
+        xcb_xkb_get_map(conn, device_id, required_map_components,
+                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    indicator_map_cookie =
+        xcb_xkb_get_indicator_map(conn, device_id, ALL_INDICATORS_MASK);
+    compat_map_cookie =
+        xcb_xkb_get_compat_map(conn, device_id, 0, true, 0, 0);
+    names_cookie = xcb_xkb_get_names(conn, device_id, wanted_names);
+    controls_cookie = xcb_xkb_get_controls(conn, device_id);
+
+    x11_atom_interner_init(&interner, ctx, conn);
+
+    if (!get_map(keymap, conn, map_cookie))
+        goto err_map;
+    if (!get_indicator_map(keymap, conn, indicator_map_cookie))
+        goto err_indicator_map;
+    if (!get_compat_map(keymap, conn, compat_map_cookie))
+        goto err_compat_map;
+    if (!get_names(keymap, &interner, names_cookie))
+        goto err_names;
+    if (!get_controls(keymap, conn, controls_cookie))
+        goto err_controls;
+    if (!x11_atom_interner_round_trip(&interner))
+        goto err_atoms;
+
+    XkbUpdateValidLeds(keymap);
+    XkbEscapeMapName(keymap->keycodes_section_name);
+    XkbEscapeMapName(keymap->symbols_section_name);
+    XkbEscapeMapName(keymap->types_section_name);
+    XkbEscapeMapName(keymap->compat_section_name);
+
+    return keymap;
+
+err_map:
+    xcb_discard_reply(conn, indicator_map_cookie.sequence);
+err_indicator_map:
+    xcb_discard_reply(conn, compat_map_cookie.sequence);
+err_compat_map:
+    xcb_discard_reply(conn, names_cookie.sequence);
+err_names:
+    xcb_discard_reply(conn, controls_cookie.sequence);
+err_controls:
+    x11_atom_interner_discard(&interner);
+err_atoms:
+    xkb_keymap_unref(keymap);
+    return NULL;
+}
+
+static void
+free_key_groups(struct xkb_key *key)
+{
+    if (!key->groups)
+        return;
+
+    for (xkb_layout_index_t i = 0; i < key->num_groups; i++) {
+        if (!key->groups[i].levels)
+            continue;
+
+        for (xkb_level_index_t j = 0; j < XkbKeyGroupWidth(key, i); j++)
+            if (key->groups[i].levels[j].num_syms > 1)
+                free(key->groups[i].levels[j].u.syms);
+        free(key->groups[i].levels);
+    }
+
+    free(key->groups);
+    key->groups = NULL;
+    key->num_groups = 0;
+}
+
+static bool
+update_types(struct xkb_keymap *keymap, xcb_xkb_get_map_reply_t *reply,
+             xcb_xkb_get_map_map_t *map, bool *resized)
+{
+    int types_length = xcb_xkb_get_map_map_types_rtrn_length(reply, map);
+    xcb_xkb_key_type_iterator_t types_iter =
+        xcb_xkb_get_map_map_types_rtrn_iterator(reply, map);
+
+    FAIL_UNLESS(reply->firstType + reply->nTypes <= keymap->num_types);
+
+    /*
+     * The keys point into the types array and size their levels after
+     * the types, so only types which keep their width can be updated in
+     * place.  Check them all before changing anything.
+     */
+    for (int i = 0; i < types_length; i++) {
+        xcb_xkb_key_type_t *wire_type = types_iter.data;
+
+        if (wire_type->numLevels !=
+            keymap->types[reply->firstType + i].num_levels) {
+            *resized = true;
+            goto fail;
+        }
+
+        xcb_xkb_key_type_next(&types_iter);
+    }
+
+    types_iter = xcb_xkb_get_map_map_types_rtrn_iterator(reply, map);
+
+    for (int i = 0; i < types_length; i++) {
+        struct xkb_key_type *type = &keymap->types[reply->firstType + i];
+
+        /* The names come from XkbGetNames, and are kept. */
+        free(type->entries);
+        type->entries = NULL;
+        type->num_entries = 0;
+
+        if (!translate_type(keymap, type, types_iter.data))
+            goto fail;
+
+        xcb_xkb_key_type_next(&types_iter);
+    }
+
+    return true;
+
+fail:
+    return false;
+}
+
+static bool
+update_sym_maps(struct xkb_keymap *keymap, xcb_xkb_get_map_reply_t *reply,
+                xcb_xkb_get_map_map_t *map, bool *resized)
+{
+    int sym_maps_length = xcb_xkb_get_map_map_syms_rtrn_length(reply, map);
+    xcb_xkb_key_sym_map_iterator_t sym_maps_iter =
+        xcb_xkb_get_map_map_syms_rtrn_iterator(reply, map);
+
+    FAIL_UNLESS(reply->firstKeySym >= keymap->min_key_code);
+    FAIL_UNLESS(reply->firstKeySym + reply->nKeySyms <=
+                keymap->max_key_code + 1);
+
+    for (int i = 0; i < sym_maps_length; i++) {
+        struct xkb_key *key = &keymap->keys[reply->firstKeySym + i];
+
+        /* The explicit components are fetched again for these keys. */
+        free_key_groups(key);
+        key->explicit = 0;
+
+        if (!translate_sym_map(keymap, key, sym_maps_iter.data))
+            goto fail;
+
+        /*
+         * The number of groups of the keymap comes from XkbGetControls,
+         * which is not fetched again here, and neither are the names of
+         * the new groups.
+         */
+        if (key->num_groups > keymap->num_groups) {
+            *resized = true;
+            goto fail;
+        }
+
+        xcb_xkb_key_sym_map_next(&sym_maps_iter);
+    }
+
+    return true;
+
+fail:
+    return false;
+}
+
+static bool
+update_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
+           xcb_xkb_get_map_cookie_t cookie, bool *resized)
+{
+    xcb_xkb_get_map_reply_t *reply = xcb_xkb_get_map_reply(conn, cookie, NULL);
+    xcb_xkb_get_map_map_t map;
+
+    FAIL_IF_BAD_REPLY(reply, "XkbGetMap");
+
+    /* Something else changed in the meantime. */
+    if (reply->minKeyCode != keymap->min_key_code ||
+        reply->maxKeyCode != keymap->max_key_code ||
+        ((reply->present & XCB_XKB_MAP_PART_KEY_TYPES) &&
+         reply->totalTypes != keymap->num_types)) {
+        *resized = true;
+        goto fail;
+    }
+
+    xcb_xkb_get_map_map_unpack(xcb_xkb_get_map_map(reply),
+                               reply->nTypes,
+                               reply->nKeySyms,
+                               reply->nKeyActions,
+                               reply->totalActions,
+                               reply->totalKeyBehaviors,
+                               reply->virtualMods,
+                               reply->totalKeyExplicit,
+                               reply->totalModMapKeys,
+                               reply->totalVModMapKeys,
+                               reply->present,
+                               &map);
+
+    if (reply->present & XCB_XKB_MAP_PART_KEY_TYPES)
+        if (!update_types(keymap, reply, &map, resized))
+            goto fail;
+
+    if (reply->present & XCB_XKB_MAP_PART_KEY_SYMS) {
+        FAIL_UNLESS(reply->present & XCB_XKB_MAP_PART_KEY_ACTIONS);
+        FAIL_UNLESS(reply->present & XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS);
+
+        if (!update_sym_maps(keymap, reply, &map, resized) ||
+            !get_actions(keymap, conn, reply, &map) ||
+            !get_explicits(keymap, conn, reply, &map))
+            goto fail;
+    }
+
+    if (reply->present & XCB_XKB_MAP_PART_VIRTUAL_MODS)
+        if (!get_vmods(keymap, conn, reply, &map))
+            goto fail;
+
+    /* Only the keys with a non-empty mapping are listed. */
+    if (reply->present & XCB_XKB_MAP_PART_MODIFIER_MAP) {
+        FAIL_UNLESS(reply->firstModMapKey >= keymap->min_key_code);
+        FAIL_UNLESS(reply->firstModMapKey + reply->nModMapKeys <=
+                    keymap->max_key_code + 1);
+
+        for (int i = 0; i < reply->nModMapKeys; i++)
+            keymap->keys[reply->firstModMapKey + i].modmap = 0;
+
+        if (!get_modmaps(keymap, conn, reply, &map))
+            goto fail;
+    }
+
+    if (reply->present & XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP) {
+        FAIL_UNLESS(reply->firstVModMapKey >= keymap->min_key_code);
+        FAIL_UNLESS(reply->firstVModMapKey + reply->nVModMapKeys <=
+                    keymap->max_key_code + 1);
+
+        for (int i = 0; i < reply->nVModMapKeys; i++)
+            keymap->keys[reply->firstVModMapKey + i].vmodmap = 0;
+
+        if (!get_vmodmaps(keymap, conn, reply, &map))
+            goto fail;
+    }
+
+    free(reply);
+    return true;
+
+fail:
+    free(reply);
+    return false;
+}
+
+static bool
+add_key_range(const struct xkb_keymap *keymap, unsigned *first,
+              unsigned *count, xcb_keycode_t new_first, uint8_t new_count)
+{
+    unsigned last;
+
+    if (new_count == 0)
+        return true;
+
+    if (new_first < keymap->min_key_code ||
+        new_first + new_count > keymap->max_key_code + 1)
+        return false;
+
+    if (*count == 0) {
+        *first = new_first;
+        *count = new_count;
+        return true;
+    }
+
+    last = MAX(*first + *count, (unsigned) new_first + new_count);
+    *first = MIN(*first, new_first);
+    *count = last - *first;
+    return true;
+}
+
+XKB_EXPORT struct xkb_keymap *
+xkb_x11_keymap_new_from_map_notify(struct xkb_keymap *keymap,
+                                   xcb_connection_t *conn,
+                                   const xcb_generic_event_t *generic_event)
+{
+    const xcb_xkb_map_notify_event_t *event =
+        (const xcb_xkb_map_notify_event_t *) generic_event;
+    struct xkb_keymap *new_keymap;
+    uint16_t parts = 0;
+    unsigned first_key = 0, num_keys = 0;
+    unsigned first_modmap_key = 0, num_modmap_keys = 0;
+    unsigned first_vmodmap_key = 0, num_vmodmap_keys = 0;
+    xcb_xkb_get_map_cookie_t cookie;
+    bool resized = false;
+
+    /* All XKB events share one event code, and carry their own type. */
+    if (event->xkbType != XCB_XKB_MAP_NOTIFY) {
+        log_err_func(keymap->ctx, "not an XkbMapNotify event: %u\n",
+                     event->xkbType);
+        return NULL;
+    }
+
+    if (event->minKeyCode != keymap->min_key_code ||
+        event->maxKeyCode != keymap->max_key_code)
+        goto refetch;
+
+    if ((event->changed & XCB_XKB_MAP_PART_KEY_TYPES) &&
+        event->firstType + event->nTypes > keymap->num_types)
+        goto refetch;
+
+    /*
+     * The levels of a key hold both its symbols and its actions, and its
+     * groups hold the explicit types, so these are always fetched
+     * together, for all of the keys in which any of them changed.
+     */
+    if (((event->changed & XCB_XKB_MAP_PART_KEY_SYMS) &&
+         !add_key_range(keymap, &first_key, &num_keys,
+                        event->firstKeySym, event->nKeySyms)) ||
+        ((event->changed & XCB_XKB_MAP_PART_KEY_ACTIONS) &&
+         !add_key_range(keymap, &first_key, &num_keys,
+                        event->firstKeyAct, event->nKeyActs)) ||
+        ((event->changed & XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS) &&
+         !add_key_range(keymap, &first_key, &num_keys,
+                        event->firstKeyExplicit, event->nKeyExplicit)) ||
+        ((event->changed & XCB_XKB_MAP_PART_MODIFIER_MAP) &&
+         !add_key_range(keymap, &first_modmap_key, &num_modmap_keys,
+                        event->firstModMapKey, event->nModMapKeys)) ||
+        ((event->changed & XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP) &&
+         !add_key_range(keymap, &first_vmodmap_key, &num_vmodmap_keys,
+                        event->firstVModMapKey, event->nVModMapKeys)))
+        goto refetch;
+
+    if ((event->changed & XCB_XKB_MAP_PART_KEY_TYPES) && event->nTypes > 0)
+        parts |= XCB_XKB_MAP_PART_KEY_TYPES;
+    if (num_keys > 0)
+        parts |= (XCB_XKB_MAP_PART_KEY_SYMS |
+                  XCB_XKB_MAP_PART_KEY_ACTIONS |
+                  XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS);
+    if ((event->changed & XCB_XKB_MAP_PART_VIRTUAL_MODS) &&
+        event->virtualMods != 0)
+        parts |= XCB_XKB_MAP_PART_VIRTUAL_MODS;
+    if (num_modmap_keys > 0)
+        parts |= XCB_XKB_MAP_PART_MODIFIER_MAP;
+    if (num_vmodmap_keys > 0)
+        parts |= XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP;
+
+    /* E.g. only the key behaviors changed, which we don't use. */
+    if (parts == 0)
+        return xkb_keymap_ref(keymap);
+
+    /* Copy the old keymap while the server works on the request. */
+    cookie = xcb_xkb_get_map(conn, event->deviceID, 0, parts,
+                             event->firstType, event->nTypes,
+                             first_key, num_keys,
+                             first_key, num_keys,
+                             0, 0,
+                             event->virtualMods,
+                             first_key, num_keys,
+                             first_modmap_key, num_modmap_keys,
+                             first_vmodmap_key, num_vmodmap_keys);
+
+    new_keymap = xkb_keymap_copy(keymap);
+    if (!new_keymap) {
+        xcb_discard_reply(conn, cookie.sequence);
         return NULL;
     }
 
-    return keymap;
+    if (!update_map(new_keymap, conn, cookie, &resized)) {
+        xkb_keymap_unref(new_keymap);
+        if (resized)
+            goto refetch;
+        return NULL;
+    }
+
+    return new_keymap;
+
+refetch:
+    return xkb_x11_keymap_new_from_device(keymap->ctx, conn, event->deviceID,
+                                          keymap->flags);
 }
@@ -21,6 +21,10 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "x11-priv.h"
 
 XKB_EXPORT int
@@ -122,96 +126,451 @@ xkb_x11_get_core_keyboard_device_id(xcb_connection_t *conn)
     return device_id;
 }
 
-bool
-get_atom_name(xcb_connection_t *conn, xcb_atom_t atom, char **out)
+/*
+ * X atoms never change for the life of the server, so the xkb_atom_t's
+ * of the X atoms seen on a connection may be cached in the context, and
+ * refetching a keymap then usually needs no GetAtomName requests at all.
+ *
+ * Nothing tells us when a connection is closed, and a later connection,
+ * maybe to another server, may get the same pointer.  So the cache is
+ * only used for connections which the caller registered with
+ * xkb_x11_register_connection(), and which it promises to unregister
+ * before disconnecting; the pointer is then the handle of the
+ * registration, not a guess at the connection's identity.
+ *
+ * The tables are hash tables with linear probing, which are simply
+ * cleared when they get too full.  They are only freed with the context,
+ * and otherwise cleared and reused, so an interner may keep a pointer to
+ * its table; every access checks under the lock that the table is still
+ * registered for the interner's connection.  Like the atom table, the
+ * cache may be used from several threads at once.
+ */
+#define ATOM_CACHE_SIZE 1024
+
+struct x11_atom_cache_conn {
+    /* NULL if the table is unused. */
+    xcb_connection_t *conn;
+    size_t count;
+    struct {
+        xcb_atom_t from;
+        xkb_atom_t to;
+    } entries[ATOM_CACHE_SIZE];
+};
+
+struct x11_atom_cache {
+    /* Must be first; see context.h. */
+    struct x11_context_data base;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+    darray(struct x11_atom_cache_conn *) conns;
+};
+
+#ifdef HAVE_PTHREAD
+#define load_acquire(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define compare_exchange(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), false, \
+                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define cache_lock(cache) pthread_mutex_lock(&(cache)->mutex)
+#define cache_unlock(cache) pthread_mutex_unlock(&(cache)->mutex)
+#else
+#define load_acquire(ptr) (*(ptr))
+#define compare_exchange(ptr, expected, desired) \
+    (*(ptr) == *(expected) ? (*(ptr) = (desired), true) : false)
+#define cache_lock(cache) do { } while (0)
+#define cache_unlock(cache) do { } while (0)
+#endif
+
+static void
+atom_cache_conn_reset(struct x11_atom_cache_conn *atoms,
+                      xcb_connection_t *conn)
+{
+    memset(atoms->entries, 0, sizeof(atoms->entries));
+    atoms->count = 0;
+    atoms->conn = conn;
+}
+
+static void
+atom_cache_free(struct x11_context_data *data)
 {
-    xcb_get_atom_name_cookie_t cookie;
-    xcb_get_atom_name_reply_t *reply;
-    int length;
-    char *name;
+    struct x11_atom_cache *cache = (struct x11_atom_cache *) data;
+    struct x11_atom_cache_conn **atoms;
+
+    darray_foreach(atoms, cache->conns)
+        free(*atoms);
+    darray_free(cache->conns);
+#ifdef HAVE_PTHREAD
+    pthread_mutex_destroy(&cache->mutex);
+#endif
+    free(cache);
+}
 
-    if (atom == 0) {
-        *out = NULL;
-        return true;
+static struct x11_atom_cache *
+get_atom_cache(struct xkb_context *ctx)
+{
+    struct x11_context_data *expected = NULL;
+    struct x11_atom_cache *cache;
+
+    cache = (struct x11_atom_cache *) load_acquire(&ctx->x11_atom_cache);
+    if (cache)
+        return cache;
+
+    cache = calloc(1, sizeof(*cache));
+    if (!cache)
+        return NULL;
+    cache->base.free = atom_cache_free;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_init(&cache->mutex, NULL);
+#endif
+
+    /* Another thread may be racing us to add the cache. */
+    if (!compare_exchange(&ctx->x11_atom_cache, &expected, &cache->base)) {
+        atom_cache_free(&cache->base);
+        cache = (struct x11_atom_cache *) expected;
     }
 
-    cookie = xcb_get_atom_name(conn, atom);
-    reply = xcb_get_atom_name_reply(conn, cookie, NULL);
-    if (!reply)
-        return false;
+    return cache;
+}
 
-    length = xcb_get_atom_name_name_length(reply);
-    name = xcb_get_atom_name_name(reply);
+/* Returns the table registered for @conn, or NULL.  Call with the lock. */
+static struct x11_atom_cache_conn *
+find_atom_cache_conn(struct x11_atom_cache *cache, xcb_connection_t *conn)
+{
+    struct x11_atom_cache_conn **atoms;
 
-    *out = strndup(name, length);
-    if (!*out) {
-        free(reply);
-        return false;
+    darray_foreach(atoms, cache->conns)
+        if ((*atoms)->conn == conn)
+            return *atoms;
+
+    return NULL;
+}
+
+XKB_EXPORT int
+xkb_x11_register_connection(struct xkb_context *ctx, xcb_connection_t *conn)
+{
+    struct x11_atom_cache *cache;
+    struct x11_atom_cache_conn *atoms;
+
+    cache = get_atom_cache(ctx);
+    if (!cache)
+        return 0;
+
+    cache_lock(cache);
+
+    if (find_atom_cache_conn(cache, conn))
+        goto out;
+
+    /* Take over a table which was unregistered, or add one. */
+    atoms = find_atom_cache_conn(cache, NULL);
+    if (!atoms) {
+        atoms = malloc(sizeof(*atoms));
+        if (!atoms) {
+            cache_unlock(cache);
+            return 0;
+        }
+        darray_append(cache->conns, atoms);
     }
+    atom_cache_conn_reset(atoms, conn);
 
-    free(reply);
-    return true;
+out:
+    cache_unlock(cache);
+    return 1;
 }
 
-bool
-adopt_atoms(struct xkb_context *ctx, xcb_connection_t *conn,
-            const xcb_atom_t *from, xkb_atom_t *to, const size_t count)
-{
-    enum { SIZE = 128 };
-    xcb_get_atom_name_cookie_t cookies[SIZE];
-    const size_t num_batches = ROUNDUP(count, SIZE) / SIZE;
-
-    /* Send and collect the atoms in batches of reasonable SIZE. */
-    for (size_t batch = 0; batch < num_batches; batch++) {
-        const size_t start = batch * SIZE;
-        const size_t stop = min((batch + 1) * SIZE, count);
-
-        /* Send. */
-        for (size_t i = start; i < stop; i++)
-            if (from[i] != XCB_ATOM_NONE)
-                cookies[i % SIZE] = xcb_get_atom_name(conn, from[i]);
-
-        /* Collect. */
-        for (size_t i = start; i < stop; i++) {
-            xcb_get_atom_name_reply_t *reply;
-
-            if (from[i] == XCB_ATOM_NONE) {
-                to[i] = XKB_ATOM_NONE;
-                continue;
-            }
-
-            reply = xcb_get_atom_name_reply(conn, cookies[i % SIZE], NULL);
-            if (!reply)
-                goto err_discard;
-
-            to[i] = xkb_atom_intern(ctx,
-                                    xcb_get_atom_name_name(reply),
-                                    xcb_get_atom_name_name_length(reply));
-            free(reply);
+XKB_EXPORT void
+xkb_x11_unregister_connection(struct xkb_context *ctx,
+                              xcb_connection_t *conn)
+{
+    struct x11_atom_cache *cache;
+    struct x11_atom_cache_conn *atoms;
+
+    cache = (struct x11_atom_cache *) load_acquire(&ctx->x11_atom_cache);
+    if (!cache || !conn)
+        return;
+
+    cache_lock(cache);
+    atoms = find_atom_cache_conn(cache, conn);
+    if (atoms)
+        atom_cache_conn_reset(atoms, NULL);
+    cache_unlock(cache);
+}
 
-            if (to[i] == XKB_ATOM_NONE)
-                goto err_discard;
+static size_t
+atom_cache_slot(xcb_atom_t atom)
+{
+    return (atom * UINT32_C(2654435761)) % ATOM_CACHE_SIZE;
+}
 
-            continue;
+static xkb_atom_t
+atom_cache_lookup(struct x11_atom_cache *cache,
+                  struct x11_atom_cache_conn *atoms, xcb_connection_t *conn,
+                  xcb_atom_t atom)
+{
+    xkb_atom_t ret = XKB_ATOM_NONE;
 
-            /*
-             * If we don't discard the uncollected replies, they just
-             * sit in the XCB queue waiting forever. Sad.
-             */
-err_discard:
-            for (size_t j = i + 1; j < stop; j++)
-                if (from[j] != XCB_ATOM_NONE)
-                    xcb_discard_reply(conn, cookies[j % SIZE].sequence);
-            return false;
+    cache_lock(cache);
+
+    /* The connection was unregistered meanwhile. */
+    if (atoms->conn != conn)
+        goto out;
+
+    for (size_t i = atom_cache_slot(atom);
+         atoms->entries[i].from != XCB_ATOM_NONE;
+         i = (i + 1) % ATOM_CACHE_SIZE) {
+        if (atoms->entries[i].from == atom) {
+            ret = atoms->entries[i].to;
+            break;
         }
     }
 
+out:
+    cache_unlock(cache);
+    return ret;
+}
+
+static void
+atom_cache_insert(struct x11_atom_cache *cache,
+                  struct x11_atom_cache_conn *atoms, xcb_connection_t *conn,
+                  xcb_atom_t atom, xkb_atom_t to)
+{
+    size_t i;
+
+    cache_lock(cache);
+
+    if (atoms->conn != conn)
+        goto out;
+
+    if (atoms->count >= ATOM_CACHE_SIZE * 3 / 4)
+        atom_cache_conn_reset(atoms, conn);
+
+    for (i = atom_cache_slot(atom);
+         atoms->entries[i].from != XCB_ATOM_NONE;
+         i = (i + 1) % ATOM_CACHE_SIZE)
+        if (atoms->entries[i].from == atom)
+            goto out;
+
+    atoms->entries[i].from = atom;
+    atoms->entries[i].to = to;
+    atoms->count++;
+
+out:
+    cache_unlock(cache);
+}
+
+void
+x11_atom_interner_init(struct x11_atom_interner *interner,
+                       struct xkb_context *ctx, xcb_connection_t *conn)
+{
+    interner->ctx = ctx;
+    interner->conn = conn;
+    interner->cache = (struct x11_atom_cache *)
+        load_acquire(&ctx->x11_atom_cache);
+    interner->atoms = NULL;
+    if (interner->cache) {
+        cache_lock(interner->cache);
+        interner->atoms = find_atom_cache_conn(interner->cache, conn);
+        cache_unlock(interner->cache);
+    }
+    darray_init(interner->requests);
+    interner->request_index = NULL;
+    interner->request_index_size = 0;
+    darray_init(interner->targets);
+    interner->had_error = false;
+}
+
+static size_t
+request_index_slot(const struct x11_atom_interner *interner, xcb_atom_t atom)
+{
+    /* The size is a power of two. */
+    return (atom * UINT32_C(2654435761)) & (interner->request_index_size - 1);
+}
+
+/* Keep the table at most half full, so that probes stay short. */
+static bool
+request_index_grow(struct x11_atom_interner *interner)
+{
+    size_t size = MAX(interner->request_index_size * 2, 64);
+    size_t *index;
+
+    index = calloc(size, sizeof(*index));
+    if (!index)
+        return false;
+
+    free(interner->request_index);
+    interner->request_index = index;
+    interner->request_index_size = size;
+
+    for (size_t i = 0; i < darray_size(interner->requests); i++) {
+        size_t slot = request_index_slot(interner,
+                                         darray_item(interner->requests, i).from);
+        while (index[slot] != 0)
+            slot = (slot + 1) & (size - 1);
+        index[slot] = i + 1;
+    }
+
     return true;
 }
 
+/*
+ * Returns the index of the request for @atom, sending a new one if it
+ * was not requested yet, or (size_t) -1 on allocation failure.
+ */
+static size_t
+get_request(struct x11_atom_interner *interner, xcb_atom_t atom)
+{
+    size_t slot, i;
+
+    if ((darray_size(interner->requests) + 1) * 2 >
+        interner->request_index_size && !request_index_grow(interner))
+        return (size_t) -1;
+
+    for (slot = request_index_slot(interner, atom);
+         interner->request_index[slot] != 0;
+         slot = (slot + 1) & (interner->request_index_size - 1)) {
+        i = interner->request_index[slot] - 1;
+        if (darray_item(interner->requests, i).from == atom)
+            return i;
+    }
+
+    i = darray_size(interner->requests);
+    {
+        struct x11_atom_request new = {
+            .from = atom,
+            .cookie = xcb_get_atom_name(interner->conn, atom),
+            .atom = XKB_ATOM_NONE,
+        };
+        darray_append(interner->requests, new);
+    }
+    interner->request_index[slot] = i + 1;
+    return i;
+}
+
+static void
+add_target(struct x11_atom_interner *interner, xcb_atom_t atom,
+           xkb_atom_t *atom_out, char **string_out)
+{
+    struct x11_atom_target target = { 0 };
+    xkb_atom_t cached;
+    size_t i;
+
+    cached = (interner->atoms ?
+              atom_cache_lookup(interner->cache, interner->atoms,
+                                interner->conn, atom) :
+              XKB_ATOM_NONE);
+    if (cached != XKB_ATOM_NONE) {
+        if (atom_out) {
+            *atom_out = cached;
+        }
+        else {
+            *string_out = strdup(xkb_atom_text(interner->ctx, cached));
+            if (!*string_out)
+                interner->had_error = true;
+        }
+        return;
+    }
+
+    i = get_request(interner, atom);
+    if (i == (size_t) -1) {
+        interner->had_error = true;
+        return;
+    }
+
+    target.request = i;
+    target.atom_out = atom_out;
+    target.string_out = string_out;
+    darray_append(interner->targets, target);
+}
+
+void
+x11_atom_interner_adopt_atom(struct x11_atom_interner *interner,
+                             xcb_atom_t atom, xkb_atom_t *out)
+{
+    *out = XKB_ATOM_NONE;
+    if (atom != XCB_ATOM_NONE)
+        add_target(interner, atom, out, NULL);
+}
+
+void
+x11_atom_interner_get_atom_name(struct x11_atom_interner *interner,
+                                xcb_atom_t atom, char **out)
+{
+    *out = NULL;
+    if (atom != XCB_ATOM_NONE)
+        add_target(interner, atom, NULL, out);
+}
+
+static void
+interner_reset(struct x11_atom_interner *interner)
+{
+    darray_free(interner->requests);
+    free(interner->request_index);
+    interner->request_index = NULL;
+    interner->request_index_size = 0;
+    darray_free(interner->targets);
+}
+
+void
+x11_atom_interner_discard(struct x11_atom_interner *interner)
+{
+    struct x11_atom_request *request;
+
+    /*
+     * If we don't discard the uncollected replies, they just sit in the
+     * XCB queue waiting forever. Sad.
+     */
+    darray_foreach(request, interner->requests)
+        xcb_discard_reply(interner->conn, request->cookie.sequence);
+
+    interner_reset(interner);
+}
+
 bool
-adopt_atom(struct xkb_context *ctx, xcb_connection_t *conn, xcb_atom_t atom,
-           xkb_atom_t *out)
+x11_atom_interner_round_trip(struct x11_atom_interner *interner)
 {
-    return adopt_atoms(ctx, conn, &atom, out, 1);
+    struct x11_atom_request *request;
+    struct x11_atom_target *target;
+    size_t i;
+
+    darray_enumerate(i, request, interner->requests) {
+        xcb_get_atom_name_reply_t *reply =
+            xcb_get_atom_name_reply(interner->conn, request->cookie, NULL);
+        if (!reply)
+            goto err_discard;
+
+        request->atom = xkb_atom_intern(interner->ctx,
+                                        xcb_get_atom_name_name(reply),
+                                        xcb_get_atom_name_name_length(reply));
+        free(reply);
+
+        if (request->atom == XKB_ATOM_NONE)
+            goto err_discard;
+
+        if (interner->atoms)
+            atom_cache_insert(interner->cache, interner->atoms,
+                              interner->conn, request->from, request->atom);
+    }
+
+    darray_foreach(target, interner->targets) {
+        xkb_atom_t atom = darray_item(interner->requests, target->request).atom;
+
+        if (target->atom_out) {
+            *target->atom_out = atom;
+        }
+        else {
+            *target->string_out = strdup(xkb_atom_text(interner->ctx, atom));
+            if (!*target->string_out)
+                interner->had_error = true;
+        }
+    }
+
+    interner_reset(interner);
+    return !interner->had_error;
+
+err_discard:
+    for (i++; i < darray_size(interner->requests); i++)
+        xcb_discard_reply(interner->conn,
+                          darray_item(interner->requests, i).cookie.sequence);
+    interner_reset(interner);
+    interner->had_error = true;
+    return false;
 }
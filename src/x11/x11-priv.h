@@ -29,26 +29,68 @@
 #include "keymap.h"
 #include "xkbcommon/xkbcommon-x11.h"
 
-/* Get a strdup'd name of an X atom. */
-bool
-get_atom_name(xcb_connection_t *conn, xcb_atom_t atom, char **out);
+/*
+ * Converts X atoms to xkb_atom_t's and strings, without a round trip for
+ * each one.  The GetAtomName requests are sent as the atoms are adopted,
+ * and the results are only stored once x11_atom_interner_round_trip()
+ * collects the replies; until then, the out pointers must stay valid.
+ * An atom adopted several times is only requested once, and atoms which
+ * were seen before on the same connection are not requested at all.
+ */
+struct x11_atom_request {
+    xcb_atom_t from;
+    xcb_get_atom_name_cookie_t cookie;
+    xkb_atom_t atom;
+};
+
+struct x11_atom_target {
+    /* Index into requests. */
+    size_t request;
+    /* Exactly one of these is set. */
+    xkb_atom_t *atom_out;
+    char **string_out;
+};
+
+struct x11_atom_interner {
+    struct xkb_context *ctx;
+    xcb_connection_t *conn;
+    /* May be NULL if they could not be allocated. */
+    struct x11_atom_cache *cache;
+    struct x11_atom_cache_conn *atoms;
+    darray(struct x11_atom_request) requests;
+    /*
+     * Hash table of the requests by X atom, with linear probing; holds
+     * indices into requests plus one, so that 0 is an empty slot.
+     */
+    size_t *request_index;
+    size_t request_index_size;
+    darray(struct x11_atom_target) targets;
+    bool had_error;
+};
+
+void
+x11_atom_interner_init(struct x11_atom_interner *interner,
+                       struct xkb_context *ctx, xcb_connection_t *conn);
+
+/* Make *out the xkb_atom_t of the X atom, or XKB_ATOM_NONE for None. */
+void
+x11_atom_interner_adopt_atom(struct x11_atom_interner *interner,
+                             xcb_atom_t atom, xkb_atom_t *out);
+
+/* Make *out a strdup'd name of the X atom, or NULL for None. */
+void
+x11_atom_interner_get_atom_name(struct x11_atom_interner *interner,
+                                xcb_atom_t atom, char **out);
 
 /*
- * Make a xkb_atom_t's from X atoms (prefer to send as many as possible
- * at once, to avoid many roundtrips).
- *
- * TODO: We can make this more flexible, such that @to doesn't have to
- *       be sequential. Then we can convert most adopt_atom() calls to
- *       adopt_atoms().
- *       Atom caching would also likely be useful for avoiding quite a
- *       few requests.
+ * Collect the replies and store the results.  Returns false if any
+ * request failed; the other replies are then discarded.
  */
 bool
-adopt_atoms(struct xkb_context *ctx, xcb_connection_t *conn,
-            const xcb_atom_t *from, xkb_atom_t *to, size_t count);
+x11_atom_interner_round_trip(struct x11_atom_interner *interner);
 
-bool
-adopt_atom(struct xkb_context *ctx, xcb_connection_t *conn, xcb_atom_t atom,
-           xkb_atom_t *out);
+/* Discard the replies without storing anything, e.g. after an error. */
+void
+x11_atom_interner_discard(struct x11_atom_interner *interner);
 
 #endif
@@ -279,7 +279,7 @@ CheckModifierField(struct xkb_context *ctx, const struct xkb_mod_set *mods,
     return true;
 }
 
-static const LookupEntry lockWhich[] = {
+const LookupEntry lockWhich[] = {
     { "both", 0 },
     { "lock", ACTION_LOCK_NO_UNLOCK },
     { "neither", (ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK) },
@@ -501,7 +501,7 @@ HandlePtrBtn(struct xkb_context *ctx, const struct xkb_mod_set *mods,
     return ReportIllegal(ctx, action->type, field);
 }
 
-static const LookupEntry ptrDflts[] = {
+const LookupEntry ptrDflts[] = {
     { "dfltbtn", 1 },
     { "defaultbutton", 1 },
     { "button", 1 },
@@ -52,5 +52,7 @@ SetActionField(struct xkb_context *ctx, ActionsInfo *info,
                struct xkb_mod_set *mods, const char *elem,
                const char *field, ExprDef *array_ndx, ExprDef *value);
 
+extern const LookupEntry lockWhich[];
+extern const LookupEntry ptrDflts[];
 
 #endif
@@ -221,11 +221,15 @@ typedef struct {
     ExprDef *args;
 } ExprAction;
 
+/* The arrays are allocated from the arena, see ExprAppendKeysymList(). */
 typedef struct {
     ExprCommon expr;
-    darray(xkb_keysym_t) syms;
-    darray(unsigned int) symsMapIndex;
-    darray(unsigned int) symsNumEntries;
+    xkb_keysym_t *syms;
+    unsigned int num_syms;
+    /* For each level, the index of its first keysym, and their number. */
+    unsigned int *symsMapIndex;
+    unsigned int *symsNumEntries;
+    unsigned int num_levels;
 } ExprKeysymList;
 
 union ExprDef {
@@ -335,8 +339,13 @@ enum xkb_map_flags {
     MAP_IS_ALTGR = (1 << 7),
 };
 
+/*
+ * All of the nodes of a parsed file, down to the strings, are allocated
+ * from a single arena, which is freed with FreeXkbFile().
+ */
 typedef struct {
     ParseCommon common;
+    struct arena *arena;
     enum xkb_file_type file_type;
     char *topName;
     char *name;
@@ -0,0 +1,2087 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * A fast path for keymap strings in the form written by keymap-dump.c,
+ * which is what clients mostly get handed by the server: a single
+ * xkb_keymap block holding the keycodes, types, compat and symbols
+ * sections in that order, with no includes, merge modes or defaults, and
+ * where every statement can be resolved as soon as it is read.
+ *
+ * Such strings are compiled straight into the keymap in one pass over
+ * the text, without building an AST and without the merging done by the
+ * per-section *Info structures.  The recognizer is conservative: on
+ * anything it does not understand, or which the full compiler would
+ * warn about, merge or reject, it gives up and the caller falls back to
+ * the full compiler.  Formatting and comments do not matter.
+ */
+
+#include "xkbcomp-priv.h"
+#include "text.h"
+#include "expr.h"
+#include "action.h"
+#include "parser-priv.h"
+#include "scanner-utils.h"
+
+/* Leave keymaps with absurd keycodes to the full compiler. */
+#define CANON_MAX_KEYCODE 0xffff
+
+enum canon_repeat {
+    CANON_REPEAT_UNDEFINED = 0,
+    CANON_REPEAT_YES,
+    CANON_REPEAT_NO,
+};
+
+struct canon_key_index {
+    xkb_atom_t name;
+    xkb_keycode_t keycode;
+};
+
+struct canon_group {
+    bool has_type, has_syms, has_acts;
+    xkb_atom_t type;
+    darray(struct xkb_level) levels;
+};
+
+/* The parts of a key statement which are not per-group. */
+struct canon_key {
+    xkb_atom_t default_type;
+    enum canon_repeat repeat;
+    bool has_vmodmap;
+    xkb_mod_mask_t vmodmap;
+    enum xkb_range_exceed_type out_of_range_group_action;
+    xkb_layout_index_t out_of_range_group_number;
+};
+
+struct canon {
+    struct scanner s;
+    struct xkb_context *ctx;
+    struct xkb_keymap *keymap;
+    ActionsInfo *actions;
+
+    /* Keycodes. */
+    darray(xkb_atom_t) key_names;
+    xkb_keycode_t min_key_code, max_key_code;
+    darray(struct canon_key_index) key_index;
+    darray(struct xkb_key_alias) aliases;
+
+    /* Types. */
+    darray(struct xkb_key_type) types;
+    darray(struct xkb_key_type_entry) entries;
+    darray(xkb_atom_t) level_names;
+
+    /* Compat. */
+    struct xkb_sym_interpret default_interp;
+    darray(struct xkb_sym_interpret) interps;
+    darray(struct xkb_led) leds;
+
+    /* Symbols. */
+    darray(xkb_atom_t) group_names;
+    struct canon_group groups[XKB_MAX_GROUPS];
+    darray(xkb_keysym_t) syms;
+};
+
+static void
+clear_groups(struct canon *c)
+{
+    struct xkb_level *level;
+
+    for (xkb_layout_index_t i = 0; i < XKB_MAX_GROUPS; i++) {
+        struct canon_group *g = &c->groups[i];
+
+        darray_foreach(level, g->levels)
+            if (level->num_syms > 1)
+                free(level->u.syms);
+        darray_resize(g->levels, 0);
+        g->has_type = g->has_syms = g->has_acts = false;
+        g->type = XKB_ATOM_NONE;
+    }
+}
+
+static void
+clear_canon(struct canon *c)
+{
+    struct xkb_key_type *type;
+
+    FreeActionsInfo(c->actions);
+    darray_free(c->key_names);
+    darray_free(c->key_index);
+    darray_free(c->aliases);
+    darray_foreach(type, c->types) {
+        free(type->entries);
+        free(type->level_names);
+    }
+    darray_free(c->types);
+    darray_free(c->entries);
+    darray_free(c->level_names);
+    darray_free(c->interps);
+    darray_free(c->leds);
+    darray_free(c->group_names);
+    clear_groups(c);
+    for (xkb_layout_index_t i = 0; i < XKB_MAX_GROUPS; i++)
+        darray_free(c->groups[i].levels);
+    darray_free(c->syms);
+}
+
+/***====================================================================***/
+
+/*
+ * Tokens.  These mirror the lexer in scanner.c, but fail instead of
+ * reporting errors; identifiers are copied to the scanner buffer, so the
+ * sval returned by word() and ident() is NUL-terminated, and is only
+ * valid until the next one is read.
+ */
+
+static void
+skip_space(struct canon *c)
+{
+    struct scanner *s = &c->s;
+
+    for (;;) {
+        while (is_space(peek(s)))
+            next(s);
+        if (!lit(s, "//") && !chr(s, '#'))
+            return;
+        while (!eof(s) && !eol(s))
+            next(s);
+    }
+}
+
+static bool
+tok(struct canon *c, char ch)
+{
+    skip_space(c);
+    return chr(&c->s, ch);
+}
+
+static bool
+peek_tok(struct canon *c, char ch)
+{
+    skip_space(c);
+    return peek(&c->s) == ch;
+}
+
+/* An identifier, keyword or not. */
+static bool
+word(struct canon *c, struct sval *out)
+{
+    struct scanner *s = &c->s;
+
+    skip_space(c);
+    if (!is_alpha(peek(s)) && peek(s) != '_')
+        return false;
+
+    s->buf_pos = 0;
+    while (is_alnum(peek(s)) || peek(s) == '_')
+        if (!buf_append(s, next(s)))
+            return false;
+    if (!buf_append(s, '\0'))
+        return false;
+
+    out->start = s->buf;
+    out->len = s->buf_pos - 1;
+    return true;
+}
+
+/* An identifier used as a value; the grammar only allows "default". */
+static bool
+ident(struct canon *c, struct sval *out)
+{
+    int token;
+
+    if (!word(c, out))
+        return false;
+
+    token = keyword_to_token(out->start, out->len);
+    return token == -1 || token == DEFAULT;
+}
+
+static bool
+name_ident(struct canon *c, struct sval *out)
+{
+    return word(c, out) && keyword_to_token(out->start, out->len) == -1;
+}
+
+static bool
+keyword(struct canon *c, int *token)
+{
+    struct sval sv;
+
+    if (!word(c, &sv))
+        return false;
+
+    *token = keyword_to_token(sv.start, sv.len);
+    return true;
+}
+
+static int
+hex_value(char ch)
+{
+    if (is_digit(ch))
+        return ch - '0';
+    return (ch | 0x20) - 'a' + 10;
+}
+
+/* A non-negative decimal or hexadecimal integer which fits in an int. */
+static bool
+integer(struct canon *c, int *out)
+{
+    struct scanner *s = &c->s;
+    int64_t val = 0;
+
+    skip_space(c);
+    if (lit(s, "0x")) {
+        if (!is_xdigit(peek(s)))
+            return false;
+        while (is_xdigit(peek(s))) {
+            val = val * 16 + hex_value(next(s));
+            if (val > INT_MAX)
+                return false;
+        }
+    }
+    else {
+        if (!is_digit(peek(s)))
+            return false;
+        while (is_digit(peek(s))) {
+            val = val * 10 + (next(s) - '0');
+            if (val > INT_MAX)
+                return false;
+        }
+    }
+
+    /* Floats, and numbers running into identifiers. */
+    if (peek(s) == '.' || is_alnum(peek(s)) || peek(s) == '_')
+        return false;
+
+    *out = (int) val;
+    return true;
+}
+
+/* A string literal without escapes. */
+static bool
+string(struct canon *c, struct sval *out)
+{
+    struct scanner *s = &c->s;
+
+    if (!tok(c, '\"'))
+        return false;
+
+    out->start = s->s + s->pos;
+    while (peek(s) != '\"') {
+        if (eof(s) || eol(s) || peek(s) == '\\' || peek(s) == '\0')
+            return false;
+        next(s);
+    }
+    out->len = s->s + s->pos - out->start;
+    next(s);
+
+    return out->len < sizeof(s->buf) - 1;
+}
+
+static bool
+string_atom(struct canon *c, xkb_atom_t *out)
+{
+    struct sval sv;
+
+    if (!string(c, &sv))
+        return false;
+
+    *out = xkb_atom_intern(c->ctx, sv.start, sv.len);
+    return *out != XKB_ATOM_NONE;
+}
+
+static bool
+keyname(struct canon *c, xkb_atom_t *out)
+{
+    struct scanner *s = &c->s;
+    const char *start;
+    size_t len;
+
+    if (!tok(c, '<'))
+        return false;
+
+    start = s->s + s->pos;
+    while (is_graph(peek(s)) && peek(s) != '>')
+        next(s);
+    len = s->s + s->pos - start;
+    if (!chr(s, '>') || len >= sizeof(s->buf) - 1)
+        return false;
+
+    *out = xkb_atom_intern(c->ctx, start, len);
+    return *out != XKB_ATOM_NONE;
+}
+
+/* See KeySym in parser.y. */
+static bool
+keysym(struct canon *c, xkb_keysym_t *out)
+{
+    struct sval sv;
+    int token, val;
+
+    skip_space(c);
+    if (is_digit(peek(&c->s))) {
+        if (!integer(c, &val))
+            return false;
+
+        if (val < 10) {
+            *out = XKB_KEY_0 + (xkb_keysym_t) val;
+            return true;
+        }
+
+        snprintf(c->s.buf, sizeof(c->s.buf), "0x%x", val);
+        *out = xkb_keysym_from_name(c->s.buf, XKB_KEYSYM_NO_FLAGS);
+        return *out != XKB_KEY_NoSymbol;
+    }
+
+    if (!word(c, &sv))
+        return false;
+
+    token = keyword_to_token(sv.start, sv.len);
+    if (token == SECTION) {
+        *out = XKB_KEY_section;
+        return true;
+    }
+    if (token != -1)
+        return false;
+
+    if (istreq(sv.start, "any") || istreq(sv.start, "nosymbol")) {
+        *out = XKB_KEY_NoSymbol;
+        return true;
+    }
+
+    if (istreq(sv.start, "none") || istreq(sv.start, "voidsymbol")) {
+        *out = XKB_KEY_VoidSymbol;
+        return true;
+    }
+
+    *out = xkb_keysym_from_name(sv.start, XKB_KEYSYM_NO_FLAGS);
+    return *out != XKB_KEY_NoSymbol;
+}
+
+/* A leading + or -, which makes some action fields relative. */
+static int
+sign(struct canon *c)
+{
+    if (tok(c, '-'))
+        return -1;
+    if (tok(c, '+'))
+        return 1;
+    return 0;
+}
+
+/***====================================================================***/
+
+/*
+ * Values.  Only the expressions keymap-dump.c writes are accepted: masks
+ * are terms joined with '+', and everything else is a single term.
+ */
+
+static bool
+int_lookup(struct canon *c, const LookupEntry *tab, int *out)
+{
+    struct sval sv;
+    unsigned int val;
+
+    skip_space(c);
+    if (is_digit(peek(&c->s)))
+        return integer(c, out);
+
+    if (!ident(c, &sv) || !LookupString(tab, sv.start, &val))
+        return false;
+
+    *out = (int) val;
+    return true;
+}
+
+static bool
+group_index(struct canon *c, xkb_layout_index_t *out)
+{
+    int val;
+
+    if (!int_lookup(c, groupNames, &val) || val <= 0 || val > XKB_MAX_GROUPS)
+        return false;
+
+    *out = (xkb_layout_index_t) val;
+    return true;
+}
+
+static bool
+level_index(struct canon *c, xkb_level_index_t *out)
+{
+    int val;
+
+    if (!int_lookup(c, levelNames, &val) || val < 1)
+        return false;
+
+    *out = (xkb_level_index_t) (val - 1);
+    return true;
+}
+
+static bool
+enum_value(struct canon *c, const LookupEntry *tab, unsigned int *out)
+{
+    struct sval sv;
+
+    return ident(c, &sv) && LookupString(tab, sv.start, out);
+}
+
+static bool
+boolean(struct canon *c, bool *out)
+{
+    struct sval sv;
+
+    if (!ident(c, &sv))
+        return false;
+
+    if (istreq(sv.start, "true") || istreq(sv.start, "yes") ||
+        istreq(sv.start, "on"))
+        *out = true;
+    else if (istreq(sv.start, "false") || istreq(sv.start, "no") ||
+             istreq(sv.start, "off"))
+        *out = false;
+    else
+        return false;
+
+    return true;
+}
+
+static bool
+mask(struct canon *c, const LookupEntry *tab, unsigned int *out)
+{
+    unsigned int val = 0;
+    int term;
+
+    do {
+        if (!int_lookup(c, tab, &term))
+            return false;
+        val |= (unsigned int) term;
+    } while (tok(c, '+'));
+
+    *out = val;
+    return true;
+}
+
+/* See LookupModMask() in expr.c. */
+static bool
+mod_name_mask(struct canon *c, struct sval name, enum mod_type type,
+              xkb_mod_mask_t *out)
+{
+    xkb_mod_index_t ndx;
+
+    if (istreq(name.start, "all")) {
+        *out = MOD_REAL_MASK_ALL;
+        return true;
+    }
+
+    if (istreq(name.start, "none")) {
+        *out = 0;
+        return true;
+    }
+
+    ndx = XkbModNameToIndex(&c->keymap->mods,
+                            xkb_atom_intern(c->ctx, name.start, name.len),
+                            type);
+    if (ndx == XKB_MOD_INVALID)
+        return false;
+
+    *out = (1u << ndx);
+    return true;
+}
+
+static bool
+mod_term(struct canon *c, enum mod_type type, xkb_mod_mask_t *out)
+{
+    struct sval sv;
+    int val;
+
+    skip_space(c);
+    if (is_digit(peek(&c->s))) {
+        if (!integer(c, &val))
+            return false;
+        *out = (xkb_mod_mask_t) val;
+        return true;
+    }
+
+    return ident(c, &sv) && mod_name_mask(c, sv, type, out);
+}
+
+static bool
+mod_mask(struct canon *c, enum mod_type type, xkb_mod_mask_t *out)
+{
+    xkb_mod_mask_t val = 0, term;
+
+    do {
+        if (!mod_term(c, type, &term))
+            return false;
+        val |= term;
+    } while (tok(c, '+'));
+
+    *out = val;
+    return true;
+}
+
+static bool
+mod_index(struct canon *c, enum mod_type type, xkb_mod_index_t *out)
+{
+    struct sval sv;
+
+    if (!ident(c, &sv))
+        return false;
+
+    *out = XkbModNameToIndex(&c->keymap->mods,
+                             xkb_atom_intern(c->ctx, sv.start, sv.len),
+                             type);
+    return *out != XKB_MOD_INVALID;
+}
+
+/***====================================================================***/
+
+enum canon_action_field {
+    CANON_FIELD_CLEAR_LOCKS,
+    CANON_FIELD_LATCH_TO_LOCK,
+    CANON_FIELD_AFFECT,
+    CANON_FIELD_MODIFIERS,
+    CANON_FIELD_GROUP,
+    CANON_FIELD_X,
+    CANON_FIELD_Y,
+    CANON_FIELD_ACCEL,
+    CANON_FIELD_BUTTON,
+    CANON_FIELD_VALUE,
+    CANON_FIELD_CONTROLS,
+    CANON_FIELD_COUNT,
+    CANON_FIELD_SCREEN,
+    CANON_FIELD_SAME,
+    CANON_FIELD_TYPE,
+    CANON_FIELD_DATA,
+};
+
+/* The subset of the action fields in action.c which we handle. */
+static const LookupEntry actionFields[] = {
+    { "clearLocks",  CANON_FIELD_CLEAR_LOCKS   },
+    { "latchToLock", CANON_FIELD_LATCH_TO_LOCK },
+    { "affect",      CANON_FIELD_AFFECT        },
+    { "modifiers",   CANON_FIELD_MODIFIERS     },
+    { "mods",        CANON_FIELD_MODIFIERS     },
+    { "group",       CANON_FIELD_GROUP         },
+    { "x",           CANON_FIELD_X             },
+    { "y",           CANON_FIELD_Y             },
+    { "accel",       CANON_FIELD_ACCEL         },
+    { "accelerate",  CANON_FIELD_ACCEL         },
+    { "repeat",      CANON_FIELD_ACCEL         },
+    { "button",      CANON_FIELD_BUTTON        },
+    { "value",       CANON_FIELD_VALUE         },
+    { "controls",    CANON_FIELD_CONTROLS      },
+    { "ctrls",       CANON_FIELD_CONTROLS      },
+    { "count",       CANON_FIELD_COUNT         },
+    { "screen",      CANON_FIELD_SCREEN        },
+    { "same",        CANON_FIELD_SAME          },
+    { "sameServer",  CANON_FIELD_SAME          },
+    { "type",        CANON_FIELD_TYPE          },
+    { "data",        CANON_FIELD_DATA          },
+    { NULL,          0                         }
+};
+
+/* "flag", "!flag", "~flag" or "flag=<boolean>". */
+static bool
+action_flag(struct canon *c, bool has_value, bool set,
+            enum xkb_action_flags flag, enum xkb_action_flags *flags)
+{
+    if (has_value && !boolean(c, &set))
+        return false;
+
+    if (set)
+        *flags |= flag;
+    else
+        *flags &= ~flag;
+    return true;
+}
+
+static bool
+action_affect(struct canon *c, enum xkb_action_flags *flags)
+{
+    unsigned int val;
+
+    if (!enum_value(c, lockWhich, &val))
+        return false;
+
+    *flags &= ~(ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK);
+    *flags |= val;
+    return true;
+}
+
+/* See CheckModifierField() in action.c. */
+static bool
+action_mods(struct canon *c, struct xkb_mod_action *act)
+{
+    struct sval sv;
+    xkb_mod_mask_t val, term;
+
+    skip_space(c);
+    if (is_digit(peek(&c->s)))
+        return mod_mask(c, MOD_BOTH, &act->mods.mods);
+
+    if (!ident(c, &sv))
+        return false;
+
+    if ((istreq(sv.start, "usemodmapmods") || istreq(sv.start, "modmapmods")) &&
+        !peek_tok(c, '+')) {
+        act->mods.mods = 0;
+        act->flags |= ACTION_MODS_LOOKUP_MODMAP;
+        return true;
+    }
+
+    if (!mod_name_mask(c, sv, MOD_BOTH, &val))
+        return false;
+
+    while (tok(c, '+')) {
+        if (!mod_term(c, MOD_BOTH, &term))
+            return false;
+        val |= term;
+    }
+
+    act->mods.mods = val;
+    act->flags &= ~ACTION_MODS_LOOKUP_MODMAP;
+    return true;
+}
+
+/* See CheckGroupField() in action.c. */
+static bool
+action_group(struct canon *c, struct xkb_group_action *act)
+{
+    xkb_layout_index_t idx;
+    int sgn = sign(c);
+
+    if (!group_index(c, &idx))
+        return false;
+
+    if (sgn != 0) {
+        act->flags &= ~ACTION_ABSOLUTE_SWITCH;
+        act->group = sgn * (int32_t) idx;
+    }
+    else {
+        act->flags |= ACTION_ABSOLUTE_SWITCH;
+        act->group = (int32_t) (idx - 1);
+    }
+    return true;
+}
+
+/* See HandlePrivate() in action.c. */
+static bool
+private_arg(struct canon *c, unsigned int field, int ndx,
+            struct xkb_private_action *act)
+{
+    struct sval sv;
+    int val;
+
+    if (field == CANON_FIELD_TYPE) {
+        if (!integer(c, &val) || val > 255)
+            return false;
+        if (val < ACTION_TYPE_PRIVATE)
+            act->type = ACTION_TYPE_NONE;
+        else
+            act->type = (enum xkb_action_type) val;
+        return true;
+    }
+
+    if (field != CANON_FIELD_DATA)
+        return false;
+
+    if (ndx < 0) {
+        if (!string(c, &sv) || sv.len < 1 || sv.len > sizeof(act->data))
+            return false;
+        memset(act->data, 0, sizeof(act->data));
+        memcpy(act->data, sv.start, sv.len);
+        return true;
+    }
+
+    if ((size_t) ndx >= sizeof(act->data) || !integer(c, &val) || val > 255)
+        return false;
+
+    act->data[ndx] = (uint8_t) val;
+    return true;
+}
+
+static bool
+action_arg(struct canon *c, enum xkb_action_type handler,
+           union xkb_action *action)
+{
+    struct sval sv;
+    unsigned int field;
+    bool negated, has_value;
+    int sgn, val, ndx = -1;
+
+    negated = tok(c, '!') || tok(c, '~');
+    if (!word(c, &sv) || !LookupString(actionFields, sv.start, &field))
+        return false;
+
+    if (field == CANON_FIELD_DATA && tok(c, '[')) {
+        if (!integer(c, &ndx) || !tok(c, ']'))
+            return false;
+    }
+
+    has_value = tok(c, '=');
+    if (negated && has_value)
+        return false;
+
+    /* Everything but the flags needs a value. */
+    if (!has_value && field != CANON_FIELD_CLEAR_LOCKS &&
+        field != CANON_FIELD_LATCH_TO_LOCK && field != CANON_FIELD_ACCEL &&
+        field != CANON_FIELD_SAME)
+        return false;
+
+    /* A Private action can change its own type. */
+    switch (handler) {
+    case ACTION_TYPE_MOD_SET:
+    case ACTION_TYPE_MOD_LATCH:
+    case ACTION_TYPE_MOD_LOCK:
+        if (field == CANON_FIELD_MODIFIERS)
+            return action_mods(c, &action->mods);
+        if (field == CANON_FIELD_CLEAR_LOCKS &&
+            action->type != ACTION_TYPE_MOD_LOCK)
+            return action_flag(c, has_value, !negated, ACTION_LOCK_CLEAR,
+                               &action->mods.flags);
+        if (field == CANON_FIELD_LATCH_TO_LOCK &&
+            action->type == ACTION_TYPE_MOD_LATCH)
+            return action_flag(c, has_value, !negated, ACTION_LATCH_TO_LOCK,
+                               &action->mods.flags);
+        if (field == CANON_FIELD_AFFECT &&
+            action->type == ACTION_TYPE_MOD_LOCK)
+            return action_affect(c, &action->mods.flags);
+        return false;
+
+    case ACTION_TYPE_GROUP_SET:
+    case ACTION_TYPE_GROUP_LATCH:
+    case ACTION_TYPE_GROUP_LOCK:
+        if (field == CANON_FIELD_GROUP)
+            return action_group(c, &action->group);
+        if (field == CANON_FIELD_CLEAR_LOCKS &&
+            action->type != ACTION_TYPE_GROUP_LOCK)
+            return action_flag(c, has_value, !negated, ACTION_LOCK_CLEAR,
+                               &action->group.flags);
+        if (field == CANON_FIELD_LATCH_TO_LOCK &&
+            action->type == ACTION_TYPE_GROUP_LATCH)
+            return action_flag(c, has_value, !negated, ACTION_LATCH_TO_LOCK,
+                               &action->group.flags);
+        return false;
+
+    case ACTION_TYPE_PTR_MOVE:
+        if (field == CANON_FIELD_X || field == CANON_FIELD_Y) {
+            sgn = sign(c);
+            if (!integer(c, &val))
+                return false;
+            if (sgn < 0)
+                val = -val;
+            if (val < INT16_MIN || val > INT16_MAX)
+                return false;
+
+            if (field == CANON_FIELD_X) {
+                if (sgn == 0)
+                    action->ptr.flags |= ACTION_ABSOLUTE_X;
+                action->ptr.x = (int16_t) val;
+            }
+            else {
+                if (sgn == 0)
+                    action->ptr.flags |= ACTION_ABSOLUTE_Y;
+                action->ptr.y = (int16_t) val;
+            }
+            return true;
+        }
+        if (field == CANON_FIELD_ACCEL)
+            return action_flag(c, has_value, !negated, ACTION_ACCEL,
+                               &action->ptr.flags);
+        return false;
+
+    case ACTION_TYPE_PTR_BUTTON:
+    case ACTION_TYPE_PTR_LOCK:
+        if (field == CANON_FIELD_BUTTON) {
+            sgn = sign(c);
+            if (!int_lookup(c, buttonNames, &val))
+                return false;
+            if (sgn < 0)
+                val = -val;
+            if (val < 0 || val > 5)
+                return false;
+            action->btn.button = (uint8_t) val;
+            return true;
+        }
+        if (field == CANON_FIELD_COUNT) {
+            sgn = sign(c);
+            if (!integer(c, &val))
+                return false;
+            if (sgn < 0)
+                val = -val;
+            if (val < 0 || val > 255)
+                return false;
+            action->btn.count = (uint8_t) val;
+            return true;
+        }
+        if (field == CANON_FIELD_AFFECT &&
+            action->type == ACTION_TYPE_PTR_LOCK)
+            return action_affect(c, &action->btn.flags);
+        return false;
+
+    case ACTION_TYPE_PTR_DEFAULT:
+        if (field == CANON_FIELD_AFFECT)
+            return enum_value(c, ptrDflts, &field);
+        if (field == CANON_FIELD_BUTTON || field == CANON_FIELD_VALUE) {
+            sgn = sign(c);
+            if (!int_lookup(c, buttonNames, &val) || val < 1 || val > 5)
+                return false;
+            if (sgn != 0)
+                action->dflt.flags &= ~ACTION_ABSOLUTE_SWITCH;
+            else
+                action->dflt.flags |= ACTION_ABSOLUTE_SWITCH;
+            action->dflt.value = (int8_t) (sgn < 0 ? -val : val);
+            return true;
+        }
+        return false;
+
+    case ACTION_TYPE_SWITCH_VT:
+        if (field == CANON_FIELD_SCREEN) {
+            sgn = sign(c);
+            if (!integer(c, &val) || val > 255)
+                return false;
+            if (sgn != 0)
+                action->screen.flags &= ~ACTION_ABSOLUTE_SWITCH;
+            else
+                action->screen.flags |= ACTION_ABSOLUTE_SWITCH;
+            action->screen.screen = (int8_t) (sgn < 0 ? -val : val);
+            return true;
+        }
+        if (field == CANON_FIELD_SAME)
+            return action_flag(c, has_value, !negated, ACTION_SAME_SCREEN,
+                               &action->screen.flags);
+        return false;
+
+    case ACTION_TYPE_CTRL_SET:
+    case ACTION_TYPE_CTRL_LOCK:
+        if (field == CANON_FIELD_CONTROLS)
+            return mask(c, ctrlMaskNames, &action->ctrls.ctrls);
+        if (field == CANON_FIELD_AFFECT)
+            return action_affect(c, &action->ctrls.flags);
+        return false;
+
+    case ACTION_TYPE_PRIVATE:
+        return private_arg(c, field, ndx, &action->priv);
+
+    default:
+        return false;
+    }
+}
+
+/* See HandleActionDef() in action.c. */
+static bool
+action(struct canon *c, union xkb_action *action)
+{
+    struct sval sv;
+    unsigned int type;
+
+    if (!name_ident(c, &sv) ||
+        !LookupString(actionTypeNames, sv.start, &type))
+        return false;
+
+    *action = c->actions->actions[type];
+
+    if (!tok(c, '('))
+        return false;
+    if (tok(c, ')'))
+        return true;
+
+    do {
+        if (!action_arg(c, type, action))
+            return false;
+    } while (tok(c, ','));
+
+    return tok(c, ')');
+}
+
+/***====================================================================***/
+
+static bool
+vmod_decl(struct canon *c)
+{
+    struct xkb_mod_set *mods = &c->keymap->mods;
+    struct sval sv;
+    xkb_atom_t name;
+    xkb_mod_index_t i;
+    struct xkb_mod *mod;
+
+    do {
+        if (!name_ident(c, &sv))
+            return false;
+        name = xkb_atom_intern(c->ctx, sv.start, sv.len);
+
+        xkb_mods_enumerate(i, mod, mods)
+            if (mod->name == name)
+                break;
+
+        if (i < mods->num_mods) {
+            if (mod->type != MOD_VIRT)
+                return false;
+            continue;
+        }
+
+        if (mods->num_mods >= XKB_MAX_MODS)
+            return false;
+
+        mods->mods[mods->num_mods].name = name;
+        mods->mods[mods->num_mods].type = MOD_VIRT;
+        mods->mods[mods->num_mods].mapping = 0;
+        mods->num_mods++;
+    } while (tok(c, ','));
+
+    return tok(c, ';');
+}
+
+static bool
+section_name(struct canon *c, char **out)
+{
+    struct sval sv;
+
+    if (!peek_tok(c, '\"'))
+        return true;
+
+    if (!string(c, &sv))
+        return false;
+
+    *out = strndup(sv.start, sv.len);
+    if (!*out)
+        return false;
+
+    XkbEscapeMapName(*out);
+    return true;
+}
+
+/***====================================================================***/
+
+static int
+cmp_key_index(const void *a, const void *b)
+{
+    const struct canon_key_index *ka = a, *kb = b;
+
+    return (ka->name > kb->name) - (ka->name < kb->name);
+}
+
+static struct xkb_key *
+find_key(struct canon *c, xkb_atom_t name, bool use_aliases)
+{
+    struct canon_key_index needle = { .name = name };
+    const struct canon_key_index *found;
+
+    found = bsearch(&needle, c->key_index.item, darray_size(c->key_index),
+                    sizeof(needle), cmp_key_index);
+
+    /* Aliases can't have the name of a real key, so this order is fine. */
+    if (!found && use_aliases) {
+        needle.name = XkbResolveKeyAlias(c->keymap, name);
+        if (needle.name == XKB_ATOM_NONE)
+            return NULL;
+        found = bsearch(&needle, c->key_index.item,
+                        darray_size(c->key_index), sizeof(needle),
+                        cmp_key_index);
+    }
+
+    return found ? &c->keymap->keys[found->keycode] : NULL;
+}
+
+static bool
+keycode_def(struct canon *c)
+{
+    xkb_atom_t name;
+    int kc;
+
+    if (!keyname(c, &name) || !tok(c, '=') || !integer(c, &kc) ||
+        kc > CANON_MAX_KEYCODE || !tok(c, ';'))
+        return false;
+
+    if ((unsigned) kc >= darray_size(c->key_names))
+        darray_resize0(c->key_names, kc + 1);
+    else if (darray_item(c->key_names, kc) != XKB_ATOM_NONE)
+        return false;
+
+    darray_item(c->key_names, kc) = name;
+    if ((xkb_keycode_t) kc < c->min_key_code)
+        c->min_key_code = kc;
+    if (c->max_key_code == XKB_KEYCODE_INVALID ||
+        (xkb_keycode_t) kc > c->max_key_code)
+        c->max_key_code = kc;
+    return true;
+}
+
+static bool
+alias_def(struct canon *c)
+{
+    struct xkb_key_alias *iter, alias;
+
+    if (!keyname(c, &alias.alias) || !tok(c, '=') ||
+        !keyname(c, &alias.real) || !tok(c, ';'))
+        return false;
+
+    darray_foreach(iter, c->aliases)
+        if (iter->alias == alias.alias)
+            return false;
+
+    darray_append(c->aliases, alias);
+    return true;
+}
+
+static bool
+led_name_def(struct canon *c)
+{
+    struct xkb_keymap *keymap = c->keymap;
+    xkb_atom_t name;
+    xkb_led_index_t i;
+    struct xkb_led *led;
+    int ndx;
+
+    if (!integer(c, &ndx) || ndx < 1 || ndx > (int) XKB_MAX_LEDS ||
+        !tok(c, '=') || !string_atom(c, &name) || !tok(c, ';'))
+        return false;
+
+    xkb_leds_enumerate(i, led, keymap)
+        if (led->name == name)
+            return false;
+
+    led = &keymap->leds[ndx - 1];
+    if (led->name != XKB_ATOM_NONE)
+        return false;
+
+    led->name = name;
+    if ((unsigned) ndx > keymap->num_leds)
+        keymap->num_leds = ndx;
+    return true;
+}
+
+static bool
+finish_keycodes(struct canon *c)
+{
+    struct xkb_keymap *keymap = c->keymap;
+    xkb_keycode_t min_key_code, max_key_code, kc;
+    struct canon_key_index *iter;
+    struct xkb_key_alias *alias;
+
+    min_key_code = c->min_key_code;
+    max_key_code = c->max_key_code;
+    if (max_key_code == XKB_KEYCODE_INVALID) {
+        min_key_code = 8;
+        max_key_code = 255;
+    }
+
+    keymap->keys = calloc(max_key_code + 1, sizeof(*keymap->keys));
+    if (!keymap->keys)
+        return false;
+
+    for (kc = min_key_code; kc <= max_key_code; kc++)
+        keymap->keys[kc].keycode = kc;
+
+    for (kc = 0; kc < darray_size(c->key_names); kc++) {
+        struct canon_key_index entry;
+
+        if (darray_item(c->key_names, kc) == XKB_ATOM_NONE)
+            continue;
+
+        entry.name = darray_item(c->key_names, kc);
+        entry.keycode = kc;
+        keymap->keys[kc].name = entry.name;
+        darray_append(c->key_index, entry);
+    }
+
+    keymap->min_key_code = min_key_code;
+    keymap->max_key_code = max_key_code;
+
+    qsort(c->key_index.item, darray_size(c->key_index),
+          sizeof(*c->key_index.item), cmp_key_index);
+
+    darray_foreach_from(iter, c->key_index, 1)
+        if (iter->name == (iter - 1)->name)
+            return false;
+
+    darray_foreach(alias, c->aliases)
+        if (!find_key(c, alias->real, false) ||
+            find_key(c, alias->alias, false))
+            return false;
+
+    darray_steal(c->aliases, &keymap->key_aliases, &keymap->num_key_aliases);
+    return true;
+}
+
+static bool
+keycodes_body(struct canon *c)
+{
+    struct sval sv;
+    int token, val;
+
+    c->min_key_code = XKB_KEYCODE_INVALID;
+    c->max_key_code = XKB_KEYCODE_INVALID;
+
+    while (!peek_tok(c, '}')) {
+        if (peek(&c->s) == '<') {
+            if (!keycode_def(c))
+                return false;
+            continue;
+        }
+
+        if (!word(c, &sv))
+            return false;
+
+        token = keyword_to_token(sv.start, sv.len);
+        if (token == ALIAS) {
+            if (!alias_def(c))
+                return false;
+        }
+        else if (token == INDICATOR) {
+            if (!led_name_def(c))
+                return false;
+        }
+        else if (token == -1 && (istreq(sv.start, "minimum") ||
+                                 istreq(sv.start, "maximum"))) {
+            /* Ignored, like in keycodes.c. */
+            if (!tok(c, '=') || !integer(c, &val) || !tok(c, ';'))
+                return false;
+        }
+        else {
+            return false;
+        }
+    }
+
+    return finish_keycodes(c);
+}
+
+/***====================================================================***/
+
+static struct xkb_key_type_entry *
+find_entry(struct canon *c, xkb_mod_mask_t mods)
+{
+    struct xkb_key_type_entry *entry;
+
+    darray_foreach(entry, c->entries)
+        if (entry->mods.mods == mods)
+            return entry;
+
+    return NULL;
+}
+
+/* See SetKeyTypeField() in types.c. */
+static bool
+type_field(struct canon *c, struct xkb_key_type *type, bool *have_mods)
+{
+    struct xkb_key_type_entry *entry, new;
+    struct sval sv;
+    xkb_mod_mask_t mods, preserve;
+    xkb_level_index_t level;
+    xkb_atom_t name;
+
+    if (!word(c, &sv))
+        return false;
+
+    if (istreq(sv.start, "modifiers")) {
+        if (*have_mods || !tok(c, '=') ||
+            !mod_mask(c, MOD_BOTH, &type->mods.mods))
+            return false;
+        *have_mods = true;
+    }
+    else if (istreq(sv.start, "map")) {
+        if (!tok(c, '[') || !mod_mask(c, MOD_BOTH, &mods) ||
+            !tok(c, ']') || !tok(c, '=') || !level_index(c, &level))
+            return false;
+
+        if ((mods & ~type->mods.mods) || find_entry(c, mods))
+            return false;
+
+        new.level = level;
+        new.mods.mods = mods;
+        new.mods.mask = 0;
+        new.preserve.mods = 0;
+        new.preserve.mask = 0;
+        darray_append(c->entries, new);
+    }
+    else if (istreq(sv.start, "preserve")) {
+        if (!tok(c, '[') || !mod_mask(c, MOD_BOTH, &mods) ||
+            !tok(c, ']') || !tok(c, '=') ||
+            !mod_mask(c, MOD_BOTH, &preserve))
+            return false;
+
+        if ((mods & ~type->mods.mods) || (preserve & ~mods))
+            return false;
+
+        entry = find_entry(c, mods);
+        if (!entry || entry->preserve.mods != 0)
+            return false;
+
+        entry->preserve.mods = preserve;
+    }
+    else if (istreq(sv.start, "level_name") ||
+             istreq(sv.start, "levelname")) {
+        if (!tok(c, '[') || !level_index(c, &level) || !tok(c, ']') ||
+            !tok(c, '=') || !string_atom(c, &name))
+            return false;
+
+        if (level >= darray_size(c->level_names))
+            darray_resize0(c->level_names, level + 1);
+        else if (darray_item(c->level_names, level) != XKB_ATOM_NONE)
+            return false;
+
+        darray_item(c->level_names, level) = name;
+    }
+    else {
+        return false;
+    }
+
+    return tok(c, ';');
+}
+
+static bool
+type_def(struct canon *c)
+{
+    struct xkb_key_type type = { 0 }, *iter;
+    bool have_mods = false;
+
+    if (!string_atom(c, &type.name) || !tok(c, '{'))
+        return false;
+
+    darray_foreach(iter, c->types)
+        if (iter->name == type.name)
+            return false;
+
+    darray_resize(c->entries, 0);
+    darray_resize(c->level_names, 0);
+
+    do {
+        if (!type_field(c, &type, &have_mods))
+            return false;
+    } while (!peek_tok(c, '}'));
+
+    if (!tok(c, '}') || !tok(c, ';'))
+        return false;
+
+    /* As in CopyKeyTypesToKeymap(). */
+    darray_steal(c->level_names, &type.level_names, &type.num_levels);
+    darray_steal(c->entries, &type.entries, &type.num_entries);
+    darray_append(c->types, type);
+    return true;
+}
+
+static bool
+types_body(struct canon *c)
+{
+    struct xkb_keymap *keymap = c->keymap;
+    int token;
+
+    while (!peek_tok(c, '}')) {
+        if (!keyword(c, &token))
+            return false;
+
+        if (token == VIRTUAL_MODS) {
+            if (!vmod_decl(c))
+                return false;
+        }
+        else if (token == TYPE) {
+            if (!type_def(c))
+                return false;
+        }
+        else {
+            return false;
+        }
+    }
+
+    if (darray_empty(c->types)) {
+        struct xkb_key_type type = { 0 };
+
+        type.name = xkb_atom_intern_literal(c->ctx, "default");
+        type.num_levels = 1;
+        darray_append(c->types, type);
+    }
+
+    darray_steal(c->types, &keymap->types, &keymap->num_types);
+    return true;
+}
+
+/***====================================================================***/
+
+/* See SetInterpField() in compat.c. */
+static bool
+interp_field(struct canon *c, struct xkb_sym_interpret *si)
+{
+    struct sval sv;
+    unsigned int val;
+
+    if (!word(c, &sv))
+        return false;
+
+    if (istreq(sv.start, "action")) {
+        if (!tok(c, '=') || !action(c, &si->action))
+            return false;
+    }
+    else if (istreq(sv.start, "virtualmodifier") ||
+             istreq(sv.start, "virtualmod")) {
+        if (!tok(c, '=') || !mod_index(c, MOD_VIRT, &si->virtual_mod))
+            return false;
+    }
+    else if (istreq(sv.start, "repeat")) {
+        if (!tok(c, '=') || !boolean(c, &si->repeat))
+            return false;
+    }
+    else if (istreq(sv.start, "usemodmap") ||
+             istreq(sv.start, "usemodmapmods")) {
+        if (!tok(c, '=') || !enum_value(c, useModMapValueNames, &val))
+            return false;
+        si->level_one_only = val;
+    }
+    else {
+        return false;
+    }
+
+    return tok(c, ';');
+}
+
+static bool
+interp_def(struct canon *c)
+{
+    struct xkb_sym_interpret si = c->default_interp, *iter;
+    struct sval sv;
+    unsigned int pred;
+
+    if (!keysym(c, &si.sym))
+        return false;
+
+    /* See ResolveStateAndPredicate() in compat.c. */
+    if (tok(c, '+')) {
+        if (!name_ident(c, &sv))
+            return false;
+
+        if (tok(c, '(')) {
+            if (!LookupString(symInterpretMatchMaskNames, sv.start, &pred) ||
+                !mod_mask(c, MOD_REAL, &si.mods) || !tok(c, ')'))
+                return false;
+            si.match = pred;
+        }
+        else if (istreq(sv.start, "any")) {
+            si.match = MATCH_ANY;
+            si.mods = MOD_REAL_MASK_ALL;
+        }
+        else {
+            return false;
+        }
+    }
+    else {
+        si.match = MATCH_ANY_OR_NONE;
+        si.mods = MOD_REAL_MASK_ALL;
+    }
+
+    if (!tok(c, '{'))
+        return false;
+
+    do {
+        if (!interp_field(c, &si))
+            return false;
+    } while (!peek_tok(c, '}'));
+
+    if (!tok(c, '}') || !tok(c, ';'))
+        return false;
+
+    darray_foreach(iter, c->interps)
+        if (iter->sym == si.sym && iter->mods == si.mods &&
+            iter->match == si.match)
+            return false;
+
+    darray_append(c->interps, si);
+    return true;
+}
+
+/* See SetLedMapField() in compat.c. */
+static bool
+led_field(struct canon *c, struct xkb_led *led)
+{
+    struct sval sv;
+    bool ok;
+
+    if (!word(c, &sv) || !tok(c, '='))
+        return false;
+
+    if (istreq(sv.start, "modifiers") || istreq(sv.start, "mods"))
+        ok = mod_mask(c, MOD_BOTH, &led->mods.mods);
+    else if (istreq(sv.start, "groups"))
+        ok = mask(c, groupMaskNames, &led->groups);
+    else if (istreq(sv.start, "controls") || istreq(sv.start, "ctrls"))
+        ok = mask(c, ctrlMaskNames, &led->ctrls);
+    else if (istreq(sv.start, "whichmodstate") ||
+             istreq(sv.start, "whichmodifierstate"))
+        ok = mask(c, modComponentMaskNames, &led->which_mods);
+    else if (istreq(sv.start, "whichgroupstate"))
+        ok = mask(c, groupComponentMaskNames, &led->which_groups);
+    else
+        ok = false;
+
+    return ok && tok(c, ';');
+}
+
+static bool
+led_map_def(struct canon *c)
+{
+    struct xkb_led led = { 0 }, *iter;
+
+    if (!string_atom(c, &led.name) || !tok(c, '{'))
+        return false;
+
+    darray_foreach(iter, c->leds)
+        if (iter->name == led.name)
+            return false;
+
+    if (darray_size(c->leds) >= XKB_MAX_LEDS)
+        return false;
+
+    do {
+        if (!led_field(c, &led))
+            return false;
+    } while (!peek_tok(c, '}'));
+
+    if (!tok(c, '}') || !tok(c, ';'))
+        return false;
+
+    darray_append(c->leds, led);
+    return true;
+}
+
+static void
+copy_interps(struct canon *c, bool need_symbol, enum xkb_match_operation pred,
+             struct xkb_sym_interpret **out)
+{
+    struct xkb_sym_interpret *si;
+
+    darray_foreach(si, c->interps)
+        if (si->match == pred &&
+            (si->sym != XKB_KEY_NoSymbol) == need_symbol)
+            *(*out)++ = *si;
+}
+
+/* See CopyCompatToKeymap() and CopyLedMapDefsToKeymap() in compat.c. */
+static bool
+finish_compat(struct canon *c)
+{
+    static const enum xkb_match_operation order[] = {
+        MATCH_EXACTLY, MATCH_ALL, MATCH_NONE, MATCH_ANY, MATCH_ANY_OR_NONE,
+    };
+    struct xkb_keymap *keymap = c->keymap;
+    struct xkb_led *ledi, *led;
+    xkb_led_index_t i;
+
+    if (!darray_empty(c->interps)) {
+        struct xkb_sym_interpret *out;
+
+        keymap->sym_interprets = calloc(darray_size(c->interps),
+                                        sizeof(*keymap->sym_interprets));
+        if (!keymap->sym_interprets)
+            return false;
+
+        out = keymap->sym_interprets;
+        for (unsigned j = 0; j < ARRAY_SIZE(order); j++)
+            copy_interps(c, true, order[j], &out);
+        for (unsigned j = 0; j < ARRAY_SIZE(order); j++)
+            copy_interps(c, false, order[j], &out);
+        keymap->num_sym_interprets = out - keymap->sym_interprets;
+    }
+
+    darray_foreach(ledi, c->leds) {
+        xkb_leds_enumerate(i, led, keymap)
+            if (led->name == ledi->name)
+                break;
+
+        if (i >= keymap->num_leds) {
+            xkb_leds_enumerate(i, led, keymap)
+                if (led->name == XKB_ATOM_NONE)
+                    break;
+
+            if (i >= keymap->num_leds) {
+                if (i >= XKB_MAX_LEDS)
+                    return false;
+                led = &keymap->leds[keymap->num_leds++];
+            }
+        }
+
+        *led = *ledi;
+        if (led->groups != 0 && led->which_groups == 0)
+            led->which_groups = XKB_STATE_LAYOUT_EFFECTIVE;
+        if (led->mods.mods != 0 && led->which_mods == 0)
+            led->which_mods = XKB_STATE_MODS_EFFECTIVE;
+    }
+
+    return true;
+}
+
+static bool
+compat_body(struct canon *c)
+{
+    int token;
+
+    c->default_interp.virtual_mod = XKB_MOD_INVALID;
+
+    while (!peek_tok(c, '}')) {
+        if (!keyword(c, &token))
+            return false;
+
+        if (token == VIRTUAL_MODS) {
+            if (!vmod_decl(c))
+                return false;
+        }
+        else if (token == INTERPRET) {
+            if (tok(c, '.')) {
+                if (!interp_field(c, &c->default_interp))
+                    return false;
+            }
+            else if (!interp_def(c)) {
+                return false;
+            }
+        }
+        else if (token == INDICATOR) {
+            if (!led_map_def(c))
+                return false;
+        }
+        else {
+            return false;
+        }
+    }
+
+    return finish_compat(c);
+}
+
+/***====================================================================***/
+
+/* See GetGroupIndex() in symbols.c. */
+static struct canon_group *
+first_free_group(struct canon *c, bool actions)
+{
+    struct canon_group *g;
+
+    for (xkb_layout_index_t idx = 0; idx < XKB_MAX_GROUPS; idx++) {
+        g = &c->groups[idx];
+        if (!(actions ? g->has_acts : g->has_syms))
+            return g;
+    }
+
+    return NULL;
+}
+
+static struct canon_group *
+group_for(struct canon *c, bool actions)
+{
+    xkb_layout_index_t idx;
+
+    if (!tok(c, '['))
+        return first_free_group(c, actions);
+
+    if (!group_index(c, &idx) || !tok(c, ']'))
+        return NULL;
+
+    return &c->groups[idx - 1];
+}
+
+/* See AddSymbolsToKey() in symbols.c. */
+static bool
+symbols_list(struct canon *c, struct canon_group *g)
+{
+    xkb_level_index_t i = 0;
+    xkb_keysym_t sym;
+
+    if (g->has_syms || !tok(c, '[') || peek_tok(c, ']'))
+        return false;
+
+    do {
+        struct xkb_level *level;
+
+        if (i >= darray_size(g->levels))
+            darray_resize0(g->levels, i + 1);
+        level = &darray_item(g->levels, i++);
+
+        if (tok(c, '{')) {
+            darray_resize(c->syms, 0);
+            do {
+                if (!keysym(c, &sym))
+                    return false;
+                darray_append(c->syms, sym);
+            } while (tok(c, ','));
+
+            if (!tok(c, '}'))
+                return false;
+
+            if (darray_size(c->syms) > 1) {
+                level->u.syms = malloc(darray_size(c->syms) * sizeof(sym));
+                if (!level->u.syms)
+                    return false;
+                memcpy(level->u.syms, c->syms.item,
+                       darray_size(c->syms) * sizeof(sym));
+                level->num_syms = darray_size(c->syms);
+                continue;
+            }
+
+            sym = darray_item(c->syms, 0);
+        }
+        else if (!keysym(c, &sym)) {
+            return false;
+        }
+
+        if (sym != XKB_KEY_NoSymbol) {
+            level->num_syms = 1;
+            level->u.sym = sym;
+        }
+    } while (tok(c, ','));
+
+    g->has_syms = true;
+    return tok(c, ']');
+}
+
+/* See AddActionsToKey() in symbols.c. */
+static bool
+actions_list(struct canon *c, struct canon_group *g)
+{
+    xkb_level_index_t i = 0;
+
+    if (g->has_acts || !tok(c, '[') || peek_tok(c, ']'))
+        return false;
+
+    do {
+        if (i >= darray_size(g->levels))
+            darray_resize0(g->levels, i + 1);
+        if (!action(c, &darray_item(g->levels, i++).action))
+            return false;
+    } while (tok(c, ','));
+
+    g->has_acts = true;
+    return tok(c, ']');
+}
+
+/* See SetSymbolsField() in symbols.c. */
+static bool
+key_field(struct canon *c, struct canon_key *ki)
+{
+    struct canon_group *g;
+    struct sval sv;
+    xkb_layout_index_t idx;
+    bool negated, set = true;
+
+    if (peek_tok(c, '['))
+        return (g = first_free_group(c, false)) && symbols_list(c, g);
+
+    negated = tok(c, '!');
+    if (!word(c, &sv))
+        return false;
+
+    if (negated) {
+        if (istreq(sv.start, "groupswrap") || istreq(sv.start, "wrapgroups"))
+            ki->out_of_range_group_action = RANGE_SATURATE;
+        else if (istreq(sv.start, "groupsclamp") ||
+                 istreq(sv.start, "clampgroups"))
+            ki->out_of_range_group_action = RANGE_WRAP;
+        else
+            return false;
+        return true;
+    }
+
+    if (istreq(sv.start, "type")) {
+        xkb_atom_t *type = &ki->default_type;
+
+        if (tok(c, '[')) {
+            if (!group_index(c, &idx) || !tok(c, ']'))
+                return false;
+            g = &c->groups[idx - 1];
+            g->has_type = true;
+            type = &g->type;
+        }
+        return tok(c, '=') && string_atom(c, type);
+    }
+    else if (istreq(sv.start, "symbols")) {
+        return (g = group_for(c, false)) && tok(c, '=') &&
+               symbols_list(c, g);
+    }
+    else if (istreq(sv.start, "actions")) {
+        return (g = group_for(c, true)) && tok(c, '=') &&
+               actions_list(c, g);
+    }
+    else if (istreq(sv.start, "vmods") ||
+             istreq(sv.start, "virtualmods") ||
+             istreq(sv.start, "virtualmodifiers")) {
+        ki->has_vmodmap = true;
+        return tok(c, '=') && mod_mask(c, MOD_VIRT, &ki->vmodmap);
+    }
+    else if (istreq(sv.start, "repeating") ||
+             istreq(sv.start, "repeats") ||
+             istreq(sv.start, "repeat")) {
+        if (!tok(c, '=') || !ident(c, &sv))
+            return false;
+        if (istreq(sv.start, "default")) {
+            ki->repeat = CANON_REPEAT_UNDEFINED;
+            return true;
+        }
+        if (istreq(sv.start, "true") || istreq(sv.start, "yes") ||
+            istreq(sv.start, "on"))
+            ki->repeat = CANON_REPEAT_YES;
+        else if (istreq(sv.start, "false") || istreq(sv.start, "no") ||
+                 istreq(sv.start, "off"))
+            ki->repeat = CANON_REPEAT_NO;
+        else
+            return false;
+        return true;
+    }
+    else if (istreq(sv.start, "groupswrap") ||
+             istreq(sv.start, "wrapgroups")) {
+        if (tok(c, '=') && !boolean(c, &set))
+            return false;
+        ki->out_of_range_group_action = (set ? RANGE_WRAP : RANGE_SATURATE);
+        return true;
+    }
+    else if (istreq(sv.start, "groupsclamp") ||
+             istreq(sv.start, "clampgroups")) {
+        if (tok(c, '=') && !boolean(c, &set))
+            return false;
+        ki->out_of_range_group_action = (set ? RANGE_SATURATE : RANGE_WRAP);
+        return true;
+    }
+    else if (istreq(sv.start, "groupsredirect") ||
+             istreq(sv.start, "redirectgroups")) {
+        if (!tok(c, '=') || !group_index(c, &idx))
+            return false;
+        ki->out_of_range_group_action = RANGE_REDIRECT;
+        ki->out_of_range_group_number = idx - 1;
+        return true;
+    }
+
+    return false;
+}
+
+static const struct xkb_key_type *
+find_type(struct canon *c, xkb_atom_t name)
+{
+    for (unsigned i = 0; i < c->keymap->num_types; i++)
+        if (c->keymap->types[i].name == name)
+            return &c->keymap->types[i];
+
+    return NULL;
+}
+
+/* See FindTypeForGroup() and CopySymbolsDefToKeymap() in symbols.c. */
+static bool
+finish_key(struct canon *c, struct xkb_key *key, const struct canon_key *ki)
+{
+    const struct xkb_key_type *types[XKB_MAX_GROUPS];
+    bool explicit_types[XKB_MAX_GROUPS];
+    xkb_layout_index_t num_groups = 0, i;
+
+    for (i = 0; i < XKB_MAX_GROUPS; i++) {
+        struct canon_group *g = &c->groups[i];
+        if (g->has_type || g->has_syms || g->has_acts)
+            num_groups = i + 1;
+    }
+
+    if (num_groups == 0)
+        return false;
+
+    for (i = 0; i < num_groups; i++) {
+        struct canon_group *g = &c->groups[i];
+        xkb_level_index_t width = darray_size(g->levels);
+        xkb_atom_t type_name = g->type;
+
+        /* The full compiler fills gaps from the first group. */
+        if (!g->has_type && !g->has_syms && !g->has_acts)
+            return false;
+
+        explicit_types[i] = true;
+        if (type_name == XKB_ATOM_NONE)
+            type_name = ki->default_type;
+
+        if (type_name == XKB_ATOM_NONE) {
+            xkb_keysym_t syms[4];
+
+            for (xkb_level_index_t level = 0; level < 4; level++) {
+                const struct xkb_level *leveli;
+
+                syms[level] = XKB_KEY_NoSymbol;
+                if (level >= width)
+                    continue;
+
+                leveli = &darray_item(g->levels, level);
+                if (leveli->num_syms == 1)
+                    syms[level] = leveli->u.sym;
+                else if (leveli->num_syms > 1)
+                    syms[level] = leveli->u.syms[0];
+            }
+
+            type_name = FindAutomaticType(c->ctx, width, syms);
+            if (type_name == XKB_ATOM_NONE)
+                return false;
+            explicit_types[i] = false;
+        }
+
+        types[i] = find_type(c, type_name);
+        if (!types[i] || types[i]->num_levels < width)
+            return false;
+    }
+
+    key->groups = calloc(num_groups, sizeof(*key->groups));
+    if (!key->groups)
+        return false;
+    key->num_groups = num_groups;
+
+    for (i = 0; i < num_groups; i++) {
+        struct canon_group *g = &c->groups[i];
+
+        key->groups[i].type = types[i];
+        key->groups[i].explicit_type = explicit_types[i];
+
+        if (types[i]->num_levels > 0) {
+            key->groups[i].levels = calloc(types[i]->num_levels,
+                                           sizeof(*key->groups[i].levels));
+            if (!key->groups[i].levels)
+                return false;
+        }
+
+        if (!darray_empty(g->levels))
+            memcpy(key->groups[i].levels, g->levels.item,
+                   darray_size(g->levels) * sizeof(*g->levels.item));
+
+        /* The levels, and any keysym arrays in them, now live in the key. */
+        darray_resize(g->levels, 0);
+    }
+
+    key->out_of_range_group_number = ki->out_of_range_group_number;
+    key->out_of_range_group_action = ki->out_of_range_group_action;
+
+    if (ki->has_vmodmap) {
+        key->vmodmap = ki->vmodmap;
+        key->explicit |= EXPLICIT_VMODMAP;
+    }
+
+    if (ki->repeat != CANON_REPEAT_UNDEFINED) {
+        key->repeats = (ki->repeat == CANON_REPEAT_YES);
+        key->explicit |= EXPLICIT_REPEAT;
+    }
+
+    for (i = 0; i < num_groups; i++) {
+        if (c->groups[i].has_acts) {
+            key->explicit |= EXPLICIT_INTERP;
+            break;
+        }
+    }
+
+    return true;
+}
+
+static bool
+key_def(struct canon *c)
+{
+    struct canon_key ki = {
+        .default_type = XKB_ATOM_NONE,
+        .repeat = CANON_REPEAT_UNDEFINED,
+        .out_of_range_group_action = RANGE_WRAP,
+    };
+    struct xkb_key *key;
+    xkb_atom_t name;
+
+    if (!keyname(c, &name) || !tok(c, '{'))
+        return false;
+
+    key = find_key(c, name, true);
+    if (!key || key->num_groups > 0)
+        return false;
+
+    clear_groups(c);
+
+    if (!peek_tok(c, '}')) {
+        do {
+            if (!key_field(c, &ki))
+                return false;
+        } while (tok(c, ','));
+    }
+
+    if (!tok(c, '}') || !tok(c, ';'))
+        return false;
+
+    return finish_key(c, key, &ki);
+}
+
+/* See HandleModMapDef() and CopyModMapDefToKeymap() in symbols.c. */
+static bool
+modmap_def(struct canon *c)
+{
+    struct xkb_key *key;
+    xkb_mod_index_t ndx;
+    xkb_atom_t name;
+
+    if (!mod_index(c, MOD_REAL, &ndx) || !tok(c, '{'))
+        return false;
+
+    do {
+        /* A key named by an alias or by a keysym is merged differently. */
+        if (!keyname(c, &name) || !(key = find_key(c, name, false)))
+            return false;
+
+        if (key->modmap & ~(1u << ndx))
+            return false;
+
+        key->modmap |= (1u << ndx);
+    } while (tok(c, ','));
+
+    return tok(c, '}') && tok(c, ';');
+}
+
+static bool
+group_name_def(struct canon *c)
+{
+    xkb_layout_index_t idx;
+    xkb_atom_t name;
+
+    if (!tok(c, '[') || !group_index(c, &idx) || !tok(c, ']') ||
+        !tok(c, '=') || !string_atom(c, &name) || !tok(c, ';'))
+        return false;
+
+    if (idx > darray_size(c->group_names))
+        darray_resize0(c->group_names, idx);
+    darray_item(c->group_names, idx - 1) = name;
+    return true;
+}
+
+static bool
+symbols_body(struct canon *c)
+{
+    struct xkb_keymap *keymap = c->keymap;
+    struct sval sv;
+    int token;
+
+    while (!peek_tok(c, '}')) {
+        if (!word(c, &sv))
+            return false;
+
+        token = keyword_to_token(sv.start, sv.len);
+        if (token == KEY) {
+            if (!key_def(c))
+                return false;
+        }
+        else if (token == MODIFIER_MAP) {
+            if (!modmap_def(c))
+                return false;
+        }
+        else if (token == -1 && (istreq(sv.start, "name") ||
+                                 istreq(sv.start, "groupname"))) {
+            if (!group_name_def(c))
+                return false;
+        }
+        else {
+            return false;
+        }
+    }
+
+    darray_steal(c->group_names,
+                 &keymap->group_names, &keymap->num_group_names);
+    return true;
+}
+
+/***====================================================================***/
+
+static bool
+section(struct canon *c, int section_token, char **name,
+        bool (*body)(struct canon *c))
+{
+    int token;
+
+    return keyword(c, &token) && token == section_token &&
+           section_name(c, name) && tok(c, '{') &&
+           body(c) && tok(c, '}') && tok(c, ';');
+}
+
+static bool
+keymap_file(struct canon *c)
+{
+    struct xkb_keymap *keymap = c->keymap;
+    struct sval sv;
+    int token;
+
+    if (!keyword(c, &token) || token != XKB_KEYMAP)
+        return false;
+
+    if (peek_tok(c, '\"') && !string(c, &sv))
+        return false;
+
+    if (!tok(c, '{') ||
+        !section(c, XKB_KEYCODES, &keymap->keycodes_section_name,
+                 keycodes_body) ||
+        !section(c, XKB_TYPES, &keymap->types_section_name, types_body) ||
+        !section(c, XKB_COMPATMAP, &keymap->compat_section_name,
+                 compat_body) ||
+        !section(c, XKB_SYMBOLS, &keymap->symbols_section_name,
+                 symbols_body) ||
+        !tok(c, '}') || !tok(c, ';'))
+        return false;
+
+    skip_space(c);
+    return eof(&c->s);
+}
+
+/*
+ * Try to compile the string with the fast path.  On success the keymap
+ * is filled in; otherwise it is left untouched and false is returned, so
+ * that the caller can use the full compiler instead.
+ */
+bool
+CompileCanonicalKeymap(struct xkb_keymap *keymap, const char *string,
+                       size_t len)
+{
+    struct canon c;
+    struct xkb_keymap *scratch, tmp;
+    uint64_t start;
+    bool ok;
+
+    scratch = xkb_keymap_new(keymap->ctx, keymap->format, keymap->flags);
+    if (!scratch)
+        return false;
+
+    memset(&c, 0, sizeof(c));
+    c.ctx = keymap->ctx;
+    c.keymap = scratch;
+    c.actions = NewActionsInfo();
+    scanner_init(&c.s, c.ctx, string, len, "(input string)");
+
+    /* Recognizing the sections counts as parsing. */
+    start = stats_start(c.ctx);
+    ok = c.actions && keymap_file(&c);
+    stats_time(c.ctx, parse_time, start);
+
+    if (ok) {
+        start = stats_start(c.ctx);
+        ok = UpdateDerivedKeymapFields(scratch);
+        stats_time(c.ctx, derive_time, start);
+    }
+
+    if (!ok)
+        log_dbg(c.ctx,
+                "Keymap string is not in canonical form (line %u); "
+                "Using the full compiler\n", c.s.line);
+
+    clear_canon(&c);
+
+    if (ok) {
+        tmp = *keymap;
+        *keymap = *scratch;
+        *scratch = tmp;
+    }
+
+    xkb_keymap_unref(scratch);
+    return ok;
+}
@@ -91,8 +91,10 @@ typedef struct {
     unsigned int num_leds;
     ActionsInfo *actions;
     struct xkb_mod_set mods;
+    unsigned int include_depth;
 
     struct xkb_context *ctx;
+    struct include_state *include_state;
 } CompatInfo;
 
 static const char *
@@ -144,10 +146,12 @@ ReportLedNotArray(CompatInfo *info, LedInfo *ledi, const char *field)
 
 static void
 InitCompatInfo(CompatInfo *info, struct xkb_context *ctx,
+               struct include_state *include_state,
                ActionsInfo *actions, const struct xkb_mod_set *mods)
 {
     memset(info, 0, sizeof(*info));
     info->ctx = ctx;
+    info->include_state = include_state;
     info->actions = actions;
     info->mods = *mods;
     info->default_interp.merge = MERGE_OVERRIDE;
@@ -426,22 +430,26 @@ HandleIncludeCompatMap(CompatInfo *info, IncludeStmt *include)
 {
     CompatInfo included;
 
-    InitCompatInfo(&included, info->ctx, info->actions, &info->mods);
-    included.name = include->stmt;
-    include->stmt = NULL;
+    InitCompatInfo(&included, info->ctx, info->include_state, info->actions,
+                   &info->mods);
+    included.name = strdup_safe(include->stmt);
 
     for (IncludeStmt *stmt = include; stmt; stmt = stmt->next_incl) {
         CompatInfo next_incl;
         XkbFile *file;
 
-        file = ProcessIncludeFile(info->ctx, stmt, FILE_TYPE_COMPAT);
+        file = ProcessIncludeFile(info->ctx, info->include_state, stmt,
+                                  FILE_TYPE_COMPAT);
         if (!file) {
             info->errorCount += 10;
             ClearCompatInfo(&included);
             return false;
         }
 
-        InitCompatInfo(&next_incl, info->ctx, info->actions, &included.mods);
+        InitCompatInfo(&next_incl, info->ctx, info->include_state,
+                       info->actions, &included.mods);
+        next_incl.include_depth = info->include_depth + 1;
+        stats_include_depth(info->ctx, next_incl.include_depth);
         next_incl.default_interp = info->default_interp;
         next_incl.default_interp.merge = stmt->merge;
         next_incl.default_led = info->default_led;
@@ -901,7 +909,7 @@ CopyCompatToKeymap(struct xkb_keymap *keymap, CompatInfo *info)
 
 bool
 CompileCompatMap(XkbFile *file, struct xkb_keymap *keymap,
-                 enum merge_mode merge)
+                 enum merge_mode merge, struct include_state *state)
 {
     CompatInfo info;
     ActionsInfo *actions;
@@ -910,7 +918,7 @@ CompileCompatMap(XkbFile *file, struct xkb_keymap *keymap,
     if (!actions)
         return false;
 
-    InitCompatInfo(&info, keymap->ctx, actions, &keymap->mods);
+    InitCompatInfo(&info, keymap->ctx, state, actions, &keymap->mods);
     info.default_interp.merge = merge;
     info.default_led.merge = merge;
 
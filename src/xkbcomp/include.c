@@ -47,12 +47,39 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
 #include <errno.h>
 #include <limits.h>
 #include <stdio.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 #include "xkbcomp-priv.h"
 #include "include.h"
+#include "keymap-cache.h"
+#include "arena.h"
+
+#ifdef HAVE_PTHREAD
+#define load_acquire(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define compare_exchange(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), false, \
+                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define mutex_init(m) pthread_mutex_init((m), NULL)
+#define mutex_destroy(m) pthread_mutex_destroy(m)
+#define mutex_lock(m) pthread_mutex_lock(m)
+#define mutex_unlock(m) pthread_mutex_unlock(m)
+#else
+#define load_acquire(ptr) (*(ptr))
+#define compare_exchange(ptr, expected, desired) \
+    (*(ptr) == *(expected) ? (*(ptr) = (desired), true) : false)
+#define mutex_init(m) do { } while (0)
+#define mutex_destroy(m) do { } while (0)
+#define mutex_lock(m) do { } while (0)
+#define mutex_unlock(m) do { } while (0)
+#endif
 
 /**
  * Parse an include statement. Each call returns a file name, along with
@@ -60,7 +87,8 @@
  * the separator from the next file, used to determine the merge mode.
  *
  * @param str_inout Input statement, modified in-place. Should be passed in
- * repeatedly. If str_inout is NULL, the parsing has completed.
+ * repeatedly. If str_inout is NULL, the parsing has completed. The returned
+ * strings point into the statement, so it must outlive them.
  *
  * @param file_rtrn Set to the name of the include file to be used. Combined
  * with an enum xkb_file_type, this determines which file to look for in the
@@ -128,7 +156,7 @@ ParseIncludeMap(char **str_inout, char **file_rtrn, char **map_rtrn,
     tmp = strchr(str, ':');
     if (tmp != NULL) {
         *tmp++ = '\0';
-        *extra_data = strdup(tmp);
+        *extra_data = tmp;
     }
     else {
         *extra_data = NULL;
@@ -138,27 +166,23 @@ ParseIncludeMap(char **str_inout, char **file_rtrn, char **map_rtrn,
     tmp = strchr(str, '(');
     if (tmp == NULL) {
         /* No map. */
-        *file_rtrn = strdup(str);
+        *file_rtrn = str;
         *map_rtrn = NULL;
     }
     else if (str[0] == '(') {
         /* Map without file - invalid. */
-        free(*extra_data);
         return false;
     }
     else {
-        /* Got a map; separate the file and the map for the strdup's. */
+        /* Got a map; separate the file and the map. */
         *tmp++ = '\0';
-        *file_rtrn = strdup(str);
+        *file_rtrn = str;
         str = tmp;
         tmp = strchr(str, ')');
-        if (tmp == NULL || tmp[1] != '\0') {
-            free(*file_rtrn);
-            free(*extra_data);
+        if (tmp == NULL || tmp[1] != '\0')
             return false;
-        }
         *tmp++ = '\0';
-        *map_rtrn = strdup(str);
+        *map_rtrn = str;
     }
 
     /* Set up the next file for the next call, if any. */
@@ -193,24 +217,388 @@ DirectoryForInclude(enum xkb_file_type type)
     return xkb_file_type_include_dirs[type];
 }
 
+/***====================================================================***/
+
+/*
+ * An index of the files under each "<include path>/<type dir>" directory,
+ * by their full names relative to it (e.g. "pc" or "sun_vndr/us"), so
+ * that FindFileInXkbPath() doesn't try to open files which aren't there.
+ *
+ * A directory is read once, when it is first looked in, and again only
+ * after the index is invalidated: when the include path changes, when a
+ * file can't be found at all, or when the keymap cache sees that the
+ * directories changed.  So compilations make no stat() calls for it.
+ */
+
+/* Deeper subdirectories, e.g. symlink loops, are not indexed. */
+#define INCLUDE_DIR_MAX_DEPTH 4
+
+typedef darray(char *) darray_include_name;
+
+struct include_dir {
+    /* The index serial when the directory was read. */
+    unsigned int serial;
+    bool exists;
+    /*
+     * An open-addressing hash table of the file names, probed linearly.
+     * A name ending with '/' is a subdirectory which couldn't be read,
+     * where every name is tried.  NULL if the directory itself couldn't
+     * be read, in which case every name is tried.
+     */
+    const char **slots;
+    unsigned int size;
+    struct arena *names;
+};
+
+struct include_index {
+#ifdef HAVE_PTHREAD
+    /* Taken by lookups, which may come from the prefetch threads. */
+    pthread_mutex_t mutex;
+#endif
+    /* Incremented to invalidate all directories; starts at 1. */
+    unsigned int serial;
+    /* Indexed by include path, then by file type. */
+    darray(struct include_dir) dirs;
+};
+
+/* FNV-1a. */
+static uint32_t
+include_name_hash(const char *name, size_t len)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char) name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static void
+include_dir_clear(struct include_dir *dir)
+{
+    free(dir->slots);
+    arena_free(dir->names);
+    dir->slots = NULL;
+    dir->size = 0;
+    dir->names = NULL;
+}
+
+/* Returns @prefix@name@suffix, allocated in @arena. */
+static char *
+join_name(struct arena *arena, const char *prefix, const char *name,
+          const char *suffix)
+{
+    size_t prefix_len = strlen(prefix), name_len = strlen(name);
+    size_t suffix_len = strlen(suffix);
+    char *ret;
+
+    ret = arena_alloc(arena, prefix_len + name_len + suffix_len + 1);
+    if (!ret)
+        return NULL;
+
+    memcpy(ret, prefix, prefix_len);
+    memcpy(ret + prefix_len, name, name_len);
+    memcpy(ret + prefix_len + name_len, suffix, suffix_len + 1);
+    return ret;
+}
+
+static bool
+is_directory(const char *dir_path, const struct dirent *ent)
+{
+    struct stat stat_buf;
+    char *path;
+    bool ret;
+
+#ifdef _DIRENT_HAVE_D_TYPE
+    if (ent->d_type == DT_DIR)
+        return true;
+    if (ent->d_type != DT_UNKNOWN && ent->d_type != DT_LNK)
+        return false;
+#endif
+
+    if (asprintf(&path, "%s/%s", dir_path, ent->d_name) < 0)
+        return false;
+    ret = (stat(path, &stat_buf) == 0 && S_ISDIR(stat_buf.st_mode));
+    free(path);
+    return ret;
+}
+
+/*
+ * Adds the files under @path to @names, prefixed with @prefix.  Returns
+ * false on allocation failure.
+ */
+static bool
+include_dir_read_names(struct include_dir *dir, darray_include_name *names,
+                       const char *path, const char *prefix, int depth)
+{
+    DIR *d;
+    struct dirent *ent;
+    bool ret = true;
+
+    d = opendir(path);
+    if (!d) {
+        char *copy;
+
+        /* Mark it as unread; the top directory is handled by the caller. */
+        if (depth == 0)
+            return false;
+        copy = arena_strdup(dir->names, prefix);
+        if (!copy)
+            return false;
+        darray_append(*names, copy);
+        return true;
+    }
+
+    while (ret && (ent = readdir(d))) {
+        char *name, *sub_path;
+
+        if (streq(ent->d_name, ".") || streq(ent->d_name, ".."))
+            continue;
+
+        if (!is_directory(path, ent)) {
+            name = join_name(dir->names, prefix, ent->d_name, "");
+            if (!name) {
+                ret = false;
+                break;
+            }
+            darray_append(*names, name);
+            continue;
+        }
+
+        name = join_name(dir->names, prefix, ent->d_name, "/");
+        if (!name) {
+            ret = false;
+            break;
+        }
+        if (depth + 1 >= INCLUDE_DIR_MAX_DEPTH) {
+            darray_append(*names, name);
+            continue;
+        }
+        if (asprintf(&sub_path, "%s/%s", path, ent->d_name) < 0) {
+            ret = false;
+            break;
+        }
+        ret = include_dir_read_names(dir, names, sub_path, name, depth + 1);
+        free(sub_path);
+    }
+
+    closedir(d);
+    return ret;
+}
+
+static bool
+include_dir_read(struct include_dir *dir, const char *path)
+{
+    darray_include_name names = darray_new();
+    char **name;
+
+    dir->names = arena_new();
+    if (!dir->names)
+        goto err;
+
+    if (!include_dir_read_names(dir, &names, path, "", 0))
+        goto err;
+
+    dir->size = 16;
+    while (dir->size < 2 * darray_size(names))
+        dir->size *= 2;
+    dir->slots = calloc(dir->size, sizeof(*dir->slots));
+    if (!dir->slots)
+        goto err;
+
+    darray_foreach(name, names) {
+        uint32_t i = include_name_hash(*name, strlen(*name));
+
+        for (i &= dir->size - 1; dir->slots[i]; i = (i + 1) & (dir->size - 1));
+        dir->slots[i] = *name;
+    }
+
+    darray_free(names);
+    return true;
+
+err:
+    darray_free(names);
+    include_dir_clear(dir);
+    return false;
+}
+
+static void
+include_dir_load(struct include_dir *dir, const char *path)
+{
+    struct stat stat_buf;
+
+    include_dir_clear(dir);
+    dir->exists = (stat(path, &stat_buf) == 0 && S_ISDIR(stat_buf.st_mode));
+    if (dir->exists)
+        include_dir_read(dir, path);
+}
+
+static bool
+include_dir_has(const struct include_dir *dir, const char *name, size_t len)
+{
+    uint32_t i = include_name_hash(name, len) & (dir->size - 1);
+
+    for (; dir->slots[i]; i = (i + 1) & (dir->size - 1))
+        if (strncmp(dir->slots[i], name, len) == 0 &&
+            dir->slots[i][len] == '\0')
+            return true;
+
+    return false;
+}
+
+static bool
+include_dir_may_contain(const struct include_dir *dir, const char *name)
+{
+    const char *sep;
+
+    if (!dir->exists)
+        return false;
+    if (!dir->slots)
+        return true;
+
+    /* Names which don't map to a single file under the directory. */
+    if (name[0] == '\0' || name[0] == '/' || strstr(name, "//") ||
+        strstr(name, "./"))
+        return true;
+
+    if (include_dir_has(dir, name, strlen(name)))
+        return true;
+
+    /* It may be in a subdirectory which wasn't read. */
+    for (sep = strchr(name, '/'); sep; sep = strchr(sep + 1, '/'))
+        if (include_dir_has(dir, name, sep - name + 1))
+            return true;
+
+    return false;
+}
+
+static struct include_index *
+get_include_index(struct xkb_context *ctx)
+{
+    struct include_index *index = load_acquire(&ctx->include_index);
+    struct include_index *expected = NULL;
+
+    if (index)
+        return index;
+
+    index = calloc(1, sizeof(*index));
+    if (!index)
+        return NULL;
+    mutex_init(&index->mutex);
+    index->serial = 1;
+
+    /* Compilations in several threads may race us to add it. */
+    if (!compare_exchange(&ctx->include_index, &expected, index)) {
+        mutex_destroy(&index->mutex);
+        free(index);
+        index = expected;
+    }
+
+    return index;
+}
+
+/*
+ * Returns false if @name is known not to be in the @type directory of
+ * the include path at @idx.
+ */
+static bool
+IncludeIndexMayContain(struct xkb_context *ctx, unsigned int idx,
+                       enum xkb_file_type type, const char *name)
+{
+    struct include_index *index = get_include_index(ctx);
+    struct include_dir *dir;
+    char *path;
+    bool ret;
+
+    if (!index || type >= _FILE_TYPE_NUM_ENTRIES)
+        return true;
+
+    mutex_lock(&index->mutex);
+
+    if (darray_size(index->dirs) < (idx + 1) * _FILE_TYPE_NUM_ENTRIES)
+        darray_resize0(index->dirs, (idx + 1) * _FILE_TYPE_NUM_ENTRIES);
+    dir = &darray_item(index->dirs, idx * _FILE_TYPE_NUM_ENTRIES + type);
+
+    if (dir->serial != index->serial) {
+        if (asprintf(&path, "%s/%s", xkb_context_include_path_get(ctx, idx),
+                     DirectoryForInclude(type)) < 0) {
+            mutex_unlock(&index->mutex);
+            return true;
+        }
+        include_dir_load(dir, path);
+        dir->serial = index->serial;
+        free(path);
+    }
+
+    ret = include_dir_may_contain(dir, name);
+
+    mutex_unlock(&index->mutex);
+    return ret;
+}
+
+void
+xkb_context_include_index_invalidate(struct xkb_context *ctx)
+{
+    struct include_index *index = load_acquire(&ctx->include_index);
+
+    if (!index)
+        return;
+
+    mutex_lock(&index->mutex);
+    index->serial++;
+    mutex_unlock(&index->mutex);
+}
+
+void
+xkb_context_include_index_clear(struct xkb_context *ctx)
+{
+    struct include_index *index = ctx->include_index;
+    struct include_dir *dir;
+
+    if (!index)
+        return;
+
+    darray_foreach(dir, index->dirs)
+        include_dir_clear(dir);
+    darray_free(index->dirs);
+    mutex_destroy(&index->mutex);
+    free(index);
+    ctx->include_index = NULL;
+}
+
+/***====================================================================***/
+
 FILE *
 FindFileInXkbPath(struct xkb_context *ctx, const char *name,
-                  enum xkb_file_type type, char **pathRtrn)
+                  enum xkb_file_type type, char **pathRtrn,
+                  struct cache_deps *deps)
 {
     unsigned int i;
     FILE *file = NULL;
     char *buf = NULL;
     const char *typeDir;
     size_t buf_size = 0, typeDirLen, name_len;
+    bool skipped = false, retried = false;
+    uint64_t start = stats_start(ctx);
 
     typeDir = DirectoryForInclude(type);
     typeDirLen = strlen(typeDir);
     name_len = strlen(name);
 
+retry:
     for (i = 0; i < xkb_context_num_include_paths(ctx); i++) {
-        size_t new_buf_size = strlen(xkb_context_include_path_get(ctx, i)) +
-                              typeDirLen + name_len + 3;
+        size_t new_buf_size;
         int ret;
+
+        if (!IncludeIndexMayContain(ctx, i, type, name)) {
+            skipped = true;
+            continue;
+        }
+
+        new_buf_size = strlen(xkb_context_include_path_get(ctx, i)) +
+                       typeDirLen + name_len + 3;
         if (new_buf_size > buf_size) {
             void *buf_new = realloc(buf, new_buf_size);
             if (buf_new) {
@@ -236,6 +624,13 @@ FindFileInXkbPath(struct xkb_context *ctx, const char *name,
             break;
     }
 
+    /* The file may have been added since the directories were read. */
+    if (!file && skipped && !retried) {
+        xkb_context_include_index_invalidate(ctx);
+        retried = true;
+        goto retry;
+    }
+
     if (!file) {
         log_err(ctx, "Couldn't find file \"%s/%s\" in include paths\n",
                 typeDir, name);
@@ -260,9 +655,16 @@ FindFileInXkbPath(struct xkb_context *ctx, const char *name,
         }
 
         free(buf);
+        stats_time(ctx, file_lookup_time, start);
         return NULL;
     }
 
+    stats_time(ctx, file_lookup_time, start);
+    stats_count(ctx, files_opened, 1);
+
+    if (deps)
+        cache_deps_add_file(deps, buf, file);
+
     if (pathRtrn)
         *pathRtrn = buf;
     else
@@ -270,14 +672,15 @@ FindFileInXkbPath(struct xkb_context *ctx, const char *name,
     return file;
 }
 
-XkbFile *
-ProcessIncludeFile(struct xkb_context *ctx, IncludeStmt *stmt,
-                   enum xkb_file_type file_type)
+static XkbFile *
+LoadIncludeFile(struct xkb_context *ctx, struct include_state *state,
+                IncludeStmt *stmt, enum xkb_file_type file_type)
 {
     FILE *file;
     XkbFile *xkb_file;
 
-    file = FindFileInXkbPath(ctx, stmt->file, file_type, NULL);
+    file = FindFileInXkbPath(ctx, stmt->file, file_type, NULL,
+                             state ? state->deps : NULL);
     if (!file)
         return false;
 
@@ -307,3 +710,171 @@ ProcessIncludeFile(struct xkb_context *ctx, IncludeStmt *stmt,
 
     return xkb_file;
 }
+
+/***====================================================================***/
+
+struct prefetched_file {
+    char *file;
+    char *map;
+    /* NULL if loading failed; the errors have already been logged. */
+    XkbFile *xkb_file;
+    bool taken;
+};
+
+typedef darray(struct prefetched_file) darray_prefetched_file;
+
+struct include_prefetch {
+    darray_prefetched_file files[LAST_KEYMAP_FILE_TYPE + 1];
+};
+
+XkbFile *
+ProcessIncludeFile(struct xkb_context *ctx, struct include_state *state,
+                   IncludeStmt *stmt, enum xkb_file_type file_type)
+{
+    struct prefetched_file *pf;
+
+    if (state && state->prefetch) {
+        darray_foreach(pf, state->prefetch->files[file_type]) {
+            if (!pf->taken && streq(pf->file, stmt->file) &&
+                (pf->map == stmt->map ||
+                 streq_not_null(pf->map, stmt->map))) {
+                pf->taken = true;
+                return pf->xkb_file;
+            }
+        }
+    }
+
+    return LoadIncludeFile(ctx, state, stmt, file_type);
+}
+
+#ifdef HAVE_PTHREAD
+/*
+ * Load everything @file includes, recursively, in the same order the
+ * section compilers will ask for it.
+ */
+static void
+PrefetchIncludes(struct xkb_context *ctx, struct include_state *state,
+                 darray_prefetched_file *files, XkbFile *file,
+                 enum xkb_file_type file_type)
+{
+    for (ParseCommon *stmt = file->defs; stmt; stmt = stmt->next) {
+        if (stmt->type != STMT_INCLUDE)
+            continue;
+
+        for (IncludeStmt *incl = (IncludeStmt *) stmt; incl;
+             incl = incl->next_incl) {
+            struct prefetched_file pf;
+
+            pf.file = strdup(incl->file);
+            pf.map = strdup_safe(incl->map);
+            if (!pf.file || (incl->map && !pf.map)) {
+                /* Leave it to ProcessIncludeFile(). */
+                free(pf.file);
+                free(pf.map);
+                continue;
+            }
+
+            pf.xkb_file = LoadIncludeFile(ctx, state, incl, file_type);
+            pf.taken = false;
+            darray_append(*files, pf);
+
+            if (pf.xkb_file)
+                PrefetchIncludes(ctx, state, files, pf.xkb_file,
+                                 file_type);
+        }
+    }
+}
+
+struct prefetch_job {
+    struct xkb_context *ctx;
+    struct include_state *state;
+    darray_prefetched_file *files;
+    XkbFile *file;
+    enum xkb_file_type file_type;
+    /* What the job logged, for the calling thread to pass on. */
+    darray_log_message log;
+};
+
+static void *
+PrefetchThread(void *data)
+{
+    struct prefetch_job *job = data;
+
+    xkb_log_set_queue(&job->log);
+    PrefetchIncludes(job->ctx, job->state, job->files, job->file,
+                     job->file_type);
+    xkb_log_set_queue(NULL);
+    return NULL;
+}
+#endif
+
+struct include_prefetch *
+PrefetchIncludeFiles(struct xkb_context *ctx, struct include_state *state,
+                     XkbFile **files)
+{
+#ifdef HAVE_PTHREAD
+    struct include_prefetch *prefetch;
+    struct prefetch_job jobs[LAST_KEYMAP_FILE_TYPE + 1];
+    pthread_t threads[LAST_KEYMAP_FILE_TYPE + 1];
+    bool started[LAST_KEYMAP_FILE_TYPE + 1] = { false };
+    enum xkb_file_type type;
+
+    prefetch = calloc(1, sizeof(*prefetch));
+    if (!prefetch)
+        return NULL;
+
+    for (type = FIRST_KEYMAP_FILE_TYPE; type <= LAST_KEYMAP_FILE_TYPE; type++) {
+        jobs[type].ctx = ctx;
+        jobs[type].state = state;
+        jobs[type].files = &prefetch->files[type];
+        jobs[type].file = files[type];
+        jobs[type].file_type = type;
+        darray_init(jobs[type].log);
+    }
+
+    /*
+     * The symbols are usually the most work, so they're loaded on this
+     * thread while the other sections run on their own.  If a thread
+     * can't be started, its section is simply not prefetched.
+     */
+    for (type = FIRST_KEYMAP_FILE_TYPE; type < LAST_KEYMAP_FILE_TYPE; type++)
+        started[type] = (pthread_create(&threads[type], NULL,
+                                        PrefetchThread, &jobs[type]) == 0);
+
+    PrefetchThread(&jobs[LAST_KEYMAP_FILE_TYPE]);
+
+    for (type = FIRST_KEYMAP_FILE_TYPE; type < LAST_KEYMAP_FILE_TYPE; type++)
+        if (started[type])
+            pthread_join(threads[type], NULL);
+
+    /* In the order a sequential compilation would have logged them. */
+    for (type = FIRST_KEYMAP_FILE_TYPE; type <= LAST_KEYMAP_FILE_TYPE; type++)
+        xkb_log_flush_queue(ctx, &jobs[type].log);
+
+    return prefetch;
+#else
+    return NULL;
+#endif
+}
+
+void
+FreeIncludePrefetch(struct include_prefetch *prefetch)
+{
+    struct prefetched_file *pf;
+    enum xkb_file_type type;
+
+    if (!prefetch)
+        return;
+
+    for (type = FIRST_KEYMAP_FILE_TYPE; type <= LAST_KEYMAP_FILE_TYPE; type++) {
+        darray_foreach(pf, prefetch->files[type]) {
+            if (!pf->taken)
+                FreeXkbFile(pf->xkb_file);
+            free(pf->file);
+            free(pf->map);
+        }
+        darray_free(prefetch->files[type]);
+    }
+
+    free(prefetch);
+}
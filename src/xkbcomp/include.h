@@ -31,12 +31,43 @@ bool
 ParseIncludeMap(char **str_inout, char **file_rtrn, char **map_rtrn,
                 char *nextop_rtrn, char **extra_data);
 
+struct cache_deps;
+
+/* @deps, if not NULL, records the file which is found. */
 FILE *
 FindFileInXkbPath(struct xkb_context *ctx, const char *name,
-                  enum xkb_file_type type, char **pathRtrn);
+                  enum xkb_file_type type, char **pathRtrn,
+                  struct cache_deps *deps);
+
+struct include_prefetch;
+
+/*
+ * The state of a single compilation which is used for finding and loading
+ * files.  It is kept off the context, which may be shared by compilations
+ * on several threads.
+ */
+struct include_state {
+    /* Records the files which are read, to validate a cache entry. */
+    struct cache_deps *deps;
+    /* Files parsed ahead by a parallel compilation. */
+    struct include_prefetch *prefetch;
+};
 
 XkbFile *
-ProcessIncludeFile(struct xkb_context *ctx, IncludeStmt *stmt,
-                   enum xkb_file_type file_type);
+ProcessIncludeFile(struct xkb_context *ctx, struct include_state *state,
+                   IncludeStmt *stmt, enum xkb_file_type file_type);
+
+/*
+ * Load all the files included by the keymap sections in @files, a thread
+ * per section.  While the returned prefetch is set in the include_state,
+ * ProcessIncludeFile() hands these out instead of reading the files.
+ * Returns NULL if threads are not available.
+ */
+struct include_prefetch *
+PrefetchIncludeFiles(struct xkb_context *ctx, struct include_state *state,
+                     XkbFile **files);
+
+void
+FreeIncludePrefetch(struct include_prefetch *prefetch);
 
 #endif
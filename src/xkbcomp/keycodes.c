@@ -52,8 +52,10 @@ typedef struct {
     LedNameInfo led_names[XKB_MAX_LEDS];
     unsigned int num_led_names;
     darray(AliasInfo) aliases;
+    unsigned int include_depth;
 
     struct xkb_context *ctx;
+    struct include_state *include_state;
 } KeyNamesInfo;
 
 /***====================================================================***/
@@ -152,10 +154,12 @@ ClearKeyNamesInfo(KeyNamesInfo *info)
 }
 
 static void
-InitKeyNamesInfo(KeyNamesInfo *info, struct xkb_context *ctx)
+InitKeyNamesInfo(KeyNamesInfo *info, struct xkb_context *ctx,
+                 struct include_state *include_state)
 {
     memset(info, 0, sizeof(*info));
     info->ctx = ctx;
+    info->include_state = include_state;
     info->min_key_code = XKB_KEYCODE_INVALID;
 #if XKB_KEYCODE_INVALID < XKB_KEYCODE_MAX
 #error "Hey, you can't be changing stuff like that."
@@ -334,22 +338,24 @@ HandleIncludeKeycodes(KeyNamesInfo *info, IncludeStmt *include)
 {
     KeyNamesInfo included;
 
-    InitKeyNamesInfo(&included, info->ctx);
-    included.name = include->stmt;
-    include->stmt = NULL;
+    InitKeyNamesInfo(&included, info->ctx, info->include_state);
+    included.name = strdup_safe(include->stmt);
 
     for (IncludeStmt *stmt = include; stmt; stmt = stmt->next_incl) {
         KeyNamesInfo next_incl;
         XkbFile *file;
 
-        file = ProcessIncludeFile(info->ctx, stmt, FILE_TYPE_KEYCODES);
+        file = ProcessIncludeFile(info->ctx, info->include_state, stmt,
+                                  FILE_TYPE_KEYCODES);
         if (!file) {
             info->errorCount += 10;
             ClearKeyNamesInfo(&included);
             return false;
         }
 
-        InitKeyNamesInfo(&next_incl, info->ctx);
+        InitKeyNamesInfo(&next_incl, info->ctx, info->include_state);
+        next_incl.include_depth = info->include_depth + 1;
+        stats_include_depth(info->ctx, next_incl.include_depth);
 
         HandleKeycodesFile(&next_incl, file, MERGE_OVERRIDE);
 
@@ -646,11 +652,11 @@ CopyKeyNamesInfoToKeymap(struct xkb_keymap *keymap, KeyNamesInfo *info)
 
 bool
 CompileKeycodes(XkbFile *file, struct xkb_keymap *keymap,
-                enum merge_mode merge)
+                enum merge_mode merge, struct include_state *state)
 {
     KeyNamesInfo info;
 
-    InitKeyNamesInfo(&info, keymap->ctx);
+    InitKeyNamesInfo(&info, keymap->ctx, state);
 
     HandleKeycodesFile(&info, file, merge);
     if (info.errorCount != 0)
@@ -53,27 +53,114 @@
 #include "text.h"
 
 #define BUF_CHUNK_SIZE 4096
+/*
+ * The chunk is flushed before a write if less than this is left, so that
+ * almost every write can be formatted in place, in one go.
+ */
+#define BUF_MIN_AVAILABLE 1024
 
 struct buf {
-    char *buf;
+    xkb_keymap_write_fn write_fn;
+    void *data;
     size_t size;
-    size_t alloc;
+    char chunk[BUF_CHUNK_SIZE];
+
+    /* XKB_KEYMAP_SERIALIZE_COMPACT; see squeeze_whitespace(). */
+    bool compact;
+    bool in_string;
+    bool escaped;
+    char last;
+    char pending;
+    char squeezed[BUF_CHUNK_SIZE + 1];
 };
 
 static bool
-do_realloc(struct buf *buf, size_t at_least)
+is_ident_char(char ch)
+{
+    return is_alnum(ch) || ch == '_';
+}
+
+/*
+ * Copy @len bytes of text to @out without the whitespace which isn't
+ * needed, and return the new length, which is at most @len + 1.  Runs of
+ * whitespace become a newline if they contain one, a space if they
+ * separate two identifiers, and nothing otherwise.  Strings are copied
+ * as they are.
+ */
+static size_t
+squeeze_whitespace(struct buf *buf, const char *text, size_t len, char *out)
+{
+    size_t n = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        char ch = text[i];
+
+        if (buf->in_string) {
+            if (buf->escaped)
+                buf->escaped = false;
+            else if (ch == '\\')
+                buf->escaped = true;
+            else if (ch == '"')
+                buf->in_string = false;
+            out[n++] = buf->last = ch;
+            continue;
+        }
+
+        if (ch == '\n') {
+            buf->pending = '\n';
+            continue;
+        }
+        if (is_space(ch)) {
+            if (!buf->pending)
+                buf->pending = ' ';
+            continue;
+        }
+
+        if (buf->pending == '\n' && buf->last)
+            out[n++] = '\n';
+        else if (buf->pending == ' ' &&
+                 is_ident_char(buf->last) && is_ident_char(ch))
+            out[n++] = ' ';
+        buf->pending = '\0';
+
+        if (ch == '"')
+            buf->in_string = true;
+        out[n++] = buf->last = ch;
+    }
+
+    return n;
+}
+
+static bool
+write_out(struct buf *buf, const char *text, size_t len)
 {
-    char *new;
+    char *squeezed;
+    bool ok;
+
+    if (!buf->compact)
+        return buf->write_fn(buf->data, text, len);
+
+    if (len < sizeof(buf->squeezed)) {
+        len = squeeze_whitespace(buf, text, len, buf->squeezed);
+        return len == 0 || buf->write_fn(buf->data, buf->squeezed, len);
+    }
 
-    buf->alloc += BUF_CHUNK_SIZE;
-    if (at_least >= BUF_CHUNK_SIZE)
-        buf->alloc += at_least;
+    squeezed = malloc(len + 1);
+    if (!squeezed)
+        return false;
+    len = squeeze_whitespace(buf, text, len, squeezed);
+    ok = (len == 0 || buf->write_fn(buf->data, squeezed, len));
+    free(squeezed);
+    return ok;
+}
 
-    new = realloc(buf->buf, buf->alloc);
-    if (!new)
+static bool
+flush_buf(struct buf *buf)
+{
+    if (buf->size > 0 && !write_out(buf, buf->chunk, buf->size))
         return false;
 
-    buf->buf = new;
+    buf->size = 0;
     return true;
 }
 
@@ -83,36 +170,36 @@ check_write_buf(struct buf *buf, const char *fmt, ...)
     va_list args;
     int printed;
     size_t available;
+    char *str;
+    bool ok;
+
+    if (BUF_CHUNK_SIZE - buf->size < BUF_MIN_AVAILABLE && !flush_buf(buf))
+        return false;
 
-    available = buf->alloc - buf->size;
+    available = BUF_CHUNK_SIZE - buf->size;
     va_start(args, fmt);
-    printed = vsnprintf(buf->buf + buf->size, available, fmt, args);
+    printed = vsnprintf(buf->chunk + buf->size, available, fmt, args);
     va_end(args);
 
     if (printed < 0)
-        goto err;
-
-    if ((size_t) printed >= available)
-        if (!do_realloc(buf, printed))
-            goto err;
+        return false;
 
-    /* The buffer has enough space now. */
+    if ((size_t) printed < available) {
+        buf->size += printed;
+        return true;
+    }
 
-    available = buf->alloc - buf->size;
+    /* Doesn't fit in a chunk at all; pass it through on its own. */
     va_start(args, fmt);
-    printed = vsnprintf(buf->buf + buf->size, available, fmt, args);
+    printed = vasprintf(&str, fmt, args);
     va_end(args);
 
-    if (printed < 0 || (size_t) printed >= available)
-        goto err;
-
-    buf->size += printed;
-    return true;
+    if (printed < 0)
+        return false;
 
-err:
-    free(buf->buf);
-    buf->buf = NULL;
-    return false;
+    ok = (flush_buf(buf) && write_out(buf, str, printed));
+    free(str);
+    return ok;
 }
 
 #define write_buf(buf, ...) do { \
@@ -151,7 +238,7 @@ write_keycodes(struct xkb_keymap *keymap, struct buf *buf)
     xkb_led_index_t idx;
     const struct xkb_led *led;
 
-    if (keymap->keycodes_section_name)
+    if (keymap->keycodes_section_name && !buf->compact)
         write_buf(buf, "xkb_keycodes \"%s\" {\n",
                   keymap->keycodes_section_name);
     else
@@ -178,10 +265,12 @@ write_keycodes(struct xkb_keymap *keymap, struct buf *buf)
                       idx + 1, xkb_atom_text(keymap->ctx, led->name));
 
 
-    for (unsigned i = 0; i < keymap->num_key_aliases; i++)
-        write_buf(buf, "\talias %-14s = %s;\n",
-                  KeyNameText(keymap->ctx, keymap->key_aliases[i].alias),
-                  KeyNameText(keymap->ctx, keymap->key_aliases[i].real));
+    /* The aliases are only used while compiling the symbols. */
+    if (!buf->compact)
+        for (unsigned i = 0; i < keymap->num_key_aliases; i++)
+            write_buf(buf, "\talias %-14s = %s;\n",
+                      KeyNameText(keymap->ctx, keymap->key_aliases[i].alias),
+                      KeyNameText(keymap->ctx, keymap->key_aliases[i].real));
 
     write_buf(buf, "};\n\n");
     return true;
@@ -190,7 +279,7 @@ write_keycodes(struct xkb_keymap *keymap, struct buf *buf)
 static bool
 write_types(struct xkb_keymap *keymap, struct buf *buf)
 {
-    if (keymap->types_section_name)
+    if (keymap->types_section_name && !buf->compact)
         write_buf(buf, "xkb_types \"%s\" {\n",
                   keymap->types_section_name);
     else
@@ -228,7 +317,12 @@ write_types(struct xkb_keymap *keymap, struct buf *buf)
                                            entry->preserve.mods));
         }
 
-        for (xkb_level_index_t n = 0; n < type->num_levels; n++)
+        /*
+         * The level names give the type its number of levels, so in
+         * compact mode the last one is still written.
+         */
+        for (xkb_level_index_t n = buf->compact ? type->num_levels - 1 : 0;
+             n < type->num_levels; n++)
             if (type->level_names[n])
                 write_buf(buf, "\t\tlevel_name[Level%u]= \"%s\";\n", n + 1,
                           xkb_atom_text(keymap->ctx, type->level_names[n]));
@@ -279,15 +373,26 @@ affect_lock_text(enum xkb_action_flags flags)
 {
     switch (flags & (ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK)) {
     case ACTION_LOCK_NO_UNLOCK:
-        return ",affect=lock";
+        return "lock";
     case ACTION_LOCK_NO_LOCK:
-        return ",affect=unlock";
+        return "unlock";
     case ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK:
-        return ",affect=neither";
+        return "neither";
     }
-    return "";
+    return NULL;
 }
 
+/* Write an action argument, after a comma unless it's the first. */
+#define write_arg(buf, sep, ...) do { \
+    write_buf(buf, "%s", sep); \
+    write_buf(buf, __VA_ARGS__); \
+    sep = ","; \
+} while (0)
+
+/*
+ * In compact mode, arguments which have their default value are left
+ * out; see NewActionsInfo().
+ */
 static bool
 write_action(struct xkb_keymap *keymap, struct buf *buf,
              const union xkb_action *action,
@@ -295,6 +400,8 @@ write_action(struct xkb_keymap *keymap, struct buf *buf,
 {
     const char *type;
     const char *args = NULL;
+    const char *sep = "";
+    const bool compact = buf->compact;
 
     if (!prefix)
         prefix = "";
@@ -307,27 +414,42 @@ write_action(struct xkb_keymap *keymap, struct buf *buf,
     case ACTION_TYPE_MOD_LOCK:
     case ACTION_TYPE_MOD_SET:
     case ACTION_TYPE_MOD_LATCH:
+        write_buf(buf, "%s%s(", prefix, type);
         if (action->mods.flags & ACTION_MODS_LOOKUP_MODMAP)
-            args = "modMapMods";
-        else
-            args = ModMaskText(keymap->ctx, &keymap->mods,
-                               action->mods.mods.mods);
-        write_buf(buf, "%s%s(modifiers=%s%s%s%s)%s", prefix, type, args,
-                  (action->type != ACTION_TYPE_MOD_LOCK && (action->mods.flags & ACTION_LOCK_CLEAR)) ? ",clearLocks" : "",
-                  (action->type != ACTION_TYPE_MOD_LOCK && (action->mods.flags & ACTION_LATCH_TO_LOCK)) ? ",latchToLock" : "",
-                  (action->type == ACTION_TYPE_MOD_LOCK) ? affect_lock_text(action->mods.flags) : "",
-                  suffix);
+            write_arg(buf, sep, "modifiers=modMapMods");
+        else if (!compact || action->mods.mods.mods)
+            write_arg(buf, sep, "modifiers=%s",
+                      ModMaskText(keymap->ctx, &keymap->mods,
+                                  action->mods.mods.mods));
+        if (action->type != ACTION_TYPE_MOD_LOCK) {
+            if (action->mods.flags & ACTION_LOCK_CLEAR)
+                write_arg(buf, sep, "clearLocks");
+            if (action->mods.flags & ACTION_LATCH_TO_LOCK)
+                write_arg(buf, sep, "latchToLock");
+        }
+        else if ((args = affect_lock_text(action->mods.flags))) {
+            write_arg(buf, sep, "affect=%s", args);
+        }
+        write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_GROUP_SET:
     case ACTION_TYPE_GROUP_LATCH:
     case ACTION_TYPE_GROUP_LOCK:
-        write_buf(buf, "%s%s(group=%s%d%s%s)%s", prefix, type,
-                  (!(action->group.flags & ACTION_ABSOLUTE_SWITCH) && action->group.group > 0) ? "+" : "",
-                  (action->group.flags & ACTION_ABSOLUTE_SWITCH) ? action->group.group + 1 : action->group.group,
-                  (action->type != ACTION_TYPE_GROUP_LOCK && (action->group.flags & ACTION_LOCK_CLEAR)) ? ",clearLocks" : "",
-                  (action->type != ACTION_TYPE_GROUP_LOCK && (action->group.flags & ACTION_LATCH_TO_LOCK)) ? ",latchToLock" : "",
-                  suffix);
+        write_buf(buf, "%s%s(", prefix, type);
+        if (action->group.flags & ACTION_ABSOLUTE_SWITCH)
+            write_arg(buf, sep, "group=%d", action->group.group + 1);
+        else if (!compact || action->group.group != 0)
+            write_arg(buf, sep, "group=%s%d",
+                      action->group.group > 0 ? "+" : "",
+                      action->group.group);
+        if (action->type != ACTION_TYPE_GROUP_LOCK) {
+            if (action->group.flags & ACTION_LOCK_CLEAR)
+                write_arg(buf, sep, "clearLocks");
+            if (action->group.flags & ACTION_LATCH_TO_LOCK)
+                write_arg(buf, sep, "latchToLock");
+        }
+        write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_TERMINATE:
@@ -335,53 +457,75 @@ write_action(struct xkb_keymap *keymap, struct buf *buf,
         break;
 
     case ACTION_TYPE_PTR_MOVE:
-        write_buf(buf, "%s%s(x=%s%d,y=%s%d%s)%s", prefix, type,
-                  (!(action->ptr.flags & ACTION_ABSOLUTE_X) && action->ptr.x >= 0) ? "+" : "",
-                  action->ptr.x,
-                  (!(action->ptr.flags & ACTION_ABSOLUTE_Y) && action->ptr.y >= 0) ? "+" : "",
-                  action->ptr.y,
-                  (action->ptr.flags & ACTION_ACCEL) ? "" : ",!accel",
-                  suffix);
+        write_buf(buf, "%s%s(", prefix, type);
+        if (!compact || action->ptr.x != 0 ||
+            (action->ptr.flags & ACTION_ABSOLUTE_X))
+            write_arg(buf, sep, "x=%s%d",
+                      (!(action->ptr.flags & ACTION_ABSOLUTE_X) && action->ptr.x >= 0) ? "+" : "",
+                      action->ptr.x);
+        if (!compact || action->ptr.y != 0 ||
+            (action->ptr.flags & ACTION_ABSOLUTE_Y))
+            write_arg(buf, sep, "y=%s%d",
+                      (!(action->ptr.flags & ACTION_ABSOLUTE_Y) && action->ptr.y >= 0) ? "+" : "",
+                      action->ptr.y);
+        if (!(action->ptr.flags & ACTION_ACCEL))
+            write_arg(buf, sep, "!accel");
+        write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_PTR_LOCK:
         args = affect_lock_text(action->btn.flags);
         /* fallthrough */
     case ACTION_TYPE_PTR_BUTTON:
-        write_buf(buf, "%s%s(button=", prefix, type);
+        write_buf(buf, "%s%s(", prefix, type);
         if (action->btn.button > 0 && action->btn.button <= 5)
-            write_buf(buf, "%d", action->btn.button);
-        else
-            write_buf(buf, "default");
+            write_arg(buf, sep, "button=%d", action->btn.button);
+        else if (!compact)
+            write_arg(buf, sep, "button=default");
         if (action->btn.count)
-            write_buf(buf, ",count=%d", action->btn.count);
+            write_arg(buf, sep, "count=%d", action->btn.count);
         if (args)
-            write_buf(buf, "%s", args);
+            write_arg(buf, sep, "affect=%s", args);
         write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_PTR_DEFAULT:
         write_buf(buf, "%s%s(", prefix, type);
-        write_buf(buf, "affect=button,button=%s%d",
-                  (!(action->dflt.flags & ACTION_ABSOLUTE_SWITCH) && action->dflt.value >= 0) ? "+" : "",
-                  action->dflt.value);
+        if (!compact || action->dflt.value != 1 ||
+            (action->dflt.flags & ACTION_ABSOLUTE_SWITCH)) {
+            if (!compact)
+                write_arg(buf, sep, "affect=button");
+            write_arg(buf, sep, "button=%s%d",
+                      (!(action->dflt.flags & ACTION_ABSOLUTE_SWITCH) && action->dflt.value >= 0) ? "+" : "",
+                      action->dflt.value);
+        }
         write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_SWITCH_VT:
-        write_buf(buf, "%s%s(screen=%s%d,%ssame)%s", prefix, type,
-                  (!(action->screen.flags & ACTION_ABSOLUTE_SWITCH) && action->screen.screen >= 0) ? "+" : "",
-                  action->screen.screen,
-                  (action->screen.flags & ACTION_SAME_SCREEN) ? "" : "!",
-                  suffix);
+        write_buf(buf, "%s%s(", prefix, type);
+        if (!compact || action->screen.screen != 0 ||
+            (action->screen.flags & ACTION_ABSOLUTE_SWITCH))
+            write_arg(buf, sep, "screen=%s%d",
+                      (!(action->screen.flags & ACTION_ABSOLUTE_SWITCH) && action->screen.screen >= 0) ? "+" : "",
+                      action->screen.screen);
+        if (!(action->screen.flags & ACTION_SAME_SCREEN))
+            write_arg(buf, sep, "!same");
+        else if (!compact)
+            write_arg(buf, sep, "same");
+        write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_CTRL_SET:
     case ACTION_TYPE_CTRL_LOCK:
-        write_buf(buf, "%s%s(controls=%s%s)%s", prefix, type,
-                  ControlMaskText(keymap->ctx, action->ctrls.ctrls),
-                  (action->type == ACTION_TYPE_CTRL_LOCK) ? affect_lock_text(action->ctrls.flags) : "",
-                  suffix);
+        write_buf(buf, "%s%s(", prefix, type);
+        if (!compact || action->ctrls.ctrls)
+            write_arg(buf, sep, "controls=%s",
+                      ControlMaskText(keymap->ctx, action->ctrls.ctrls));
+        if (action->type == ACTION_TYPE_CTRL_LOCK &&
+            (args = affect_lock_text(action->ctrls.flags)))
+            write_arg(buf, sep, "affect=%s", args);
+        write_buf(buf, ")%s", suffix);
         break;
 
     case ACTION_TYPE_NONE:
@@ -403,16 +547,8 @@ write_action(struct xkb_keymap *keymap, struct buf *buf,
 }
 
 static bool
-write_compat(struct xkb_keymap *keymap, struct buf *buf)
+write_interprets(struct xkb_keymap *keymap, struct buf *buf)
 {
-    const struct xkb_led *led;
-
-    if (keymap->compat_section_name)
-        write_buf(buf, "xkb_compatibility \"%s\" {\n",
-                  keymap->compat_section_name);
-    else
-        write_buf(buf, "xkb_compatibility {\n");
-
     write_vmods(keymap, buf);
 
     write_buf(buf, "\tinterpret.useModMapMods= AnyLevel;\n");
@@ -441,6 +577,29 @@ write_compat(struct xkb_keymap *keymap, struct buf *buf)
         write_buf(buf, "\t};\n");
     }
 
+    return true;
+}
+
+static bool
+write_compat(struct xkb_keymap *keymap, struct buf *buf)
+{
+    const struct xkb_led *led;
+
+    if (keymap->compat_section_name && !buf->compact)
+        write_buf(buf, "xkb_compatibility \"%s\" {\n",
+                  keymap->compat_section_name);
+    else
+        write_buf(buf, "xkb_compatibility {\n");
+
+    /*
+     * The interprets only matter while compiling the symbols.  In compact
+     * mode, what they did is written on the keys instead (see
+     * write_key()), and the virtual modifiers are already declared in
+     * the types.
+     */
+    if (!buf->compact && !write_interprets(keymap, buf))
+        return false;
+
     xkb_leds_foreach(led, keymap)
         if (led->which_groups || led->groups || led->which_mods ||
             led->mods.mods || led->ctrls)
@@ -453,10 +612,10 @@ write_compat(struct xkb_keymap *keymap, struct buf *buf)
 
 static bool
 write_keysyms(struct xkb_keymap *keymap, struct buf *buf,
-              const struct xkb_key *key, xkb_layout_index_t group)
+              const struct xkb_key *key, xkb_layout_index_t group,
+              xkb_level_index_t width)
 {
-    for (xkb_level_index_t level = 0; level < XkbKeyGroupWidth(key, group);
-         level++) {
+    for (xkb_level_index_t level = 0; level < width; level++) {
         const xkb_keysym_t *syms;
         int num_syms;
 
@@ -485,6 +644,72 @@ write_keysyms(struct xkb_keymap *keymap, struct buf *buf,
     return true;
 }
 
+static bool
+key_has_actions(const struct xkb_key *key)
+{
+    for (xkb_layout_index_t group = 0; group < key->num_groups; group++)
+        for (xkb_level_index_t level = 0;
+             level < XkbKeyGroupWidth(key, group); level++)
+            if (key->groups[group].levels[level].action.type !=
+                ACTION_TYPE_NONE)
+                return true;
+
+    return false;
+}
+
+/*
+ * In compact mode, a type is only written if the symbols compiler
+ * wouldn't pick it for the group by itself.
+ */
+static bool
+group_needs_type(struct xkb_keymap *keymap, struct buf *buf,
+                 const struct xkb_key *key, xkb_layout_index_t group)
+{
+    const struct xkb_key_type *type = key->groups[group].type;
+    xkb_keysym_t syms[4];
+
+    if (!buf->compact)
+        return key->groups[group].explicit_type;
+
+    for (xkb_level_index_t level = 0; level < 4; level++) {
+        const xkb_keysym_t *level_syms;
+
+        syms[level] = XKB_KEY_NoSymbol;
+        if (level < type->num_levels &&
+            xkb_keymap_key_get_syms_by_level(keymap, key->keycode, group,
+                                             level, &level_syms) > 0)
+            syms[level] = level_syms[0];
+    }
+
+    return FindAutomaticType(keymap->ctx, type->num_levels, syms) !=
+           type->name;
+}
+
+/*
+ * The number of levels to write for a group.  In compact mode, empty
+ * levels at the end are left out if the group's type is written, since
+ * the type pads the group again.
+ */
+static xkb_level_index_t
+group_write_width(struct buf *buf, const struct xkb_key *key,
+                  xkb_layout_index_t group, bool typed)
+{
+    xkb_level_index_t width = XkbKeyGroupWidth(key, group);
+
+    if (!buf->compact || !typed)
+        return width;
+
+    while (width > 1) {
+        const struct xkb_level *level = &key->groups[group].levels[width - 1];
+
+        if (level->num_syms > 0 || level->action.type != ACTION_TYPE_NONE)
+            break;
+        width--;
+    }
+
+    return width;
+}
+
 static bool
 write_key(struct xkb_keymap *keymap, struct buf *buf,
           const struct xkb_key *key)
@@ -493,12 +718,33 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
     bool simple = true;
     bool explicit_types = false;
     bool multi_type = false;
-    bool show_actions;
+    bool show_actions, show_repeat;
 
     write_buf(buf, "\tkey %-20s {", KeyNameText(keymap->ctx, key->name));
 
+    /*
+     * In compact mode there are no interprets (see write_compat()), so
+     * the keys get everything they set written explicitly, unless the
+     * keymap compiler would come up with the same value without them.
+     */
+    if (buf->compact) {
+        const xkb_keysym_t *syms;
+        bool default_repeat;
+
+        show_actions = key_has_actions(key);
+        default_repeat = (!show_actions &&
+                          xkb_keymap_key_get_syms_by_level(keymap,
+                                                           key->keycode,
+                                                           0, 0, &syms) > 0);
+        show_repeat = (key->repeats != default_repeat);
+    }
+    else {
+        show_actions = (key->explicit & EXPLICIT_INTERP);
+        show_repeat = (key->explicit & EXPLICIT_REPEAT);
+    }
+
     for (group = 0; group < key->num_groups; group++) {
-        if (key->groups[group].explicit_type)
+        if (group_needs_type(keymap, buf, key, group))
             explicit_types = true;
 
         if (group != 0 && key->groups[group].type != key->groups[0].type)
@@ -511,7 +757,7 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
 
         if (multi_type) {
             for (group = 0; group < key->num_groups; group++) {
-                if (!key->groups[group].explicit_type)
+                if (!group_needs_type(keymap, buf, key, group))
                     continue;
 
                 type = key->groups[group].type;
@@ -527,7 +773,7 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
         }
     }
 
-    if (key->explicit & EXPLICIT_REPEAT) {
+    if (show_repeat) {
         if (key->repeats)
             write_buf(buf, "\n\t\trepeat= Yes,");
         else
@@ -535,7 +781,7 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
         simple = false;
     }
 
-    if (key->vmodmap && (key->explicit & EXPLICIT_VMODMAP))
+    if (key->vmodmap && (buf->compact || (key->explicit & EXPLICIT_VMODMAP)))
         write_buf(buf, "\n\t\tvirtualMods= %s,",
                   ModMaskText(keymap->ctx, &keymap->mods, key->vmodmap));
 
@@ -553,31 +799,33 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
         break;
     }
 
-    show_actions = (key->explicit & EXPLICIT_INTERP);
-
     if (key->num_groups > 1 || show_actions)
         simple = false;
 
     if (simple) {
         write_buf(buf, "\t[ ");
-        if (!write_keysyms(keymap, buf, key, 0))
+        if (!write_keysyms(keymap, buf, key, 0, XkbKeyGroupWidth(key, 0)))
             return false;
         write_buf(buf, " ] };\n");
     }
     else {
-        xkb_level_index_t level;
+        xkb_level_index_t level, width;
+        bool typed;
 
         for (group = 0; group < key->num_groups; group++) {
+            typed = (explicit_types &&
+                     (!multi_type || group_needs_type(keymap, buf, key, group)));
+            width = group_write_width(buf, key, group, typed);
+
             if (group != 0)
                 write_buf(buf, ",");
             write_buf(buf, "\n\t\tsymbols[Group%u]= [ ", group + 1);
-            if (!write_keysyms(keymap, buf, key, group))
+            if (!write_keysyms(keymap, buf, key, group, width))
                 return false;
             write_buf(buf, " ]");
             if (show_actions) {
                 write_buf(buf, ",\n\t\tactions[Group%u]= [ ", group + 1);
-                for (level = 0;
-                        level < XkbKeyGroupWidth(key, group); level++) {
+                for (level = 0; level < width; level++) {
                     if (level != 0)
                         write_buf(buf, ", ");
                     write_action(keymap, buf,
@@ -601,7 +849,7 @@ write_symbols(struct xkb_keymap *keymap, struct buf *buf)
     xkb_mod_index_t i;
     const struct xkb_mod *mod;
 
-    if (keymap->symbols_section_name)
+    if (keymap->symbols_section_name && !buf->compact)
         write_buf(buf, "xkb_symbols \"%s\" {\n",
                   keymap->symbols_section_name);
     else
@@ -651,15 +899,28 @@ write_keymap(struct xkb_keymap *keymap, struct buf *buf)
             check_write_buf(buf, "};\n"));
 }
 
-char *
-text_v1_keymap_get_as_string(struct xkb_keymap *keymap)
+bool
+text_v1_keymap_write(struct xkb_keymap *keymap,
+                     enum xkb_keymap_serialize_flags flags,
+                     xkb_keymap_write_fn write_fn, void *data)
 {
-    struct buf buf = { NULL, 0, 0 };
+    struct buf buf;
+
+    buf.write_fn = write_fn;
+    buf.data = data;
+    buf.size = 0;
+    buf.compact = (flags & XKB_KEYMAP_SERIALIZE_COMPACT);
+    buf.in_string = false;
+    buf.escaped = false;
+    buf.last = '\0';
+    buf.pending = '\0';
+
+    if (!write_keymap(keymap, &buf) || !flush_buf(&buf))
+        return false;
 
-    if (!write_keymap(keymap, &buf)) {
-        free(buf.buf);
-        return NULL;
-    }
+    /* The final newline is still held back. */
+    if (buf.compact && buf.pending)
+        return write_fn(data, "\n", 1);
 
-    return buf.buf;
+    return true;
 }
@@ -28,6 +28,8 @@
  */
 
 #include "xkbcomp-priv.h"
+#include "include.h"
+#include "arena.h"
 
 static void
 ComputeEffectiveMask(struct xkb_keymap *keymap, struct xkb_mods *mods)
@@ -169,7 +171,7 @@ ApplyInterpsToKey(struct xkb_keymap *keymap, struct xkb_key *key)
  * your actions and types are a lot more useful when any of your modifiers
  * other than Shift actually do something ...
  */
-static bool
+bool
 UpdateDerivedKeymapFields(struct xkb_keymap *keymap)
 {
     struct xkb_key *key;
@@ -209,6 +211,7 @@ UpdateDerivedKeymapFields(struct xkb_keymap *keymap)
     /* Update vmod -> led maps. */
     xkb_leds_foreach(led, keymap)
         ComputeEffectiveMask(keymap, &led->mods);
+    XkbUpdateValidLeds(keymap);
 
     /* Find maximum number of groups out of all keys in the keymap. */
     xkb_keys_foreach(key, keymap)
@@ -219,7 +222,8 @@ UpdateDerivedKeymapFields(struct xkb_keymap *keymap)
 
 typedef bool (*compile_file_fn)(XkbFile *file,
                                 struct xkb_keymap *keymap,
-                                enum merge_mode merge);
+                                enum merge_mode merge,
+                                struct include_state *state);
 
 static const compile_file_fn compile_file_fns[LAST_KEYMAP_FILE_TYPE + 1] = {
     [FILE_TYPE_KEYCODES] = CompileKeycodes,
@@ -228,14 +232,39 @@ static const compile_file_fn compile_file_fns[LAST_KEYMAP_FILE_TYPE + 1] = {
     [FILE_TYPE_SYMBOLS] = CompileSymbols,
 };
 
+static void
+add_section_time(struct xkb_context *ctx, enum xkb_file_type type,
+                 uint64_t start)
+{
+    switch (type) {
+    case FILE_TYPE_KEYCODES:
+        stats_time(ctx, keycodes_time, start);
+        break;
+    case FILE_TYPE_TYPES:
+        stats_time(ctx, types_time, start);
+        break;
+    case FILE_TYPE_COMPAT:
+        stats_time(ctx, compat_time, start);
+        break;
+    case FILE_TYPE_SYMBOLS:
+        stats_time(ctx, symbols_time, start);
+        break;
+    default:
+        break;
+    }
+}
+
 bool
-CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
+CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge,
+              struct cache_deps *deps)
 {
     bool ok;
     const char *main_name;
     XkbFile *files[LAST_KEYMAP_FILE_TYPE + 1] = { NULL };
     enum xkb_file_type type;
     struct xkb_context *ctx = keymap->ctx;
+    struct include_state state = { .deps = deps };
+    uint64_t start;
 
     main_name = file->name ? file->name : "(unnamed)";
 
@@ -257,10 +286,8 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
             continue;
         }
 
-        if (!file->topName) {
-            free(file->topName);
-            file->topName = strdup(main_name);
-        }
+        if (!file->topName)
+            file->topName = arena_strdup(file->arena, main_name);
 
         files[file->file_type] = file;
     }
@@ -282,6 +309,10 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
     if (!ok)
         return false;
 
+    /* Parse the included files of all sections at once. */
+    if (keymap->flags & XKB_KEYMAP_COMPILE_PARALLEL)
+        state.prefetch = PrefetchIncludeFiles(ctx, &state, files);
+
     /* Compile sections. */
     for (type = FIRST_KEYMAP_FILE_TYPE;
          type <= LAST_KEYMAP_FILE_TYPE;
@@ -289,13 +320,23 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
         log_dbg(ctx, "Compiling %s \"%s\"\n",
                 xkb_file_type_to_string(type), files[type]->topName);
 
-        ok = compile_file_fns[type](files[type], keymap, merge);
+        start = stats_start(ctx);
+        ok = compile_file_fns[type](files[type], keymap, merge, &state);
+        add_section_time(ctx, type, start);
         if (!ok) {
             log_err(ctx, "Failed to compile %s\n",
                     xkb_file_type_to_string(type));
-            return false;
+            break;
         }
     }
 
-    return UpdateDerivedKeymapFields(keymap);
+    FreeIncludePrefetch(state.prefetch);
+
+    if (!ok)
+        return false;
+
+    start = stats_start(ctx);
+    ok = UpdateDerivedKeymapFields(keymap);
+    stats_time(ctx, derive_time, start);
+    return ok;
 }
@@ -27,13 +27,22 @@
 #ifndef XKBCOMP_PARSER_PRIV_H
 #define XKBCOMP_PARSER_PRIV_H
 
-struct parser_param;
 struct scanner;
+struct arena;
+
+struct parser_param {
+    struct xkb_context *ctx;
+    struct scanner *scanner;
+    /* Everything in the parsed file is allocated from here. */
+    struct arena *arena;
+    XkbFile *rtrn;
+    bool more_maps;
+};
 
 #include "parser.h"
 
 int
-_xkbcommon_lex(YYSTYPE *yylval, struct scanner *scanner);
+_xkbcommon_lex(YYSTYPE *yylval, struct parser_param *param);
 
 XkbFile *
 parse(struct xkb_context *ctx, struct scanner *scanner, const char *map);
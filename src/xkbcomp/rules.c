@@ -47,11 +47,29 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "xkbcomp-priv.h"
 #include "rules.h"
 #include "include.h"
 #include "scanner-utils.h"
 
+#ifdef HAVE_PTHREAD
+#define mutex_init(m) pthread_mutex_init((m), NULL)
+#define mutex_destroy(m) pthread_mutex_destroy(m)
+#define mutex_lock(m) pthread_mutex_lock(m)
+#define mutex_unlock(m) pthread_mutex_unlock(m)
+#else
+#define mutex_init(m) do { } while (0)
+#define mutex_destroy(m) do { } while (0)
+#define mutex_lock(m) do { } while (0)
+#define mutex_unlock(m) do { } while (0)
+#endif
+
 /* Scanner / Lexer */
 
 /* Values returned with some tokens, like yylval. */
@@ -201,160 +219,271 @@ struct rule_names {
     darray_matched_sval options;
 };
 
-struct group {
-    struct sval name;
-    darray_sval elements;
-};
+/***====================================================================***/
 
-struct mapping {
-    int mlvo_at_pos[_MLVO_NUM_ENTRIES];
-    unsigned int num_mlvo;
-    unsigned int defined_mlvo_mask;
-    xkb_layout_index_t layout_idx, variant_idx;
-    int kccgst_at_pos[_KCCGST_NUM_ENTRIES];
-    unsigned int num_kccgst;
-    unsigned int defined_kccgst_mask;
-    bool skip;
-};
+/*
+ * A rules file is compiled once into a struct rules, which is kept in
+ * the context and reused by all subsequent lookups in the same file
+ * (see rules_get()). All of the svals point into the file contents,
+ * which are owned by the struct rules.
+ *
+ * The cache may be used from several threads at once. It holds one
+ * reference to each of its entries, and every lookup holds another
+ * while it matches, so that an entry which is replaced because its
+ * file changed outlives the lookups which are still using it.
+ */
 
-enum mlvo_match_type {
-    MLVO_MATCH_NORMAL = 0,
-    MLVO_MATCH_WILDCARD,
-    MLVO_MATCH_GROUP,
-};
+#define RULE_NONE UINT_MAX
 
-struct rule {
-    struct sval mlvo_value_at_pos[_MLVO_NUM_ENTRIES];
-    enum mlvo_match_type match_type_at_pos[_MLVO_NUM_ENTRIES];
-    unsigned int num_mlvo_values;
-    struct sval kccgst_value_at_pos[_KCCGST_NUM_ENTRIES];
-    unsigned int num_kccgst_values;
-    bool skip;
+/* A hash table keyed by svals; used both as a set and as a map. */
+struct sval_table_entry {
+    struct sval key;
+    unsigned int value;
 };
 
-/*
- * This is the main object used to match a given RMLVO against a rules
- * file and aggragate the results in a KcCGST. It goes through a simple
- * matching state machine, with tokens as transitions (see
- * matcher_match()).
- */
-struct matcher {
-    struct xkb_context *ctx;
-    /* Input.*/
-    struct rule_names rmlvo;
-    union lvalue val;
-    struct scanner scanner;
-    darray(struct group) groups;
-    /* Current mapping. */
-    struct mapping mapping;
-    /* Current rule. */
-    struct rule rule;
-    /* Output. */
-    darray_char kccgst[_KCCGST_NUM_ENTRIES];
+struct sval_table {
+    /* Open addressing; a NULL key.start marks an empty slot. */
+    struct sval_table_entry *entries;
+    /* Always a power of 2, or 0 if there are no entries. */
+    unsigned int size;
 };
 
-static struct sval
-strip_spaces(struct sval v)
+static uint32_t
+sval_hash(struct sval s)
 {
-    while (v.len > 0 && is_space(v.start[0])) { v.len--; v.start++; }
-    while (v.len > 0 && is_space(v.start[v.len - 1])) v.len--;
-    return v;
+    /* FNV-1a. */
+    uint32_t hash = 2166136261u;
+    for (unsigned int i = 0; i < s.len; i++) {
+        hash ^= (unsigned char) s.start[i];
+        hash *= 16777619u;
+    }
+    return hash;
 }
 
-static darray_matched_sval
-split_comma_separated_mlvo(const char *s)
+static bool
+sval_table_init(struct sval_table *table, unsigned int max_entries)
 {
-    darray_matched_sval arr = darray_new();
+    table->entries = NULL;
+    table->size = 0;
 
-    /*
-     * Make sure the array returned by this function always includes at
-     * least one value, e.g. "" -> { "" } and "," -> { "", "" }.
-     */
+    if (max_entries == 0)
+        return true;
 
-    if (!s) {
-        struct matched_sval val = { .sval = { NULL, 0 } };
-        darray_append(arr, val);
-        return arr;
-    }
+    /* Keep the load factor under 1/2. */
+    table->size = 8;
+    while (table->size < max_entries * 2)
+        table->size *= 2;
 
-    while (true) {
-        struct matched_sval val = { .sval = { s, 0 } };
-        while (*s != '\0' && *s != ',') { s++; val.sval.len++; }
-        val.sval = strip_spaces(val.sval);
-        darray_append(arr, val);
-        if (*s == '\0') break;
-        if (*s == ',') s++;
+    table->entries = calloc(table->size, sizeof(*table->entries));
+    if (!table->entries) {
+        table->size = 0;
+        return false;
     }
 
-    return arr;
+    return true;
 }
 
-static struct matcher *
-matcher_new(struct xkb_context *ctx,
-            const struct xkb_rule_names *rmlvo)
+static void
+sval_table_free(struct sval_table *table)
 {
-    struct matcher *m = calloc(1, sizeof(*m));
-    if (!m)
+    free(table->entries);
+    table->entries = NULL;
+    table->size = 0;
+}
+
+static const struct sval_table_entry *
+sval_table_find(const struct sval_table *table, struct sval key)
+{
+    unsigned int mask, i;
+    const struct sval_table_entry *entry;
+
+    /* Keys are never empty. */
+    if (table->size == 0 || key.len == 0)
         return NULL;
 
-    m->ctx = ctx;
-    m->rmlvo.model.sval.start = rmlvo->model;
-    m->rmlvo.model.sval.len = strlen_safe(rmlvo->model);
-    m->rmlvo.layouts = split_comma_separated_mlvo(rmlvo->layout);
-    m->rmlvo.variants = split_comma_separated_mlvo(rmlvo->variant);
-    m->rmlvo.options = split_comma_separated_mlvo(rmlvo->options);
+    mask = table->size - 1;
+    for (i = sval_hash(key) & mask; ; i = (i + 1) & mask) {
+        entry = &table->entries[i];
+        if (!entry->key.start)
+            return NULL;
+        if (svaleq(entry->key, key))
+            return entry;
+    }
+}
 
-    return m;
+/*
+ * Returns the entry for @key, adding it with @value if it is not
+ * present yet. The table must have been initialized with room for it.
+ */
+static struct sval_table_entry *
+sval_table_insert(struct sval_table *table, struct sval key,
+                  unsigned int value)
+{
+    unsigned int mask = table->size - 1, i;
+    struct sval_table_entry *entry;
+
+    for (i = sval_hash(key) & mask; ; i = (i + 1) & mask) {
+        entry = &table->entries[i];
+        if (!entry->key.start) {
+            entry->key = key;
+            entry->value = value;
+            return entry;
+        }
+        if (svaleq(entry->key, key))
+            return entry;
+    }
 }
 
+struct rules_group {
+    struct sval name;
+    /* A set of the group's elements. */
+    struct sval_table elements;
+};
+
+enum mlvo_match_type {
+    MLVO_MATCH_NORMAL = 0,
+    MLVO_MATCH_WILDCARD,
+    MLVO_MATCH_GROUP,
+};
+
+struct rules_rule {
+    struct sval mlvo_value_at_pos[_MLVO_NUM_ENTRIES];
+    enum mlvo_match_type match_type_at_pos[_MLVO_NUM_ENTRIES];
+    /*
+     * For MLVO_MATCH_GROUP values, the index of the group in
+     * rules->groups, or -1 if the group was not declared before the
+     * rule (see match_group()).
+     */
+    int group_at_pos[_MLVO_NUM_ENTRIES];
+    struct sval kccgst_value_at_pos[_KCCGST_NUM_ENTRIES];
+    /* Values with an invalid %-expansion; these are not used. */
+    unsigned int invalid_kccgst_mask;
+    /* The next rule in the mapping with the same indexed value. */
+    unsigned int next;
+};
+
+struct rules_mapping {
+    enum rules_mlvo mlvo_at_pos[_MLVO_NUM_ENTRIES];
+    unsigned int num_mlvo;
+    unsigned int defined_mlvo_mask;
+    xkb_layout_index_t layout_idx, variant_idx;
+    enum rules_kccgst kccgst_at_pos[_KCCGST_NUM_ENTRIES];
+    unsigned int num_kccgst;
+    /* The rule set is rules->rules[first_rule, first_rule + num_rules). */
+    unsigned int first_rule;
+    unsigned int num_rules;
+    /*
+     * The rules are indexed by their value at index_pos, which is the
+     * position with the most plain values. The index maps such a value
+     * to the first rule having it (the rest are chained through
+     * rule->next). Rules with a wildcard or a group there are listed in
+     * generic_rules instead.
+     */
+    unsigned int index_pos;
+    struct sval_table index;
+    darray_uint generic_rules;
+};
+
+struct rules {
+    /* The file this was compiled from, and its stamp when it was. */
+    char *path;
+    int64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    /* The file contents. */
+    char *text;
+    darray(struct rules_group) groups;
+    darray(struct rules_mapping) mappings;
+    darray(struct rules_rule) rules;
+    /* Protected by the cache mutex. */
+    int refcnt;
+};
+
+struct rules_cache {
+#ifdef HAVE_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+    darray(struct rules *) rules;
+};
+
 static void
-matcher_free(struct matcher *m)
+rules_free(struct rules *rules)
 {
-    struct group *group;
-    if (!m)
+    struct rules_group *group;
+    struct rules_mapping *mapping;
+
+    if (!rules)
         return;
-    darray_free(m->rmlvo.layouts);
-    darray_free(m->rmlvo.variants);
-    darray_free(m->rmlvo.options);
-    darray_foreach(group, m->groups)
-        darray_free(group->elements);
-    for (int i = 0; i < _KCCGST_NUM_ENTRIES; i++)
-        darray_free(m->kccgst[i]);
-    darray_free(m->groups);
-    free(m);
-}
 
-#define matcher_err(matcher, fmt, ...) \
-    scanner_err(&(matcher)->scanner, fmt, ## __VA_ARGS__)
+    darray_foreach(group, rules->groups)
+        sval_table_free(&group->elements);
+    darray_free(rules->groups);
+    darray_foreach(mapping, rules->mappings) {
+        sval_table_free(&mapping->index);
+        darray_free(mapping->generic_rules);
+    }
+    darray_free(rules->mappings);
+    darray_free(rules->rules);
+    free(rules->text);
+    free(rules->path);
+    free(rules);
+}
 
 static void
-matcher_group_start_new(struct matcher *m, struct sval name)
+rules_unref(struct rules_cache *cache, struct rules *rules)
 {
-    struct group group = { .name = name, .elements = darray_new() };
-    darray_append(m->groups, group);
+    int refcnt;
+
+    if (!rules)
+        return;
+
+    mutex_lock(&cache->mutex);
+    refcnt = --rules->refcnt;
+    mutex_unlock(&cache->mutex);
+
+    if (refcnt == 0)
+        rules_free(rules);
 }
 
-static void
-matcher_group_add_element(struct matcher *m, struct sval element)
+struct rules_cache *
+rules_cache_new(void)
 {
-    darray_append(darray_item(m->groups, darray_size(m->groups) - 1).elements,
-                  element);
+    struct rules_cache *cache = calloc(1, sizeof(*cache));
+
+    if (!cache)
+        return NULL;
+
+    mutex_init(&cache->mutex);
+    return cache;
 }
 
-static void
-matcher_mapping_start_new(struct matcher *m)
+void
+rules_cache_free(struct rules_cache *cache)
 {
-    for (unsigned i = 0; i < _MLVO_NUM_ENTRIES; i++)
-        m->mapping.mlvo_at_pos[i] = -1;
-    for (unsigned i = 0; i < _KCCGST_NUM_ENTRIES; i++)
-        m->mapping.kccgst_at_pos[i] = -1;
-    m->mapping.layout_idx = m->mapping.variant_idx = XKB_LAYOUT_INVALID;
-    m->mapping.num_mlvo = m->mapping.num_kccgst = 0;
-    m->mapping.defined_mlvo_mask = 0;
-    m->mapping.defined_kccgst_mask = 0;
-    m->mapping.skip = false;
+    struct rules **rules;
+
+    if (!cache)
+        return;
+
+    darray_foreach(rules, cache->rules)
+        rules_free(*rules);
+    darray_free(cache->rules);
+    mutex_destroy(&cache->mutex);
+    free(cache);
 }
 
+/***====================================================================***/
+
+/*
+ * A %-expansion in a KcCGST value, e.g. "%+l[2]" (see the overview in
+ * doc/rules-format.txt).
+ */
+struct expansion {
+    enum rules_mlvo mlv;
+    xkb_layout_index_t idx;
+    char pfx, sfx;
+};
+
 static int
 extract_layout_index(const char *s, size_t max_len, xkb_layout_index_t *out)
 {
@@ -371,8 +500,161 @@ extract_layout_index(const char *s, size_t max_len, xkb_layout_index_t *out)
     return 3;
 }
 
+/*
+ * Parses the %-expansion following the '%' at value.start[*pos - 1],
+ * and advances *pos past it. On failure, *bad_index tells whether
+ * it's because of an index on something other than a layout or
+ * variant.
+ */
+static bool
+parse_expansion(struct sval value, unsigned int *pos,
+                struct expansion *out, bool *bad_index)
+{
+    const char *s = value.start;
+    unsigned int i = *pos;
+
+    /*
+     * Some ugly hand-lexing here, but going through the scanner is more
+     * trouble than it's worth, and the format is ugly on its own merit.
+     */
+
+    *bad_index = false;
+    if (i >= value.len) return false;
+
+    out->pfx = out->sfx = 0;
+
+    /* Check for prefix. */
+    if (s[i] == '(' || s[i] == '+' || s[i] == '|' ||
+        s[i] == '_' || s[i] == '-') {
+        out->pfx = s[i];
+        if (s[i] == '(') out->sfx = ')';
+        if (++i >= value.len) return false;
+    }
+
+    /* Mandatory model/layout/variant specifier. */
+    switch (s[i++]) {
+    case 'm': out->mlv = MLVO_MODEL; break;
+    case 'l': out->mlv = MLVO_LAYOUT; break;
+    case 'v': out->mlv = MLVO_VARIANT; break;
+    default: return false;
+    }
+
+    /* Check for index. */
+    out->idx = XKB_LAYOUT_INVALID;
+    if (i < value.len && s[i] == '[') {
+        int consumed;
+
+        if (out->mlv != MLVO_LAYOUT && out->mlv != MLVO_VARIANT) {
+            *bad_index = true;
+            return false;
+        }
+
+        consumed = extract_layout_index(s + i, value.len - i, &out->idx);
+        if (consumed == -1) return false;
+        i += consumed;
+    }
+
+    /* Check for suffix, if there supposed to be one. */
+    if (out->sfx != 0) {
+        if (i >= value.len) return false;
+        if (s[i++] != out->sfx) return false;
+    }
+
+    *pos = i;
+    return true;
+}
+
+/***====================================================================***/
+
+/*
+ * The parser builds a struct rules out of a rules file. It goes
+ * through a simple state machine, with tokens as transitions (see
+ * parser_parse()).
+ */
+
+struct mapping {
+    int mlvo_at_pos[_MLVO_NUM_ENTRIES];
+    unsigned int num_mlvo;
+    unsigned int defined_mlvo_mask;
+    xkb_layout_index_t layout_idx, variant_idx;
+    int kccgst_at_pos[_KCCGST_NUM_ENTRIES];
+    unsigned int num_kccgst;
+    unsigned int defined_kccgst_mask;
+    bool skip;
+};
+
+struct rule {
+    struct sval mlvo_value_at_pos[_MLVO_NUM_ENTRIES];
+    enum mlvo_match_type match_type_at_pos[_MLVO_NUM_ENTRIES];
+    unsigned int num_mlvo_values;
+    struct sval kccgst_value_at_pos[_KCCGST_NUM_ENTRIES];
+    unsigned int num_kccgst_values;
+    bool skip;
+};
+
+struct parser {
+    struct xkb_context *ctx;
+    /* Output. */
+    struct rules *rules;
+    union lvalue val;
+    struct scanner scanner;
+    /* Elements of the current group. */
+    darray_sval group_elements;
+    /* Current mapping. */
+    struct mapping mapping;
+    /* Current rule. */
+    struct rule rule;
+};
+
+#define parser_err(parser, fmt, ...) \
+    scanner_err(&(parser)->scanner, fmt, ## __VA_ARGS__)
+
+static void
+parser_group_start_new(struct parser *p, struct sval name)
+{
+    struct rules_group group = { .name = name };
+    darray_append(p->rules->groups, group);
+    darray_resize(p->group_elements, 0);
+}
+
+static void
+parser_group_add_element(struct parser *p, struct sval element)
+{
+    darray_append(p->group_elements, element);
+}
+
+static bool
+parser_group_end(struct parser *p)
+{
+    struct rules_group *group;
+    struct sval *element;
+
+    group = &darray_item(p->rules->groups, darray_size(p->rules->groups) - 1);
+    if (!sval_table_init(&group->elements, darray_size(p->group_elements)))
+        return false;
+
+    darray_foreach(element, p->group_elements)
+        sval_table_insert(&group->elements, *element, 0);
+
+    return true;
+}
+
+static void
+parser_mapping_start_new(struct parser *p)
+{
+    for (unsigned i = 0; i < _MLVO_NUM_ENTRIES; i++)
+        p->mapping.mlvo_at_pos[i] = -1;
+    for (unsigned i = 0; i < _KCCGST_NUM_ENTRIES; i++)
+        p->mapping.kccgst_at_pos[i] = -1;
+    p->mapping.layout_idx = p->mapping.variant_idx = XKB_LAYOUT_INVALID;
+    p->mapping.num_mlvo = p->mapping.num_kccgst = 0;
+    p->mapping.defined_mlvo_mask = 0;
+    p->mapping.defined_kccgst_mask = 0;
+    p->mapping.skip = false;
+}
+
 static void
-matcher_mapping_set_mlvo(struct matcher *m, struct sval ident)
+parser_mapping_set_mlvo(struct parser *p, struct sval ident)
 {
     enum rules_mlvo mlvo;
     struct sval mlvo_sval;
@@ -386,16 +668,16 @@ matcher_mapping_set_mlvo(struct matcher *m, struct sval ident)
 
     /* Not found. */
     if (mlvo >= _MLVO_NUM_ENTRIES) {
-        matcher_err(m, "invalid mapping: %.*s is not a valid value here; ignoring rule set",
-                    ident.len, ident.start);
-        m->mapping.skip = true;
+        parser_err(p, "invalid mapping: %.*s is not a valid value here; ignoring rule set",
+                   ident.len, ident.start);
+        p->mapping.skip = true;
         return;
     }
 
-    if (m->mapping.defined_mlvo_mask & (1u << mlvo)) {
-        matcher_err(m, "invalid mapping: %.*s appears twice on the same line; ignoring rule set",
-                    mlvo_sval.len, mlvo_sval.start);
-        m->mapping.skip = true;
+    if (p->mapping.defined_mlvo_mask & (1u << mlvo)) {
+        parser_err(p, "invalid mapping: %.*s appears twice on the same line; ignoring rule set",
+                   mlvo_sval.len, mlvo_sval.start);
+        p->mapping.skip = true;
         return;
     }
 
@@ -405,33 +687,33 @@ matcher_mapping_set_mlvo(struct matcher *m, struct sval ident)
         int consumed = extract_layout_index(ident.start + mlvo_sval.len,
                                             ident.len - mlvo_sval.len, &idx);
         if ((int) (ident.len - mlvo_sval.len) != consumed) {
-            matcher_err(m, "invalid mapping: \"%.*s\" may only be followed by a valid group index; ignoring rule set",
-                        mlvo_sval.len, mlvo_sval.start);
-            m->mapping.skip = true;
+            parser_err(p, "invalid mapping: \"%.*s\" may only be followed by a valid group index; ignoring rule set",
+                       mlvo_sval.len, mlvo_sval.start);
+            p->mapping.skip = true;
             return;
         }
 
         if (mlvo == MLVO_LAYOUT) {
-            m->mapping.layout_idx = idx;
+            p->mapping.layout_idx = idx;
         }
         else if (mlvo == MLVO_VARIANT) {
-            m->mapping.variant_idx = idx;
+            p->mapping.variant_idx = idx;
         }
         else {
-            matcher_err(m, "invalid mapping: \"%.*s\" cannot be followed by a group index; ignoring rule set",
-                        mlvo_sval.len, mlvo_sval.start);
-            m->mapping.skip = true;
+            parser_err(p, "invalid mapping: \"%.*s\" cannot be followed by a group index; ignoring rule set",
+                       mlvo_sval.len, mlvo_sval.start);
+            p->mapping.skip = true;
             return;
         }
     }
 
-    m->mapping.mlvo_at_pos[m->mapping.num_mlvo] = mlvo;
-    m->mapping.defined_mlvo_mask |= 1u << mlvo;
-    m->mapping.num_mlvo++;
+    p->mapping.mlvo_at_pos[p->mapping.num_mlvo] = mlvo;
+    p->mapping.defined_mlvo_mask |= 1u << mlvo;
+    p->mapping.num_mlvo++;
 }
 
 static void
-matcher_mapping_set_kccgst(struct matcher *m, struct sval ident)
+parser_mapping_set_kccgst(struct parser *p, struct sval ident)
 {
     enum rules_kccgst kccgst;
     struct sval kccgst_sval;
@@ -445,393 +727,253 @@ matcher_mapping_set_kccgst(struct matcher *m, struct sval ident)
 
     /* Not found. */
     if (kccgst >= _KCCGST_NUM_ENTRIES) {
-        matcher_err(m, "invalid mapping: %.*s is not a valid value here; ignoring rule set",
-                    ident.len, ident.start);
-        m->mapping.skip = true;
+        parser_err(p, "invalid mapping: %.*s is not a valid value here; ignoring rule set",
+                   ident.len, ident.start);
+        p->mapping.skip = true;
         return;
     }
 
-    if (m->mapping.defined_kccgst_mask & (1u << kccgst)) {
-        matcher_err(m, "invalid mapping: %.*s appears twice on the same line; ignoring rule set",
-                    kccgst_sval.len, kccgst_sval.start);
-        m->mapping.skip = true;
+    if (p->mapping.defined_kccgst_mask & (1u << kccgst)) {
+        parser_err(p, "invalid mapping: %.*s appears twice on the same line; ignoring rule set",
+                   kccgst_sval.len, kccgst_sval.start);
+        p->mapping.skip = true;
         return;
     }
 
-    m->mapping.kccgst_at_pos[m->mapping.num_kccgst] = kccgst;
-    m->mapping.defined_kccgst_mask |= 1u << kccgst;
-    m->mapping.num_kccgst++;
+    p->mapping.kccgst_at_pos[p->mapping.num_kccgst] = kccgst;
+    p->mapping.defined_kccgst_mask |= 1u << kccgst;
+    p->mapping.num_kccgst++;
 }
 
+/*
+ * Checks the mapping line, and adds it to the rules if it's fine.
+ * Whether a mapping applies to a given number of layouts and variants
+ * is only known at match time; see matcher_mapping_applies().
+ */
 static void
-matcher_mapping_verify(struct matcher *m)
+parser_mapping_end(struct parser *p)
 {
-    if (m->mapping.num_mlvo == 0) {
-        matcher_err(m, "invalid mapping: must have at least one value on the left hand side; ignoring rule set");
-        goto skip;
+    struct rules_mapping mapping;
+
+    if (p->mapping.num_mlvo == 0) {
+        parser_err(p, "invalid mapping: must have at least one value on the left hand side; ignoring rule set");
+        p->mapping.skip = true;
+        return;
     }
 
-    if (m->mapping.num_kccgst == 0) {
-        matcher_err(m, "invalid mapping: must have at least one value on the right hand side; ignoring rule set");
-        goto skip;
+    if (p->mapping.num_kccgst == 0) {
+        parser_err(p, "invalid mapping: must have at least one value on the right hand side; ignoring rule set");
+        p->mapping.skip = true;
+        return;
     }
 
-    /*
-     * This following is very stupid, but this is how it works.
-     * See the "Notes" section in the overview above.
-     */
-
-    if (m->mapping.defined_mlvo_mask & (1u << MLVO_LAYOUT)) {
-        if (m->mapping.layout_idx == XKB_LAYOUT_INVALID) {
-            if (darray_size(m->rmlvo.layouts) > 1)
-                goto skip;
-        }
-        else {
-            if (darray_size(m->rmlvo.layouts) == 1 ||
-                m->mapping.layout_idx >= darray_size(m->rmlvo.layouts))
-                goto skip;
-        }
-    }
-
-    if (m->mapping.defined_mlvo_mask & (1u << MLVO_VARIANT)) {
-        if (m->mapping.variant_idx == XKB_LAYOUT_INVALID) {
-            if (darray_size(m->rmlvo.variants) > 1)
-                goto skip;
-        }
-        else {
-            if (darray_size(m->rmlvo.variants) == 1 ||
-                m->mapping.variant_idx >= darray_size(m->rmlvo.variants))
-                goto skip;
-        }
-    }
-
-    return;
-
-skip:
-    m->mapping.skip = true;
-}
+    memset(&mapping, 0, sizeof(mapping));
+    for (unsigned i = 0; i < p->mapping.num_mlvo; i++)
+        mapping.mlvo_at_pos[i] = p->mapping.mlvo_at_pos[i];
+    mapping.num_mlvo = p->mapping.num_mlvo;
+    mapping.defined_mlvo_mask = p->mapping.defined_mlvo_mask;
+    mapping.layout_idx = p->mapping.layout_idx;
+    mapping.variant_idx = p->mapping.variant_idx;
+    for (unsigned i = 0; i < p->mapping.num_kccgst; i++)
+        mapping.kccgst_at_pos[i] = p->mapping.kccgst_at_pos[i];
+    mapping.num_kccgst = p->mapping.num_kccgst;
+    mapping.first_rule = darray_size(p->rules->rules);
+    mapping.num_rules = 0;
+    darray_init(mapping.generic_rules);
+
+    darray_append(p->rules->mappings, mapping);
+}
 
 static void
-matcher_rule_start_new(struct matcher *m)
+parser_rule_start_new(struct parser *p)
 {
-    memset(&m->rule, 0, sizeof(m->rule));
-    m->rule.skip = m->mapping.skip;
+    memset(&p->rule, 0, sizeof(p->rule));
+    p->rule.skip = p->mapping.skip;
 }
 
 static void
-matcher_rule_set_mlvo_common(struct matcher *m, struct sval ident,
-                             enum mlvo_match_type match_type)
+parser_rule_set_mlvo_common(struct parser *p, struct sval ident,
+                            enum mlvo_match_type match_type)
 {
-    if (m->rule.num_mlvo_values + 1 > m->mapping.num_mlvo) {
-        matcher_err(m, "invalid rule: has more values than the mapping line; ignoring rule");
-        m->rule.skip = true;
+    if (p->rule.num_mlvo_values + 1 > p->mapping.num_mlvo) {
+        parser_err(p, "invalid rule: has more values than the mapping line; ignoring rule");
+        p->rule.skip = true;
         return;
     }
-    m->rule.match_type_at_pos[m->rule.num_mlvo_values] = match_type;
-    m->rule.mlvo_value_at_pos[m->rule.num_mlvo_values] = ident;
-    m->rule.num_mlvo_values++;
+    p->rule.match_type_at_pos[p->rule.num_mlvo_values] = match_type;
+    p->rule.mlvo_value_at_pos[p->rule.num_mlvo_values] = ident;
+    p->rule.num_mlvo_values++;
 }
 
 static void
-matcher_rule_set_mlvo_wildcard(struct matcher *m)
+parser_rule_set_mlvo_wildcard(struct parser *p)
 {
     struct sval dummy = { NULL, 0 };
-    matcher_rule_set_mlvo_common(m, dummy, MLVO_MATCH_WILDCARD);
+    parser_rule_set_mlvo_common(p, dummy, MLVO_MATCH_WILDCARD);
 }
 
 static void
-matcher_rule_set_mlvo_group(struct matcher *m, struct sval ident)
+parser_rule_set_mlvo_group(struct parser *p, struct sval ident)
 {
-    matcher_rule_set_mlvo_common(m, ident, MLVO_MATCH_GROUP);
+    parser_rule_set_mlvo_common(p, ident, MLVO_MATCH_GROUP);
 }
 
 static void
-matcher_rule_set_mlvo(struct matcher *m, struct sval ident)
+parser_rule_set_mlvo(struct parser *p, struct sval ident)
 {
-    matcher_rule_set_mlvo_common(m, ident, MLVO_MATCH_NORMAL);
+    parser_rule_set_mlvo_common(p, ident, MLVO_MATCH_NORMAL);
 }
 
 static void
-matcher_rule_set_kccgst(struct matcher *m, struct sval ident)
+parser_rule_set_kccgst(struct parser *p, struct sval ident)
 {
-    if (m->rule.num_kccgst_values + 1 > m->mapping.num_kccgst) {
-        matcher_err(m, "invalid rule: has more values than the mapping line; ignoring rule");
-        m->rule.skip = true;
+    if (p->rule.num_kccgst_values + 1 > p->mapping.num_kccgst) {
+        parser_err(p, "invalid rule: has more values than the mapping line; ignoring rule");
+        p->rule.skip = true;
         return;
     }
-    m->rule.kccgst_value_at_pos[m->rule.num_kccgst_values] = ident;
-    m->rule.num_kccgst_values++;
+    p->rule.kccgst_value_at_pos[p->rule.num_kccgst_values] = ident;
+    p->rule.num_kccgst_values++;
 }
 
-static bool
-match_group(struct matcher *m, struct sval group_name, struct sval to)
+static int
+parser_find_group(struct parser *p, struct sval name)
 {
-    struct group *group;
-    struct sval *element;
-    bool found = false;
-
-    darray_foreach(group, m->groups) {
-        if (svaleq(group->name, group_name)) {
-            found = true;
-            break;
-        }
-    }
-
-    if (!found) {
-        /*
-         * rules/evdev intentionally uses some undeclared group names
-         * in rules (e.g. commented group definitions which may be
-         * uncommented if needed). So we continue silently.
-         */
-        return false;
-    }
+    struct rules_group *group;
+    unsigned int i;
 
-    darray_foreach(element, group->elements)
-        if (svaleq(to, *element))
-            return true;
+    darray_enumerate(i, group, p->rules->groups)
+        if (svaleq(group->name, name))
+            return i;
 
-    return false;
-}
-
-static bool
-match_value(struct matcher *m, struct sval val, struct sval to,
-            enum mlvo_match_type match_type)
-{
-    if (match_type == MLVO_MATCH_WILDCARD)
-        return true;
-    if (match_type == MLVO_MATCH_GROUP)
-        return match_group(m, val, to);
-    return svaleq(val, to);
+    /*
+     * rules/evdev intentionally uses some undeclared group names
+     * in rules (e.g. commented group definitions which may be
+     * uncommented if needed). So we continue silently.
+     */
+    return -1;
 }
 
 static bool
-match_value_and_mark(struct matcher *m, struct sval val,
-                     struct matched_sval *to, enum mlvo_match_type match_type)
+parser_check_kccgst_value(struct parser *p, struct sval value)
 {
-    bool matched = match_value(m, val, to->sval, match_type);
-    if (matched)
-        to->matched = true;
-    return matched;
-}
+    struct expansion expansion;
+    bool bad_index;
 
-/*
- * This function performs %-expansion on @value (see overview above),
- * and appends the result to @to.
- */
-static bool
-append_expanded_kccgst_value(struct matcher *m, darray_char *to,
-                             struct sval value)
-{
-    const char *s = value.start;
-    darray_char expanded = darray_new();
-    char ch;
-    bool expanded_plus, to_plus;
-
-    /*
-     * Some ugly hand-lexing here, but going through the scanner is more
-     * trouble than it's worth, and the format is ugly on its own merit.
-     */
     for (unsigned i = 0; i < value.len; ) {
-        enum rules_mlvo mlv;
-        xkb_layout_index_t idx;
-        char pfx, sfx;
-        struct matched_sval *expanded_value;
-
-        /* Check if that's a start of an expansion. */
-        if (s[i] != '%') {
-            /* Just a normal character. */
-            darray_appends_nullterminate(expanded, &s[i++], 1);
+        if (value.start[i++] != '%')
             continue;
-        }
-        if (++i >= value.len) goto error;
-
-        pfx = sfx = 0;
 
-        /* Check for prefix. */
-        if (s[i] == '(' || s[i] == '+' || s[i] == '|' ||
-            s[i] == '_' || s[i] == '-') {
-            pfx = s[i];
-            if (s[i] == '(') sfx = ')';
-            if (++i >= value.len) goto error;
+        if (!parse_expansion(value, &i, &expansion, &bad_index)) {
+            if (bad_index)
+                parser_err(p, "invalid index in %%-expansion; may only index layout or variant");
+            parser_err(p, "invalid %%-expansion in value; not used");
+            return false;
         }
-
-        /* Mandatory model/layout/variant specifier. */
-        switch (s[i++]) {
-        case 'm': mlv = MLVO_MODEL; break;
-        case 'l': mlv = MLVO_LAYOUT; break;
-        case 'v': mlv = MLVO_VARIANT; break;
-        default: goto error;
-        }
-
-        /* Check for index. */
-        idx = XKB_LAYOUT_INVALID;
-        if (i < value.len && s[i] == '[') {
-            int consumed;
-
-            if (mlv != MLVO_LAYOUT && mlv != MLVO_VARIANT) {
-                matcher_err(m, "invalid index in %%-expansion; may only index layout or variant");
-                goto error;
-            }
-
-            consumed = extract_layout_index(s + i, value.len - i, &idx);
-            if (consumed == -1) goto error;
-            i += consumed;
-        }
-
-        /* Check for suffix, if there supposed to be one. */
-        if (sfx != 0) {
-            if (i >= value.len) goto error;
-            if (s[i++] != sfx) goto error;
-        }
-
-        /* Get the expanded value. */
-        expanded_value = NULL;
-
-        if (mlv == MLVO_LAYOUT) {
-            if (idx != XKB_LAYOUT_INVALID &&
-                idx < darray_size(m->rmlvo.layouts) &&
-                darray_size(m->rmlvo.layouts) > 1)
-                expanded_value = &darray_item(m->rmlvo.layouts, idx);
-            else if (idx == XKB_LAYOUT_INVALID &&
-                     darray_size(m->rmlvo.layouts) == 1)
-                expanded_value = &darray_item(m->rmlvo.layouts, 0);
-        }
-        else if (mlv == MLVO_VARIANT) {
-            if (idx != XKB_LAYOUT_INVALID &&
-                idx < darray_size(m->rmlvo.variants) &&
-                darray_size(m->rmlvo.variants) > 1)
-                expanded_value = &darray_item(m->rmlvo.variants, idx);
-            else if (idx == XKB_LAYOUT_INVALID &&
-                     darray_size(m->rmlvo.variants) == 1)
-                expanded_value = &darray_item(m->rmlvo.variants, 0);
-        }
-        else if (mlv == MLVO_MODEL) {
-            expanded_value = &m->rmlvo.model;
-        }
-
-        /* If we didn't get one, skip silently. */
-        if (!expanded_value || expanded_value->sval.len == 0)
-            continue;
-
-        if (pfx != 0)
-            darray_appends_nullterminate(expanded, &pfx, 1);
-        darray_appends_nullterminate(expanded,
-                                     expanded_value->sval.start,
-                                     expanded_value->sval.len);
-        if (sfx != 0)
-            darray_appends_nullterminate(expanded, &sfx, 1);
-        expanded_value->matched = true;
     }
 
-    /*
-     * Appending  bar to  foo ->  foo (not an error if this happens)
-     * Appending +bar to  foo ->  foo+bar
-     * Appending  bar to +foo ->  bar+foo
-     * Appending +bar to +foo -> +foo+bar
-     */
-
-    ch = (darray_empty(expanded) ? '\0' : darray_item(expanded, 0));
-    expanded_plus = (ch == '+' || ch == '|');
-    ch = (darray_empty(*to) ? '\0' : darray_item(*to, 0));
-    to_plus = (ch == '+' || ch == '|');
-
-    if (expanded_plus || darray_empty(*to))
-        darray_appends_nullterminate(*to, expanded.item, expanded.size);
-    else if (to_plus)
-        darray_prepends_nullterminate(*to, expanded.item, expanded.size);
-
-    darray_free(expanded);
     return true;
-
-error:
-    darray_free(expanded);
-    matcher_err(m, "invalid %%-expansion in value; not used");
-    return false;
 }
 
 static void
-matcher_rule_verify(struct matcher *m)
+parser_rule_end(struct parser *p)
 {
-    if (m->rule.num_mlvo_values != m->mapping.num_mlvo ||
-        m->rule.num_kccgst_values != m->mapping.num_kccgst) {
-        matcher_err(m, "invalid rule: must have same number of values as mapping line; ignoring rule");
-        m->rule.skip = true;
+    struct rules_rule rule;
+    struct rules_mapping *mapping;
+
+    if (p->rule.num_mlvo_values != p->mapping.num_mlvo ||
+        p->rule.num_kccgst_values != p->mapping.num_kccgst) {
+        parser_err(p, "invalid rule: must have same number of values as mapping line; ignoring rule");
+        p->rule.skip = true;
+        return;
+    }
+
+    memset(&rule, 0, sizeof(rule));
+    for (unsigned i = 0; i < p->mapping.num_mlvo; i++) {
+        rule.mlvo_value_at_pos[i] = p->rule.mlvo_value_at_pos[i];
+        rule.match_type_at_pos[i] = p->rule.match_type_at_pos[i];
+        rule.group_at_pos[i] = -1;
+        if (rule.match_type_at_pos[i] == MLVO_MATCH_GROUP)
+            rule.group_at_pos[i] =
+                parser_find_group(p, rule.mlvo_value_at_pos[i]);
     }
+    for (unsigned i = 0; i < p->mapping.num_kccgst; i++) {
+        rule.kccgst_value_at_pos[i] = p->rule.kccgst_value_at_pos[i];
+        if (!parser_check_kccgst_value(p, rule.kccgst_value_at_pos[i]))
+            rule.invalid_kccgst_mask |= 1u << i;
+    }
+    rule.next = RULE_NONE;
+
+    darray_append(p->rules->rules, rule);
+    mapping = &darray_item(p->rules->mappings,
+                           darray_size(p->rules->mappings) - 1);
+    mapping->num_rules++;
 }
 
-static void
-matcher_rule_apply_if_matches(struct matcher *m)
+static bool
+rules_build_index(struct rules *rules, struct rules_mapping *mapping)
 {
-    for (unsigned i = 0; i < m->mapping.num_mlvo; i++) {
-        enum rules_mlvo mlvo = m->mapping.mlvo_at_pos[i];
-        struct sval value = m->rule.mlvo_value_at_pos[i];
-        enum mlvo_match_type match_type = m->rule.match_type_at_pos[i];
-        struct matched_sval *to;
-        bool matched = false;
+    unsigned int num_normal[_MLVO_NUM_ENTRIES] = { 0 };
+    unsigned int pos, idx, i;
+    struct rules_rule *rule;
+    struct sval_table_entry *entry;
+
+    for (i = 0; i < mapping->num_rules; i++) {
+        rule = &darray_item(rules->rules, mapping->first_rule + i);
+        for (pos = 0; pos < mapping->num_mlvo; pos++)
+            if (rule->match_type_at_pos[pos] == MLVO_MATCH_NORMAL)
+                num_normal[pos]++;
+    }
 
-        if (mlvo == MLVO_MODEL) {
-            to = &m->rmlvo.model;
-            matched = match_value_and_mark(m, value, to, match_type);
-        }
-        else if (mlvo == MLVO_LAYOUT) {
-            xkb_layout_index_t idx = m->mapping.layout_idx;
-            idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
-            to = &darray_item(m->rmlvo.layouts, idx);
-            matched = match_value_and_mark(m, value, to, match_type);
-        }
-        else if (mlvo == MLVO_VARIANT) {
-            xkb_layout_index_t idx = m->mapping.layout_idx;
-            idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
-            to = &darray_item(m->rmlvo.variants, idx);
-            matched = match_value_and_mark(m, value, to, match_type);
-        }
-        else if (mlvo == MLVO_OPTION) {
-            darray_foreach(to, m->rmlvo.options) {
-                matched = match_value_and_mark(m, value, to, match_type);
-                if (matched)
-                    break;
-            }
-        }
+    mapping->index_pos = 0;
+    for (pos = 1; pos < mapping->num_mlvo; pos++)
+        if (num_normal[pos] > num_normal[mapping->index_pos])
+            mapping->index_pos = pos;
 
-        if (!matched)
-            return;
+    if (!sval_table_init(&mapping->index, num_normal[mapping->index_pos]))
+        return false;
+
+    /* Go backwards, so that the chains end up in file order. */
+    for (i = mapping->num_rules; i-- > 0; ) {
+        idx = mapping->first_rule + i;
+        rule = &darray_item(rules->rules, idx);
+        if (rule->match_type_at_pos[mapping->index_pos] != MLVO_MATCH_NORMAL)
+            continue;
+
+        entry = sval_table_insert(&mapping->index,
+                                  rule->mlvo_value_at_pos[mapping->index_pos],
+                                  RULE_NONE);
+        rule->next = entry->value;
+        entry->value = idx;
     }
 
-    for (unsigned i = 0; i < m->mapping.num_kccgst; i++) {
-        enum rules_kccgst kccgst = m->mapping.kccgst_at_pos[i];
-        struct sval value = m->rule.kccgst_value_at_pos[i];
-        append_expanded_kccgst_value(m, &m->kccgst[kccgst], value);
+    for (i = 0; i < mapping->num_rules; i++) {
+        idx = mapping->first_rule + i;
+        rule = &darray_item(rules->rules, idx);
+        if (rule->match_type_at_pos[mapping->index_pos] != MLVO_MATCH_NORMAL)
+            darray_append(mapping->generic_rules, idx);
     }
 
-    /*
-     * If a rule matches in a rule set, the rest of the set should be
-     * skipped. However, rule sets matching against options may contain
-     * several legitimate rules, so they are processed entirely.
-     */
-    if (!(m->mapping.defined_mlvo_mask & (1 << MLVO_OPTION)))
-        m->mapping.skip = true;
+    return true;
 }
 
 static enum rules_token
-gettok(struct matcher *m)
+gettok(struct parser *p)
 {
-    return lex(&m->scanner, &m->val);
+    return lex(&p->scanner, &p->val);
 }
 
 static bool
-matcher_match(struct matcher *m, const char *string, size_t len,
-              const char *file_name, struct xkb_component_names *out)
+parser_parse(struct parser *p, const char *string, size_t len,
+             const char *file_name)
 {
     enum rules_token tok;
-    struct matched_sval *mval;
+    struct rules_mapping *mapping;
 
-    if (!m)
-        return false;
-
-    scanner_init(&m->scanner, m->ctx, string, len, file_name);
+    scanner_init(&p->scanner, p->ctx, string, len, file_name);
 
 initial:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_BANG:
         goto bang;
     case TOK_END_OF_LINE:
@@ -843,20 +985,20 @@ initial:
     }
 
 bang:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_GROUP_NAME:
-        matcher_group_start_new(m, m->val.string);
+        parser_group_start_new(p, p->val.string);
         goto group_name;
     case TOK_IDENTIFIER:
-        matcher_mapping_start_new(m);
-        matcher_mapping_set_mlvo(m, m->val.string);
+        parser_mapping_start_new(p);
+        parser_mapping_set_mlvo(p, p->val.string);
         goto mapping_mlvo;
     default:
         goto unexpected;
     }
 
 group_name:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_EQUALS:
         goto group_element;
     default:
@@ -864,21 +1006,23 @@ group_name:
     }
 
 group_element:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        matcher_group_add_element(m, m->val.string);
+        parser_group_add_element(p, p->val.string);
         goto group_element;
     case TOK_END_OF_LINE:
+        if (!parser_group_end(p))
+            goto error;
         goto initial;
     default:
         goto unexpected;
     }
 
 mapping_mlvo:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        if (!m->mapping.skip)
-            matcher_mapping_set_mlvo(m, m->val.string);
+        if (!p->mapping.skip)
+            parser_mapping_set_mlvo(p, p->val.string);
         goto mapping_mlvo;
     case TOK_EQUALS:
         goto mapping_kccgst;
@@ -887,21 +1031,21 @@ mapping_mlvo:
     }
 
 mapping_kccgst:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        if (!m->mapping.skip)
-            matcher_mapping_set_kccgst(m, m->val.string);
+        if (!p->mapping.skip)
+            parser_mapping_set_kccgst(p, p->val.string);
         goto mapping_kccgst;
     case TOK_END_OF_LINE:
-        if (!m->mapping.skip)
-            matcher_mapping_verify(m);
+        if (!p->mapping.skip)
+            parser_mapping_end(p);
         goto rule_mlvo_first;
     default:
         goto unexpected;
     }
 
 rule_mlvo_first:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_BANG:
         goto bang;
     case TOK_END_OF_LINE:
@@ -909,25 +1053,25 @@ rule_mlvo_first:
     case TOK_END_OF_FILE:
         goto finish;
     default:
-        matcher_rule_start_new(m);
+        parser_rule_start_new(p);
         goto rule_mlvo_no_tok;
     }
 
 rule_mlvo:
-    tok = gettok(m);
+    tok = gettok(p);
 rule_mlvo_no_tok:
     switch (tok) {
     case TOK_IDENTIFIER:
-        if (!m->rule.skip)
-            matcher_rule_set_mlvo(m, m->val.string);
+        if (!p->rule.skip)
+            parser_rule_set_mlvo(p, p->val.string);
         goto rule_mlvo;
     case TOK_STAR:
-        if (!m->rule.skip)
-            matcher_rule_set_mlvo_wildcard(m);
+        if (!p->rule.skip)
+            parser_rule_set_mlvo_wildcard(p);
         goto rule_mlvo;
     case TOK_GROUP_NAME:
-        if (!m->rule.skip)
-            matcher_rule_set_mlvo_group(m, m->val.string);
+        if (!p->rule.skip)
+            parser_rule_set_mlvo_group(p, p->val.string);
         goto rule_mlvo;
     case TOK_EQUALS:
         goto rule_kccgst;
@@ -936,16 +1080,14 @@ rule_mlvo_no_tok:
     }
 
 rule_kccgst:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        if (!m->rule.skip)
-            matcher_rule_set_kccgst(m, m->val.string);
+        if (!p->rule.skip)
+            parser_rule_set_kccgst(p, p->val.string);
         goto rule_kccgst;
     case TOK_END_OF_LINE:
-        if (!m->rule.skip)
-            matcher_rule_verify(m);
-        if (!m->rule.skip)
-            matcher_rule_apply_if_matches(m);
+        if (!p->rule.skip)
+            parser_rule_end(p);
         goto rule_mlvo_first;
     default:
         goto unexpected;
@@ -960,12 +1102,562 @@ unexpected:
     }
 
 finish:
+    darray_foreach(mapping, p->rules->mappings)
+        if (!rules_build_index(p->rules, mapping))
+            goto error;
+    return true;
+
+state_error:
+    parser_err(p, "unexpected token");
+error:
+    return false;
+}
+
+static struct rules *
+rules_compile(struct xkb_context *ctx, FILE *file, const char *path,
+              const struct stat *stat_buf)
+{
+    bool ok;
+    const char *string;
+    size_t size;
+    struct rules *rules;
+    struct parser *parser;
+
+    if (!map_file(file, &string, &size)) {
+        log_err(ctx, "Couldn't read rules file \"%s\": %s\n",
+                path, strerror(errno));
+        return NULL;
+    }
+
+    rules = calloc(1, sizeof(*rules));
+    parser = calloc(1, sizeof(*parser));
+    if (!rules || !parser)
+        goto err_alloc;
+
+    rules->path = strdup(path);
+    rules->text = malloc(size + 1);
+    if (!rules->path || !rules->text)
+        goto err_alloc;
+    memcpy(rules->text, string, size);
+    rules->text[size] = '\0';
+    rules->size = stat_buf->st_size;
+    rules->mtime_sec = stat_buf->st_mtim.tv_sec;
+    rules->mtime_nsec = stat_buf->st_mtim.tv_nsec;
+    rules->refcnt = 1;
+
+    parser->ctx = ctx;
+    parser->rules = rules;
+    ok = parser_parse(parser, rules->text, size, rules->path);
+    darray_free(parser->group_elements);
+    free(parser);
+    unmap_file(string, size);
+
+    if (!ok) {
+        rules_free(rules);
+        return NULL;
+    }
+
+    return rules;
+
+err_alloc:
+    log_err(ctx, "Couldn't allocate memory for rules file \"%s\"\n", path);
+    rules_free(rules);
+    free(parser);
+    unmap_file(string, size);
+    return NULL;
+}
+
+static bool
+rules_is_fresh(const struct rules *rules, const struct stat *stat_buf)
+{
+    return rules->size == stat_buf->st_size &&
+           rules->mtime_sec == stat_buf->st_mtim.tv_sec &&
+           rules->mtime_nsec == stat_buf->st_mtim.tv_nsec;
+}
+
+/*
+ * Returns the compiled rules for the already opened @file, compiling
+ * them if they are not in the context's cache yet, or if the file was
+ * modified since they were. The caller gets a reference, which it
+ * drops with rules_unref() when done matching.
+ */
+static struct rules *
+rules_get(struct xkb_context *ctx, FILE *file, const char *path)
+{
+    struct rules_cache *cache = ctx->rules_cache;
+    struct stat stat_buf;
+    struct rules *rules, *stale = NULL;
+    size_t i;
+
+    if (fstat(fileno(file), &stat_buf) != 0) {
+        log_err(ctx, "Couldn't stat rules file \"%s\": %s\n",
+                path, strerror(errno));
+        return NULL;
+    }
+
+    mutex_lock(&cache->mutex);
+    for (i = 0; i < darray_size(cache->rules); i++) {
+        rules = darray_item(cache->rules, i);
+        if (streq(rules->path, path) && rules_is_fresh(rules, &stat_buf)) {
+            rules->refcnt++;
+            mutex_unlock(&cache->mutex);
+            return rules;
+        }
+    }
+    mutex_unlock(&cache->mutex);
+
+    /* Don't hold up lookups in other files while compiling. */
+    rules = rules_compile(ctx, file, path, &stat_buf);
+
+    /* Another thread may have replaced the entry in the meantime. */
+    mutex_lock(&cache->mutex);
+    for (i = 0; i < darray_size(cache->rules); i++) {
+        if (!streq(darray_item(cache->rules, i)->path, path))
+            continue;
+
+        stale = darray_item(cache->rules, i);
+        if (rules) {
+            darray_item(cache->rules, i) = rules;
+        }
+        else {
+            darray_item(cache->rules, i) =
+                darray_item(cache->rules, darray_size(cache->rules) - 1);
+            darray_resize(cache->rules, darray_size(cache->rules) - 1);
+        }
+        break;
+    }
+    if (rules) {
+        if (!stale)
+            darray_append(cache->rules, rules);
+        rules->refcnt++;
+    }
+    mutex_unlock(&cache->mutex);
+
+    rules_unref(cache, stale);
+    return rules;
+}
+
+/***====================================================================***/
+
+/* Scratch space, shared by all of the matchers of a lookup. */
+struct match_buffers {
+    /* Rules which may match in the current mapping, in file order. */
+    darray_uint candidates;
+    /* The result of a %-expansion. */
+    darray_char expanded;
+};
+
+/*
+ * This is the object used to match a given RMLVO against compiled
+ * rules, and aggregate the results in a KcCGST.
+ *
+ * A matcher lives for a single resolution, and holds all of its state,
+ * including which input values were matched. The compiled rules are
+ * shared with other lookups, and are never written to while matching.
+ */
+struct matcher {
+    struct xkb_context *ctx;
+    const struct rules *rules;
+    struct match_buffers *buffers;
+    /* Input.*/
+    struct rule_names rmlvo;
+    /* Output. */
+    darray_char kccgst[_KCCGST_NUM_ENTRIES];
+};
+
+static struct sval
+strip_spaces(struct sval v)
+{
+    while (v.len > 0 && is_space(v.start[0])) { v.len--; v.start++; }
+    while (v.len > 0 && is_space(v.start[v.len - 1])) v.len--;
+    return v;
+}
+
+static darray_matched_sval
+split_comma_separated_mlvo(const char *s)
+{
+    darray_matched_sval arr = darray_new();
+
+    /*
+     * Make sure the array returned by this function always includes at
+     * least one value, e.g. "" -> { "" } and "," -> { "", "" }.
+     */
+
+    if (!s) {
+        struct matched_sval val = { .sval = { NULL, 0 } };
+        darray_append(arr, val);
+        return arr;
+    }
+
+    while (true) {
+        struct matched_sval val = { .sval = { s, 0 } };
+        while (*s != '\0' && *s != ',') { s++; val.sval.len++; }
+        val.sval = strip_spaces(val.sval);
+        darray_append(arr, val);
+        if (*s == '\0') break;
+        if (*s == ',') s++;
+    }
+
+    return arr;
+}
+
+static struct matcher *
+matcher_new(struct xkb_context *ctx, const struct rules *rules,
+            struct match_buffers *buffers,
+            const struct xkb_rule_names *rmlvo)
+{
+    struct matcher *m = calloc(1, sizeof(*m));
+    if (!m)
+        return NULL;
+
+    m->ctx = ctx;
+    m->rules = rules;
+    m->buffers = buffers;
+    m->rmlvo.model.sval.start = rmlvo->model;
+    m->rmlvo.model.sval.len = strlen_safe(rmlvo->model);
+    m->rmlvo.layouts = split_comma_separated_mlvo(rmlvo->layout);
+    m->rmlvo.variants = split_comma_separated_mlvo(rmlvo->variant);
+    m->rmlvo.options = split_comma_separated_mlvo(rmlvo->options);
+
+    return m;
+}
+
+static void
+matcher_free(struct matcher *m)
+{
+    if (!m)
+        return;
+    darray_free(m->rmlvo.layouts);
+    darray_free(m->rmlvo.variants);
+    darray_free(m->rmlvo.options);
+    for (int i = 0; i < _KCCGST_NUM_ENTRIES; i++)
+        darray_free(m->kccgst[i]);
+    free(m);
+}
+
+static bool
+matcher_mapping_applies(struct matcher *m,
+                        const struct rules_mapping *mapping)
+{
+    /*
+     * This following is very stupid, but this is how it works.
+     * See the "Notes" section in the overview above.
+     */
+
+    if (mapping->defined_mlvo_mask & (1u << MLVO_LAYOUT)) {
+        if (mapping->layout_idx == XKB_LAYOUT_INVALID) {
+            if (darray_size(m->rmlvo.layouts) > 1)
+                return false;
+        }
+        else {
+            if (darray_size(m->rmlvo.layouts) == 1 ||
+                mapping->layout_idx >= darray_size(m->rmlvo.layouts))
+                return false;
+        }
+    }
+
+    if (mapping->defined_mlvo_mask & (1u << MLVO_VARIANT)) {
+        if (mapping->variant_idx == XKB_LAYOUT_INVALID) {
+            if (darray_size(m->rmlvo.variants) > 1)
+                return false;
+        }
+        else {
+            if (darray_size(m->rmlvo.variants) == 1 ||
+                mapping->variant_idx >= darray_size(m->rmlvo.variants))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/* Returns the input value a non-option column of @mapping matches. */
+static struct matched_sval *
+matcher_mapping_value(struct matcher *m, const struct rules_mapping *mapping,
+                      enum rules_mlvo mlvo)
+{
+    xkb_layout_index_t idx;
+
+    if (mlvo == MLVO_MODEL)
+        return &m->rmlvo.model;
+
+    idx = mapping->layout_idx;
+    idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
+    if (mlvo == MLVO_LAYOUT)
+        return &darray_item(m->rmlvo.layouts, idx);
+    return &darray_item(m->rmlvo.variants, idx);
+}
+
+static bool
+match_group(struct matcher *m, int group_idx, struct sval to)
+{
+    if (group_idx < 0)
+        return false;
+
+    return sval_table_find(&darray_item(m->rules->groups, group_idx).elements,
+                           to) != NULL;
+}
+
+static bool
+match_value(struct matcher *m, const struct rules_rule *rule,
+            unsigned int pos, struct sval to)
+{
+    enum mlvo_match_type match_type = rule->match_type_at_pos[pos];
+
+    if (match_type == MLVO_MATCH_WILDCARD)
+        return true;
+    if (match_type == MLVO_MATCH_GROUP)
+        return match_group(m, rule->group_at_pos[pos], to);
+    return svaleq(rule->mlvo_value_at_pos[pos], to);
+}
+
+static int
+compare_rule_indices(const void *a, const void *b)
+{
+    unsigned int ia = *(const unsigned int *) a;
+    unsigned int ib = *(const unsigned int *) b;
+    return (ia > ib) - (ia < ib);
+}
+
+static unsigned int
+matcher_add_candidates(struct matcher *m, const struct rules_mapping *mapping,
+                       struct sval value)
+{
+    const struct sval_table_entry *entry;
+    unsigned int idx, count = 0;
+
+    entry = sval_table_find(&mapping->index, value);
+    if (!entry)
+        return 0;
+
+    for (idx = entry->value; idx != RULE_NONE;
+         idx = darray_item(m->rules->rules, idx).next) {
+        darray_append(m->buffers->candidates, idx);
+        count++;
+    }
+
+    return count;
+}
+
+/*
+ * Finds the rules of @mapping which may match, using the index; the
+ * rest cannot, because their value at the index position doesn't.
+ */
+static void
+matcher_find_candidates(struct matcher *m,
+                        const struct rules_mapping *mapping)
+{
+    enum rules_mlvo mlvo = mapping->mlvo_at_pos[mapping->index_pos];
+    struct matched_sval *to;
+    unsigned int num_sources = 0;
+    unsigned int i, j;
+
+    darray_resize(m->buffers->candidates, 0);
+
+    if (mlvo == MLVO_OPTION) {
+        darray_foreach(to, m->rmlvo.options)
+            if (matcher_add_candidates(m, mapping, to->sval) > 0)
+                num_sources++;
+    }
+    else {
+        to = matcher_mapping_value(m, mapping, mlvo);
+        if (matcher_add_candidates(m, mapping, to->sval) > 0)
+            num_sources++;
+    }
+
+    if (!darray_empty(mapping->generic_rules)) {
+        darray_append_items(m->buffers->candidates, mapping->generic_rules.item,
+                            darray_size(mapping->generic_rules));
+        num_sources++;
+    }
+
+    /* Each source is in file order already; merge them if needed. */
+    if (num_sources <= 1)
+        return;
+
+    qsort(m->buffers->candidates.item, darray_size(m->buffers->candidates),
+          sizeof(*m->buffers->candidates.item), compare_rule_indices);
+    for (i = j = 1; i < darray_size(m->buffers->candidates); i++)
+        if (darray_item(m->buffers->candidates, i) !=
+            darray_item(m->buffers->candidates, j - 1))
+            darray_item(m->buffers->candidates, j++) = darray_item(m->buffers->candidates, i);
+    darray_resize(m->buffers->candidates, j);
+}
+
+/*
+ * This function performs %-expansion on @value (see overview above),
+ * and appends the result to @to.
+ */
+static void
+append_expanded_kccgst_value(struct matcher *m, darray_char *to,
+                             struct sval value)
+{
+    const char *s = value.start;
+    darray_char *expanded = &m->buffers->expanded;
+    char ch;
+    bool expanded_plus, to_plus, bad_index;
+
+    darray_resize(*expanded, 0);
+
+    for (unsigned i = 0; i < value.len; ) {
+        struct expansion exp;
+        struct matched_sval *expanded_value;
+
+        /* Check if that's a start of an expansion. */
+        if (s[i] != '%') {
+            /* Just a normal character. */
+            darray_appends_nullterminate(*expanded, &s[i++], 1);
+            continue;
+        }
+        i++;
+
+        /* Already checked when the rules were compiled. */
+        if (!parse_expansion(value, &i, &exp, &bad_index))
+            return;
+
+        /* Get the expanded value. */
+        expanded_value = NULL;
+
+        if (exp.mlv == MLVO_LAYOUT) {
+            if (exp.idx != XKB_LAYOUT_INVALID &&
+                exp.idx < darray_size(m->rmlvo.layouts) &&
+                darray_size(m->rmlvo.layouts) > 1)
+                expanded_value = &darray_item(m->rmlvo.layouts, exp.idx);
+            else if (exp.idx == XKB_LAYOUT_INVALID &&
+                     darray_size(m->rmlvo.layouts) == 1)
+                expanded_value = &darray_item(m->rmlvo.layouts, 0);
+        }
+        else if (exp.mlv == MLVO_VARIANT) {
+            if (exp.idx != XKB_LAYOUT_INVALID &&
+                exp.idx < darray_size(m->rmlvo.variants) &&
+                darray_size(m->rmlvo.variants) > 1)
+                expanded_value = &darray_item(m->rmlvo.variants, exp.idx);
+            else if (exp.idx == XKB_LAYOUT_INVALID &&
+                     darray_size(m->rmlvo.variants) == 1)
+                expanded_value = &darray_item(m->rmlvo.variants, 0);
+        }
+        else if (exp.mlv == MLVO_MODEL) {
+            expanded_value = &m->rmlvo.model;
+        }
+
+        /* If we didn't get one, skip silently. */
+        if (!expanded_value || expanded_value->sval.len == 0)
+            continue;
+
+        if (exp.pfx != 0)
+            darray_appends_nullterminate(*expanded, &exp.pfx, 1);
+        darray_appends_nullterminate(*expanded,
+                                     expanded_value->sval.start,
+                                     expanded_value->sval.len);
+        if (exp.sfx != 0)
+            darray_appends_nullterminate(*expanded, &exp.sfx, 1);
+        expanded_value->matched = true;
+    }
+
+    /*
+     * Appending  bar to  foo ->  foo (not an error if this happens)
+     * Appending +bar to  foo ->  foo+bar
+     * Appending  bar to +foo ->  bar+foo
+     * Appending +bar to +foo -> +foo+bar
+     */
+
+    ch = (darray_empty(*expanded) ? '\0' : darray_item(*expanded, 0));
+    expanded_plus = (ch == '+' || ch == '|');
+    ch = (darray_empty(*to) ? '\0' : darray_item(*to, 0));
+    to_plus = (ch == '+' || ch == '|');
+
+    if (expanded_plus || darray_empty(*to))
+        darray_appends_nullterminate(*to, expanded->item, expanded->size);
+    else if (to_plus)
+        darray_prepends_nullterminate(*to, expanded->item, expanded->size);
+}
+
+/*
+ * Applies @rule if it matches. The input values are marked as matched
+ * only if the entire rule does.
+ */
+static bool
+matcher_rule_apply_if_matches(struct matcher *m,
+                              const struct rules_mapping *mapping,
+                              const struct rules_rule *rule)
+{
+    struct matched_sval *matched[_MLVO_NUM_ENTRIES];
+
+    for (unsigned i = 0; i < mapping->num_mlvo; i++) {
+        enum rules_mlvo mlvo = mapping->mlvo_at_pos[i];
+        struct matched_sval *to;
+
+        matched[i] = NULL;
+
+        if (mlvo == MLVO_OPTION) {
+            darray_foreach(to, m->rmlvo.options) {
+                if (match_value(m, rule, i, to->sval)) {
+                    matched[i] = to;
+                    break;
+                }
+            }
+        }
+        else {
+            to = matcher_mapping_value(m, mapping, mlvo);
+            if (match_value(m, rule, i, to->sval))
+                matched[i] = to;
+        }
+
+        if (!matched[i])
+            return false;
+    }
+
+    for (unsigned i = 0; i < mapping->num_mlvo; i++)
+        matched[i]->matched = true;
+
+    for (unsigned i = 0; i < mapping->num_kccgst; i++) {
+        enum rules_kccgst kccgst = mapping->kccgst_at_pos[i];
+        struct sval value = rule->kccgst_value_at_pos[i];
+        if (!(rule->invalid_kccgst_mask & (1u << i)))
+            append_expanded_kccgst_value(m, &m->kccgst[kccgst], value);
+    }
+
+    return true;
+}
+
+static void
+matcher_match_mapping(struct matcher *m, const struct rules_mapping *mapping)
+{
+    unsigned int *idx;
+
+    if (!matcher_mapping_applies(m, mapping))
+        return;
+
+    matcher_find_candidates(m, mapping);
+
+    darray_foreach(idx, m->buffers->candidates) {
+        const struct rules_rule *rule = &darray_item(m->rules->rules, *idx);
+
+        if (!matcher_rule_apply_if_matches(m, mapping, rule))
+            continue;
+
+        /*
+         * If a rule matches in a rule set, the rest of the set should be
+         * skipped. However, rule sets matching against options may contain
+         * several legitimate rules, so they are processed entirely.
+         */
+        if (!(mapping->defined_mlvo_mask & (1u << MLVO_OPTION)))
+            break;
+    }
+}
+
+/* Stores the result of the matcher in @out, if it has a full KcCGST. */
+static bool
+matcher_finish(struct matcher *m, struct xkb_component_names *out)
+{
+    struct matched_sval *mval;
+
     if (darray_empty(m->kccgst[KCCGST_KEYCODES]) ||
         darray_empty(m->kccgst[KCCGST_TYPES]) ||
         darray_empty(m->kccgst[KCCGST_COMPAT]) ||
         /* darray_empty(m->kccgst[KCCGST_GEOMETRY]) || */
         darray_empty(m->kccgst[KCCGST_SYMBOLS]))
-        goto error;
+        return false;
 
     darray_steal(m->kccgst[KCCGST_KEYCODES], &out->keycodes, NULL);
     darray_steal(m->kccgst[KCCGST_TYPES], &out->types, NULL);
@@ -973,7 +1665,6 @@ finish:
     darray_steal(m->kccgst[KCCGST_SYMBOLS], &out->symbols, NULL);
     darray_free(m->kccgst[KCCGST_GEOMETRY]);
 
-
     mval = &m->rmlvo.model;
     if (!mval->matched && mval->sval.len > 0)
         log_err(m->ctx, "Unrecognized RMLVO model \"%.*s\" was ignored\n",
@@ -992,46 +1683,174 @@ finish:
                     mval->sval.len, mval->sval.start);
 
     return true;
-
-state_error:
-    matcher_err(m, "unexpected token");
-error:
-    return false;
 }
 
-bool
-xkb_components_from_rules(struct xkb_context *ctx,
-                          const struct xkb_rule_names *rmlvo,
-                          struct xkb_component_names *out)
+/*
+ * Looks up the names in @group (indices into @rmlvo) which all use the
+ * same rules file, in a single pass over the rules. Returns the number
+ * of names which were resolved.
+ */
+static size_t
+components_from_rules_group(struct xkb_context *ctx,
+                            const struct xkb_rule_names *rmlvo,
+                            struct xkb_component_names *out,
+                            const size_t *group, size_t count,
+                            struct match_buffers *buffers,
+                            struct cache_deps *deps)
 {
-    bool ret = false;
+    size_t i, resolved = 0;
     FILE *file;
     char *path;
-    const char *string;
-    size_t size;
-    struct matcher *matcher;
+    struct rules *rules;
+    struct matcher **matchers;
+    const struct rules_mapping *mapping;
 
-    file = FindFileInXkbPath(ctx, rmlvo->rules, FILE_TYPE_RULES, &path);
+    file = FindFileInXkbPath(ctx, rmlvo[group[0]].rules, FILE_TYPE_RULES,
+                             &path, deps);
     if (!file)
         goto err_out;
 
-    ret = map_file(file, &string, &size);
-    if (!ret) {
-        log_err(ctx, "Couldn't read rules file \"%s\": %s\n",
-                path, strerror(errno));
+    rules = rules_get(ctx, file, path);
+    if (!rules) {
+        log_err(ctx, "No components returned from XKB rules \"%s\"\n", path);
         goto err_file;
     }
 
-    matcher = matcher_new(ctx, rmlvo);
-    ret = matcher_match(matcher, string, size, path, out);
-    if (!ret)
-        log_err(ctx, "No components returned from XKB rules \"%s\"\n", path);
-    matcher_free(matcher);
+    matchers = calloc(count, sizeof(*matchers));
+    if (!matchers) {
+        log_err(ctx, "Couldn't allocate memory for rules lookup\n");
+        goto err_rules;
+    }
 
-    unmap_file(string, size);
+    for (i = 0; i < count; i++)
+        matchers[i] = matcher_new(ctx, rules, buffers, &rmlvo[group[i]]);
+
+    darray_foreach(mapping, rules->mappings)
+        for (i = 0; i < count; i++)
+            if (matchers[i])
+                matcher_match_mapping(matchers[i], mapping);
+
+    for (i = 0; i < count; i++) {
+        if (matchers[i] && matcher_finish(matchers[i], &out[group[i]]))
+            resolved++;
+        else
+            log_err(ctx, "No components returned from XKB rules \"%s\"\n",
+                    path);
+        matcher_free(matchers[i]);
+    }
+
+    free(matchers);
+err_rules:
+    rules_unref(ctx->rules_cache, rules);
 err_file:
     free(path);
     fclose(file);
 err_out:
-    return ret;
+    return resolved;
+}
+
+size_t
+xkb_components_from_rules_batch(struct xkb_context *ctx,
+                                const struct xkb_rule_names *rmlvo,
+                                size_t count,
+                                struct xkb_component_names *out,
+                                struct cache_deps *deps)
+{
+    size_t i, j, group_size, resolved = 0;
+    size_t *group;
+    bool *done;
+    struct match_buffers buffers;
+    uint64_t start = stats_start(ctx);
+
+    memset(out, 0, count * sizeof(*out));
+
+    group = calloc(count, sizeof(*group));
+    done = calloc(count, sizeof(*done));
+    if (!group || !done) {
+        log_err(ctx, "Couldn't allocate memory for rules lookup\n");
+        goto out;
+    }
+
+    darray_init(buffers.candidates);
+    darray_init(buffers.expanded);
+
+    /* Look up the names which use the same rules file together. */
+    for (i = 0; i < count; i++) {
+        if (done[i])
+            continue;
+
+        group_size = 0;
+        for (j = i; j < count; j++) {
+            if (!done[j] && streq(rmlvo[j].rules, rmlvo[i].rules)) {
+                group[group_size++] = j;
+                done[j] = true;
+            }
+        }
+
+        resolved += components_from_rules_group(ctx, rmlvo, out,
+                                                group, group_size, &buffers,
+                                                deps);
+    }
+
+    darray_free(buffers.candidates);
+    darray_free(buffers.expanded);
+out:
+    free(group);
+    free(done);
+    stats_time(ctx, rules_time, start);
+    return resolved;
+}
+
+bool
+xkb_components_from_rules(struct xkb_context *ctx,
+                          const struct xkb_rule_names *rmlvo,
+                          struct xkb_component_names *out,
+                          struct cache_deps *deps)
+{
+    return xkb_components_from_rules_batch(ctx, rmlvo, 1, out, deps) == 1;
+}
+
+XKB_EXPORT size_t
+xkb_context_resolve_rule_names(struct xkb_context *ctx,
+                               const struct xkb_rule_names *names,
+                               size_t count,
+                               struct xkb_component_names *components)
+{
+    struct xkb_rule_names *rmlvo;
+    size_t i, resolved;
+
+    if (count == 0)
+        return 0;
+
+    rmlvo = calloc(count, sizeof(*rmlvo));
+    if (!rmlvo) {
+        log_err_func(ctx, "couldn't allocate memory for %zu names\n", count);
+        memset(components, 0, count * sizeof(*components));
+        return 0;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (names)
+            rmlvo[i] = names[i];
+        xkb_context_sanitize_rule_names(ctx, &rmlvo[i]);
+    }
+
+    resolved = xkb_components_from_rules_batch(ctx, rmlvo, count, components,
+                                               NULL);
+
+    free(rmlvo);
+    return resolved;
+}
+
+XKB_EXPORT void
+xkb_component_names_clear(struct xkb_component_names *components,
+                          size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        free(components[i].keycodes);
+        free(components[i].types);
+        free(components[i].compat);
+        free(components[i].symbols);
+        memset(&components[i], 0, sizeof(components[i]));
+    }
 }
@@ -24,9 +24,20 @@
 #ifndef XKBCOMP_RULES_H
 #define XKBCOMP_RULES_H
 
+struct cache_deps;
+
+/* @deps, if not NULL, records the rules files which are read. */
 bool
 xkb_components_from_rules(struct xkb_context *ctx,
                           const struct xkb_rule_names *rmlvo,
-                          struct xkb_component_names *out);
+                          struct xkb_component_names *out,
+                          struct cache_deps *deps);
+
+size_t
+xkb_components_from_rules_batch(struct xkb_context *ctx,
+                                const struct xkb_rule_names *rmlvo,
+                                size_t count,
+                                struct xkb_component_names *out,
+                                struct cache_deps *deps);
 
 #endif
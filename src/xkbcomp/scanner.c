@@ -24,6 +24,7 @@
 #include "xkbcomp-priv.h"
 #include "parser-priv.h"
 #include "scanner-utils.h"
+#include "arena.h"
 
 static bool
 number(struct scanner *s, int64_t *out, int *out_tok)
@@ -59,8 +60,9 @@ number(struct scanner *s, int64_t *out, int *out_tok)
 }
 
 int
-_xkbcommon_lex(YYSTYPE *yylval, struct scanner *s)
+_xkbcommon_lex(YYSTYPE *yylval, struct parser_param *param)
 {
+    struct scanner *s = param->scanner;
     int tok;
 
 skip_more_whitespace_and_comments:
@@ -107,7 +109,7 @@ skip_more_whitespace_and_comments:
             scanner_err(s, "unterminated string literal");
             return ERROR_TOK;
         }
-        yylval->str = strdup(s->buf);
+        yylval->str = arena_strndup(param->arena, s->buf, s->buf_pos - 1);
         if (!yylval->str)
             return ERROR_TOK;
         return STRING;
@@ -158,8 +160,8 @@ skip_more_whitespace_and_comments:
         tok = keyword_to_token(s->buf, s->buf_pos - 1);
         if (tok != -1) return tok;
 
-        yylval->str = strdup(s->buf);
-        if (!yylval->str)
+        yylval->atom = xkb_atom_intern(s->ctx, s->buf, s->buf_pos - 1);
+        if (yylval->atom == XKB_ATOM_NONE)
             return ERROR_TOK;
         return IDENT;
     }
@@ -182,8 +184,18 @@ XkbParseString(struct xkb_context *ctx, const char *string, size_t len,
                const char *file_name, const char *map)
 {
     struct scanner scanner;
+    XkbFile *xkb_file;
+    uint64_t start = stats_start(ctx);
+
     scanner_init(&scanner, ctx, string, len, file_name);
-    return parse(ctx, &scanner, map);
+    xkb_file = parse(ctx, &scanner, map);
+
+    stats_time(ctx, parse_time, start);
+    if (xkb_file) {
+        stats_count(ctx, files_parsed, 1);
+        stats_count(ctx, parse_bytes, arena_size(xkb_file->arena));
+    }
+    return xkb_file;
 }
 
 XkbFile *
@@ -178,18 +178,22 @@ typedef struct {
     darray(xkb_atom_t) group_names;
     darray(ModMapEntry) modmaps;
     struct xkb_mod_set mods;
+    unsigned int include_depth;
 
     struct xkb_context *ctx;
+    struct include_state *include_state;
     /* Needed for AddKeySymbols. */
     const struct xkb_keymap *keymap;
 } SymbolsInfo;
 
 static void
 InitSymbolsInfo(SymbolsInfo *info, const struct xkb_keymap *keymap,
+                struct include_state *include_state,
                 ActionsInfo *actions, const struct xkb_mod_set *mods)
 {
     memset(info, 0, sizeof(*info));
     info->ctx = keymap->ctx;
+    info->include_state = include_state;
     info->keymap = keymap;
     info->merge = MERGE_OVERRIDE;
     InitKeyInfo(keymap->ctx, &info->default_key);
@@ -551,23 +555,26 @@ HandleIncludeSymbols(SymbolsInfo *info, IncludeStmt *include)
 {
     SymbolsInfo included;
 
-    InitSymbolsInfo(&included, info->keymap, info->actions, &info->mods);
-    included.name = include->stmt;
-    include->stmt = NULL;
+    InitSymbolsInfo(&included, info->keymap, info->include_state,
+                    info->actions, &info->mods);
+    included.name = strdup_safe(include->stmt);
 
     for (IncludeStmt *stmt = include; stmt; stmt = stmt->next_incl) {
         SymbolsInfo next_incl;
         XkbFile *file;
 
-        file = ProcessIncludeFile(info->ctx, stmt, FILE_TYPE_SYMBOLS);
+        file = ProcessIncludeFile(info->ctx, info->include_state, stmt,
+                                  FILE_TYPE_SYMBOLS);
         if (!file) {
             info->errorCount += 10;
             ClearSymbolsInfo(&included);
             return false;
         }
 
-        InitSymbolsInfo(&next_incl, info->keymap, info->actions,
-                        &included.mods);
+        InitSymbolsInfo(&next_incl, info->keymap, info->include_state,
+                        info->actions, &included.mods);
+        next_incl.include_depth = info->include_depth + 1;
+        stats_include_depth(info->ctx, next_incl.include_depth);
         if (stmt->modifier) {
             next_incl.explicit_group = atoi(stmt->modifier) - 1;
             if (next_incl.explicit_group >= XKB_MAX_GROUPS) {
@@ -681,7 +688,7 @@ AddSymbolsToKey(SymbolsInfo *info, KeyInfo *keyi, ExprDef *arrayNdx,
         return false;
     }
 
-    nLevels = darray_size(value->keysym_list.symsMapIndex);
+    nLevels = value->keysym_list.num_levels;
     if (darray_size(groupi->levels) < nLevels)
         darray_resize0(groupi->levels, nLevels);
 
@@ -691,14 +698,13 @@ AddSymbolsToKey(SymbolsInfo *info, KeyInfo *keyi, ExprDef *arrayNdx,
         unsigned int sym_index;
         struct xkb_level *leveli = &darray_item(groupi->levels, i);
 
-        sym_index = darray_item(value->keysym_list.symsMapIndex, i);
-        leveli->num_syms = darray_item(value->keysym_list.symsNumEntries, i);
+        sym_index = value->keysym_list.symsMapIndex[i];
+        leveli->num_syms = value->keysym_list.symsNumEntries[i];
         if (leveli->num_syms > 1)
             leveli->u.syms = calloc(leveli->num_syms, sizeof(*leveli->u.syms));
 
         for (unsigned j = 0; j < leveli->num_syms; j++) {
-            xkb_keysym_t keysym = darray_item(value->keysym_list.syms,
-                                              sym_index + j);
+            xkb_keysym_t keysym = value->keysym_list.syms[sym_index + j];
 
             if (leveli->num_syms == 1) {
                 if (keysym == XKB_KEY_NoSymbol)
@@ -1287,27 +1293,22 @@ FindKeyForSymbol(struct xkb_keymap *keymap, xkb_keysym_t sym)
  * - TWO_LEVEL for other 2 shift level keys.
  * and the same for four level keys.
  *
+ * @syms holds the first keysym of each of the first 4 levels, or
+ * NoSymbol for levels which are empty or beyond @width.
+ *
  * FIXME: Decide how to handle multiple-syms-per-level, and do it.
  */
-static xkb_atom_t
-FindAutomaticType(struct xkb_context *ctx, GroupInfo *groupi)
+xkb_atom_t
+FindAutomaticType(struct xkb_context *ctx, xkb_level_index_t width,
+                  const xkb_keysym_t *syms)
 {
     xkb_keysym_t sym0, sym1, sym2, sym3;
-    xkb_level_index_t width = darray_size(groupi->levels);
-
-#define GET_SYM(level) \
-    (darray_item(groupi->levels, level).num_syms == 0 ? \
-        XKB_KEY_NoSymbol : \
-     darray_item(groupi->levels, level).num_syms == 1 ? \
-        darray_item(groupi->levels, level).u.sym : \
-     /* num_syms > 1 */ \
-        darray_item(groupi->levels, level).u.syms[0])
 
     if (width == 1 || width <= 0)
         return xkb_atom_intern_literal(ctx, "ONE_LEVEL");
 
-    sym0 = GET_SYM(0);
-    sym1 = GET_SYM(1);
+    sym0 = syms[0];
+    sym1 = syms[1];
 
     if (width == 2) {
         if (xkb_keysym_is_lower(sym0) && xkb_keysym_is_upper(sym1))
@@ -1321,8 +1322,8 @@ FindAutomaticType(struct xkb_context *ctx, GroupInfo *groupi)
 
     if (width <= 4) {
         if (xkb_keysym_is_lower(sym0) && xkb_keysym_is_upper(sym1)) {
-            sym2 = GET_SYM(2);
-            sym3 = (width == 4 ? GET_SYM(3) : XKB_KEY_NoSymbol);
+            sym2 = syms[2];
+            sym3 = syms[3];
 
             if (xkb_keysym_is_lower(sym2) && xkb_keysym_is_upper(sym3))
                 return xkb_atom_intern_literal(ctx, "FOUR_LEVEL_ALPHABETIC");
@@ -1337,8 +1338,6 @@ FindAutomaticType(struct xkb_context *ctx, GroupInfo *groupi)
     }
 
     return XKB_ATOM_NONE;
-
-#undef GET_SYM
 }
 
 static const struct xkb_key_type *
@@ -1356,7 +1355,24 @@ FindTypeForGroup(struct xkb_keymap *keymap, KeyInfo *keyi,
             type_name  = keyi->default_type;
         }
         else {
-            type_name = FindAutomaticType(keymap->ctx, groupi);
+            xkb_keysym_t syms[4];
+            xkb_level_index_t width = darray_size(groupi->levels);
+
+            for (xkb_level_index_t level = 0; level < 4; level++) {
+                const struct xkb_level *leveli;
+
+                syms[level] = XKB_KEY_NoSymbol;
+                if (level >= width)
+                    continue;
+
+                leveli = &darray_item(groupi->levels, level);
+                if (leveli->num_syms == 1)
+                    syms[level] = leveli->u.sym;
+                else if (leveli->num_syms > 1)
+                    syms[level] = leveli->u.syms[0];
+            }
+
+            type_name = FindAutomaticType(keymap->ctx, width, syms);
             if (type_name != XKB_ATOM_NONE)
                 *explicit_type = false;
         }
@@ -1570,7 +1586,7 @@ CopySymbolsToKeymap(struct xkb_keymap *keymap, SymbolsInfo *info)
 
 bool
 CompileSymbols(XkbFile *file, struct xkb_keymap *keymap,
-               enum merge_mode merge)
+               enum merge_mode merge, struct include_state *state)
 {
     SymbolsInfo info;
     ActionsInfo *actions;
@@ -1579,7 +1595,7 @@ CompileSymbols(XkbFile *file, struct xkb_keymap *keymap,
     if (!actions)
         return false;
 
-    InitSymbolsInfo(&info, keymap, actions, &keymap->mods);
+    InitSymbolsInfo(&info, keymap, state, actions, &keymap->mods);
     info.default_key.merge = merge;
 
     HandleSymbolsFile(&info, file, merge);
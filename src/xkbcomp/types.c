@@ -54,8 +54,10 @@ typedef struct {
 
     darray(KeyTypeInfo) types;
     struct xkb_mod_set mods;
+    unsigned int include_depth;
 
     struct xkb_context *ctx;
+    struct include_state *include_state;
 } KeyTypesInfo;
 
 /***====================================================================***/
@@ -98,10 +100,12 @@ ReportTypeBadType(KeyTypesInfo *info, KeyTypeInfo *type,
 
 static void
 InitKeyTypesInfo(KeyTypesInfo *info, struct xkb_context *ctx,
+                 struct include_state *include_state,
                  const struct xkb_mod_set *mods)
 {
     memset(info, 0, sizeof(*info));
     info->ctx = ctx;
+    info->include_state = include_state;
     info->mods = *mods;
 }
 
@@ -209,22 +213,26 @@ HandleIncludeKeyTypes(KeyTypesInfo *info, IncludeStmt *include)
 {
     KeyTypesInfo included;
 
-    InitKeyTypesInfo(&included, info->ctx, &info->mods);
-    included.name = include->stmt;
-    include->stmt = NULL;
+    InitKeyTypesInfo(&included, info->ctx, info->include_state,
+                     &info->mods);
+    included.name = strdup_safe(include->stmt);
 
     for (IncludeStmt *stmt = include; stmt; stmt = stmt->next_incl) {
         KeyTypesInfo next_incl;
         XkbFile *file;
 
-        file = ProcessIncludeFile(info->ctx, stmt, FILE_TYPE_TYPES);
+        file = ProcessIncludeFile(info->ctx, info->include_state, stmt,
+                                  FILE_TYPE_TYPES);
         if (!file) {
             info->errorCount += 10;
             ClearKeyTypesInfo(&included);
             return false;
         }
 
-        InitKeyTypesInfo(&next_incl, info->ctx, &included.mods);
+        InitKeyTypesInfo(&next_incl, info->ctx, info->include_state,
+                         &included.mods);
+        next_incl.include_depth = info->include_depth + 1;
+        stats_include_depth(info->ctx, next_incl.include_depth);
 
         HandleKeyTypesFile(&next_incl, file, stmt->merge);
 
@@ -721,11 +729,11 @@ CopyKeyTypesToKeymap(struct xkb_keymap *keymap, KeyTypesInfo *info)
 
 bool
 CompileKeyTypes(XkbFile *file, struct xkb_keymap *keymap,
-                enum merge_mode merge)
+                enum merge_mode merge, struct include_state *state)
 {
     KeyTypesInfo info;
 
-    InitKeyTypesInfo(&info, keymap->ctx, &keymap->mods);
+    InitKeyTypesInfo(&info, keymap->ctx, state, &keymap->mods);
 
     HandleKeyTypesFile(&info, file, merge);
     if (info.errorCount != 0)
@@ -28,17 +28,13 @@
 #define XKBCOMP_PRIV_H
 
 #include "keymap.h"
+#include "stats.h"
 #include "ast.h"
 
-struct xkb_component_names {
-    char *keycodes;
-    char *types;
-    char *compat;
-    char *symbols;
-};
-
-char *
-text_v1_keymap_get_as_string(struct xkb_keymap *keymap);
+bool
+text_v1_keymap_write(struct xkb_keymap *keymap,
+                     enum xkb_keymap_serialize_flags flags,
+                     xkb_keymap_write_fn write_fn, void *data);
 
 XkbFile *
 XkbParseFile(struct xkb_context *ctx, FILE *file,
@@ -56,25 +52,38 @@ XkbFile *
 XkbFileFromComponents(struct xkb_context *ctx,
                       const struct xkb_component_names *kkctgs);
 
+struct include_state;
+
 bool
 CompileKeycodes(XkbFile *file, struct xkb_keymap *keymap,
-                enum merge_mode merge);
+                enum merge_mode merge, struct include_state *state);
 
 bool
 CompileKeyTypes(XkbFile *file, struct xkb_keymap *keymap,
-                enum merge_mode merge);
+                enum merge_mode merge, struct include_state *state);
 
 bool
 CompileCompatMap(XkbFile *file, struct xkb_keymap *keymap,
-                 enum merge_mode merge);
+                 enum merge_mode merge, struct include_state *state);
 
 bool
 CompileSymbols(XkbFile *file, struct xkb_keymap *keymap,
-               enum merge_mode merge);
+               enum merge_mode merge, struct include_state *state);
 
 bool
 CompileKeymap(XkbFile *file, struct xkb_keymap *keymap,
-              enum merge_mode merge);
+              enum merge_mode merge, struct cache_deps *deps);
+
+xkb_atom_t
+FindAutomaticType(struct xkb_context *ctx, xkb_level_index_t width,
+                  const xkb_keysym_t *syms);
+
+bool
+UpdateDerivedKeymapFields(struct xkb_keymap *keymap);
+
+bool
+CompileCanonicalKeymap(struct xkb_keymap *keymap, const char *string,
+                       size_t len);
 
 /***====================================================================***/
 
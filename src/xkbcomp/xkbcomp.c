@@ -31,7 +31,8 @@
 #include "rules.h"
 
 static bool
-compile_keymap_file(struct xkb_keymap *keymap, XkbFile *file)
+compile_keymap_file(struct xkb_keymap *keymap, XkbFile *file,
+                    struct cache_deps *deps)
 {
     if (file->file_type != FILE_TYPE_KEYMAP) {
         log_err(keymap->ctx,
@@ -40,7 +41,7 @@ compile_keymap_file(struct xkb_keymap *keymap, XkbFile *file)
         return false;
     }
 
-    if (!CompileKeymap(file, keymap, MERGE_OVERRIDE)) {
+    if (!CompileKeymap(file, keymap, MERGE_OVERRIDE, deps)) {
         log_err(keymap->ctx,
                 "Failed to compile keymap\n");
         return false;
@@ -51,7 +52,8 @@ compile_keymap_file(struct xkb_keymap *keymap, XkbFile *file)
 
 static bool
 text_v1_keymap_new_from_names(struct xkb_keymap *keymap,
-                              const struct xkb_rule_names *rmlvo)
+                              const struct xkb_rule_names *rmlvo,
+                              struct cache_deps *deps)
 {
     bool ok;
     struct xkb_component_names kccgst;
@@ -63,7 +65,7 @@ text_v1_keymap_new_from_names(struct xkb_keymap *keymap,
             rmlvo->rules, rmlvo->model, rmlvo->layout, rmlvo->variant,
             rmlvo->options);
 
-    ok = xkb_components_from_rules(keymap->ctx, rmlvo, &kccgst);
+    ok = xkb_components_from_rules(keymap->ctx, rmlvo, &kccgst, deps);
     if (!ok) {
         log_err(keymap->ctx,
                 "Couldn't look up rules '%s', model '%s', layout '%s', "
@@ -91,7 +93,7 @@ text_v1_keymap_new_from_names(struct xkb_keymap *keymap,
         return false;
     }
 
-    ok = compile_keymap_file(keymap, file);
+    ok = compile_keymap_file(keymap, file, deps);
     FreeXkbFile(file);
     return ok;
 }
@@ -103,13 +105,17 @@ text_v1_keymap_new_from_string(struct xkb_keymap *keymap,
     bool ok;
     XkbFile *xkb_file;
 
+    /* Keymaps handed around by servers are mostly in canonical form. */
+    if (CompileCanonicalKeymap(keymap, string, len))
+        return true;
+
     xkb_file = XkbParseString(keymap->ctx, string, len, "(input string)", NULL);
     if (!xkb_file) {
         log_err(keymap->ctx, "Failed to parse input xkb string\n");
         return NULL;
     }
 
-    ok = compile_keymap_file(keymap, xkb_file);
+    ok = compile_keymap_file(keymap, xkb_file, NULL);
     FreeXkbFile(xkb_file);
     return ok;
 }
@@ -126,7 +132,7 @@ text_v1_keymap_new_from_file(struct xkb_keymap *keymap, FILE *file)
         return false;
     }
 
-    ok = compile_keymap_file(keymap, xkb_file);
+    ok = compile_keymap_file(keymap, xkb_file, NULL);
     FreeXkbFile(xkb_file);
     return ok;
 }
@@ -135,5 +141,5 @@ const struct xkb_keymap_format_ops text_v1_keymap_format_ops = {
     .keymap_new_from_names = text_v1_keymap_new_from_names,
     .keymap_new_from_string = text_v1_keymap_new_from_string,
     .keymap_new_from_file = text_v1_keymap_new_from_file,
-    .keymap_get_as_string = text_v1_keymap_get_as_string,
+    .keymap_write = text_v1_keymap_write,
 };
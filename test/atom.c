@@ -22,12 +22,15 @@
  */
 
 #include <time.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 #include "test.h"
 #include "atom.h"
 
 #define INTERN_LITERAL(table, literal) \
-    atom_intern(table, literal, sizeof(literal) - 1, false)
+    atom_intern(table, literal, sizeof(literal) - 1)
 
 #define LOOKUP_LITERAL(table, literal) \
     atom_lookup(table, literal, sizeof(literal) - 1)
@@ -105,7 +108,7 @@ test_random_strings(void)
             continue;
         }
 
-        arr[i].atom = atom_intern(table, arr[i].string, arr[i].len, false);
+        arr[i].atom = atom_intern(table, arr[i].string, arr[i].len);
         if (arr[i].atom == XKB_ATOM_NONE) {
             fprintf(stderr, "failed to intern! len: %lu, string: %.*s\n",
                     arr[i].len, (int) arr[i].len, arr[i].string);
@@ -144,6 +147,97 @@ test_random_strings(void)
     atom_table_free(table);
 }
 
+/* More atoms than the table had room for when its size was fixed. */
+static void
+test_many_atoms(void)
+{
+    struct atom_table *table;
+    const unsigned int n = 1 << 21;
+    char buf[32];
+    xkb_atom_t atom;
+
+    table = atom_table_new();
+    assert(table);
+
+    for (unsigned int i = 0; i < n; i++) {
+        snprintf(buf, sizeof(buf), "atom %u", i);
+        atom = atom_intern(table, buf, strlen(buf));
+        assert(atom == i + 1);
+    }
+    assert(atom_table_size(table) == n);
+
+    for (unsigned int i = 0; i < n; i += 997) {
+        snprintf(buf, sizeof(buf), "atom %u", i);
+        assert(atom_lookup(table, buf, strlen(buf)) == i + 1);
+        assert(streq(atom_text(table, i + 1), buf));
+    }
+    assert(atom_text(table, n + 1) == NULL);
+
+    atom_table_free(table);
+}
+
+#ifdef HAVE_PTHREAD
+#define NUM_THREADS 4
+#define NUM_THREAD_STRINGS 20000
+
+struct thread_data {
+    struct atom_table *table;
+    int offset;
+    xkb_atom_t atoms[NUM_THREAD_STRINGS];
+};
+
+static void *
+intern_thread(void *data)
+{
+    struct thread_data *td = data;
+    char buf[32];
+
+    /* Each thread starts at a different string, so they race on all. */
+    for (int j = 0; j < NUM_THREAD_STRINGS; j++) {
+        int i = (j + td->offset) % NUM_THREAD_STRINGS;
+
+        snprintf(buf, sizeof(buf), "string %d", i);
+        td->atoms[i] = atom_intern(td->table, buf, strlen(buf));
+        assert(td->atoms[i] != XKB_ATOM_NONE);
+        assert(streq(atom_text(td->table, td->atoms[i]), buf));
+    }
+
+    return NULL;
+}
+
+static void
+test_threads(void)
+{
+    struct atom_table *table;
+    struct thread_data *td;
+    pthread_t threads[NUM_THREADS];
+    char buf[32];
+
+    table = atom_table_new();
+    assert(table);
+    td = calloc(NUM_THREADS, sizeof(*td));
+    assert(td);
+
+    for (int t = 0; t < NUM_THREADS; t++) {
+        td[t].table = table;
+        td[t].offset = t * NUM_THREAD_STRINGS / NUM_THREADS;
+        assert(pthread_create(&threads[t], NULL, intern_thread, &td[t]) == 0);
+    }
+    for (int t = 0; t < NUM_THREADS; t++)
+        assert(pthread_join(threads[t], NULL) == 0);
+
+    for (int i = 0; i < NUM_THREAD_STRINGS; i++) {
+        snprintf(buf, sizeof(buf), "string %d", i);
+        assert(atom_lookup(table, buf, strlen(buf)) == td[0].atoms[i]);
+        for (int t = 1; t < NUM_THREADS; t++)
+            assert(td[t].atoms[i] == td[0].atoms[i]);
+    }
+
+    free(td);
+    atom_table_free(table);
+}
+#endif
+
 int
 main(void)
 {
@@ -161,7 +255,7 @@ main(void)
     assert(atom1 == LOOKUP_LITERAL(table, "hello"));
     assert(streq(atom_text(table, atom1), "hello"));
 
-    atom2 = atom_intern(table, "hello", 3, false);
+    atom2 = atom_intern(table, "hello", 3);
     assert(atom2 != XKB_ATOM_NONE);
     assert(atom1 != atom2);
     assert(streq(atom_text(table, atom2), "hel"));
@@ -169,13 +263,18 @@ main(void)
     assert(LOOKUP_LITERAL(table, "hell") == XKB_ATOM_NONE);
     assert(LOOKUP_LITERAL(table, "hello") == atom1);
 
-    atom3 = atom_intern(table, "", 0, false);
+    atom3 = atom_intern(table, "", 0);
     assert(atom3 != XKB_ATOM_NONE);
     assert(LOOKUP_LITERAL(table, "") == atom3);
 
     atom_table_free(table);
 
     test_random_strings();
+    test_many_atoms();
+
+#ifdef HAVE_PTHREAD
+    test_threads();
+#endif
 
     return 0;
 }
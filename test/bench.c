@@ -0,0 +1,705 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Benchmarks of the operations done by compositors and clients.
+ *
+ * Each benchmark runs some warm-up samples, which are not recorded, and
+ * then a number of timed samples.  A sample is a batch of operations, so
+ * that cheap operations are not dominated by reading the clock; the
+ * reported latencies are per operation.  The key processing benchmarks
+ * replay a trace of typing some text, switching layouts now and then.
+ *
+ * With -j, one JSON object is printed per benchmark, to keep track of
+ * regressions.  With -s, the number of samples is scaled.  Any other
+ * arguments select the benchmarks whose names contain them.
+ */
+
+#include <time.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "evdev-scancodes.h"
+
+#define WARMUP_DIVISOR 10
+
+static const char text[] =
+    "The quick brown fox jumps over the lazy dog. "
+    "Pack my box with five dozen liquor jugs!\n"
+    "She sells sea shells by the sea shore; "
+    "the shells she sells are surely seashells.\n"
+    "How vexingly quick daft zebras jump, said Jim (aged 42).\n"
+    "Sphinx of black quartz, judge my vow: 1234567890 = \"done\"?\n";
+
+/* How many characters are typed between layout switches. */
+#define LAYOUT_SWITCH_INTERVAL 97
+
+struct trace_event {
+    xkb_keycode_t keycode;
+    enum xkb_key_direction direction;
+};
+
+struct key_for_char {
+    xkb_keycode_t keycode;
+    bool shift;
+};
+
+struct bench_data {
+    struct xkb_context *ctx;
+    struct xkb_rule_names rmlvo;
+    struct xkb_keymap *keymap;
+    char *keymap_string;
+    FILE *keymap_file;
+
+    /* The server state, and a client mirroring it with update_mask. */
+    struct xkb_state *state;
+    struct xkb_state *client;
+
+    struct trace_event *trace;
+    size_t trace_len;
+    size_t trace_pos;
+
+    /* The keycodes pressed in the trace, for the key queries. */
+    xkb_keycode_t *presses;
+    size_t num_presses;
+    size_t press_pos;
+
+    xkb_keysym_t *keysyms;
+    char (*names)[64];
+    size_t num_keysyms;
+    size_t keysym_pos;
+};
+
+struct bench {
+    const char *name;
+    /* Runs one operation. */
+    void (*run)(struct bench_data *data);
+    /* Runs between samples, without being timed. */
+    void (*step)(struct bench_data *data);
+    unsigned int batch;
+    unsigned int samples;
+};
+
+static uint64_t
+now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+/***====================================================================***/
+
+static void
+trace_append(struct bench_data *data, size_t *alloc,
+             xkb_keycode_t keycode, enum xkb_key_direction direction)
+{
+    if (data->trace_len >= *alloc) {
+        *alloc = *alloc ? *alloc * 2 : 256;
+        data->trace = realloc(data->trace, *alloc * sizeof(*data->trace));
+        assert(data->trace);
+    }
+
+    data->trace[data->trace_len].keycode = keycode;
+    data->trace[data->trace_len].direction = direction;
+    data->trace_len++;
+}
+
+static void
+trace_tap(struct bench_data *data, size_t *alloc, xkb_keycode_t keycode)
+{
+    trace_append(data, alloc, keycode, XKB_KEY_DOWN);
+    trace_append(data, alloc, keycode, XKB_KEY_UP);
+}
+
+/* Find the keys which type the ASCII characters on each layout. */
+static void
+map_chars(struct xkb_keymap *keymap, xkb_layout_index_t layout,
+          struct key_for_char *map)
+{
+    xkb_keycode_t kc;
+    xkb_level_index_t level;
+    const xkb_keysym_t *syms;
+    uint32_t cp;
+
+    for (kc = xkb_keymap_min_keycode(keymap);
+         kc <= xkb_keymap_max_keycode(keymap); kc++) {
+        for (level = 0; level < 2; level++) {
+            if (xkb_keymap_key_get_syms_by_level(keymap, kc, layout,
+                                                 level, &syms) != 1)
+                continue;
+
+            cp = xkb_keysym_to_utf32(syms[0]);
+            if (cp == 0 || cp >= 128 || map[cp].keycode != 0)
+                continue;
+
+            map[cp].keycode = kc;
+            map[cp].shift = (level == 1);
+        }
+    }
+}
+
+static void
+make_trace(struct bench_data *data)
+{
+    const xkb_keycode_t shift = KEY_LEFTSHIFT + EVDEV_OFFSET;
+    const xkb_keycode_t alt = KEY_LEFTALT + EVDEV_OFFSET;
+    struct key_for_char map[2][128];
+    xkb_layout_index_t layout = 0;
+    size_t alloc = 0, i, presses_alloc = 0;
+
+    memset(map, 0, sizeof(map));
+    map_chars(data->keymap, 0, map[0]);
+    map_chars(data->keymap, 1, map[1]);
+    map[0]['\n'].keycode = map[1]['\n'].keycode = KEY_ENTER + EVDEV_OFFSET;
+
+    for (i = 0; text[i]; i++) {
+        const struct key_for_char *key = &map[layout][(unsigned char) text[i]];
+
+        /* grp:alt_shift_toggle */
+        if (i % LAYOUT_SWITCH_INTERVAL == LAYOUT_SWITCH_INTERVAL - 1) {
+            trace_append(data, &alloc, alt, XKB_KEY_DOWN);
+            trace_tap(data, &alloc, shift);
+            trace_append(data, &alloc, alt, XKB_KEY_UP);
+            layout = !layout;
+        }
+
+        if (key->keycode == 0)
+            continue;
+
+        if (key->shift)
+            trace_append(data, &alloc, shift, XKB_KEY_DOWN);
+        trace_tap(data, &alloc, key->keycode);
+        if (key->shift)
+            trace_append(data, &alloc, shift, XKB_KEY_UP);
+
+        if (data->num_presses >= presses_alloc) {
+            presses_alloc = presses_alloc ? presses_alloc * 2 : 256;
+            data->presses = realloc(data->presses,
+                                    presses_alloc * sizeof(*data->presses));
+            assert(data->presses);
+        }
+        data->presses[data->num_presses++] = key->keycode;
+    }
+
+    assert(data->num_presses > 0);
+}
+
+static void
+collect_keysyms(struct bench_data *data)
+{
+    struct xkb_keymap *keymap = data->keymap;
+    size_t alloc = 0;
+    xkb_keycode_t kc;
+    xkb_layout_index_t layout;
+    xkb_level_index_t level;
+    const xkb_keysym_t *syms;
+    int num_syms, i;
+
+    for (kc = xkb_keymap_min_keycode(keymap);
+         kc <= xkb_keymap_max_keycode(keymap); kc++) {
+        for (layout = 0;
+             layout < xkb_keymap_num_layouts_for_key(keymap, kc); layout++) {
+            for (level = 0;
+                 level < xkb_keymap_num_levels_for_key(keymap, kc, layout);
+                 level++) {
+                num_syms = xkb_keymap_key_get_syms_by_level(keymap, kc,
+                                                            layout, level,
+                                                            &syms);
+                for (i = 0; i < num_syms; i++) {
+                    if (data->num_keysyms >= alloc) {
+                        alloc = alloc ? alloc * 2 : 256;
+                        data->keysyms = realloc(data->keysyms,
+                                                alloc * sizeof(*data->keysyms));
+                        data->names = realloc(data->names,
+                                              alloc * sizeof(*data->names));
+                        assert(data->keysyms && data->names);
+                    }
+                    data->keysyms[data->num_keysyms] = syms[i];
+                    xkb_keysym_get_name(syms[i], data->names[data->num_keysyms],
+                                        sizeof(*data->names));
+                    data->num_keysyms++;
+                }
+            }
+        }
+    }
+
+    assert(data->num_keysyms > 0);
+}
+
+/***====================================================================***/
+
+static void
+bench_compile_names(struct bench_data *data)
+{
+    struct xkb_keymap *keymap;
+
+    keymap = xkb_keymap_new_from_names(data->ctx, &data->rmlvo, 0);
+    assert(keymap);
+    xkb_keymap_unref(keymap);
+}
+
+static void
+bench_compile_string(struct bench_data *data)
+{
+    struct xkb_keymap *keymap;
+
+    keymap = xkb_keymap_new_from_string(data->ctx, data->keymap_string,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    assert(keymap);
+    xkb_keymap_unref(keymap);
+}
+
+static void
+bench_compile_file(struct bench_data *data)
+{
+    struct xkb_keymap *keymap;
+
+    rewind(data->keymap_file);
+    keymap = xkb_keymap_new_from_file(data->ctx, data->keymap_file,
+                                      XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    assert(keymap);
+    xkb_keymap_unref(keymap);
+}
+
+static void
+bench_resolve_rules(struct bench_data *data)
+{
+    struct xkb_component_names kccgst;
+    size_t resolved;
+
+    resolved = xkb_context_resolve_rule_names(data->ctx, &data->rmlvo, 1,
+                                              &kccgst);
+    assert(resolved == 1);
+    xkb_component_names_clear(&kccgst, 1);
+}
+
+static void
+bench_get_as_string(struct bench_data *data)
+{
+    char *string;
+
+    string = xkb_keymap_get_as_string(data->keymap,
+                                      XKB_KEYMAP_FORMAT_TEXT_V1);
+    assert(string);
+    free(string);
+}
+
+static const struct trace_event *
+next_event(struct bench_data *data)
+{
+    const struct trace_event *event = &data->trace[data->trace_pos];
+
+    data->trace_pos = (data->trace_pos + 1) % data->trace_len;
+    return event;
+}
+
+static xkb_keycode_t
+next_press(struct bench_data *data)
+{
+    xkb_keycode_t keycode = data->presses[data->press_pos];
+
+    data->press_pos = (data->press_pos + 1) % data->num_presses;
+    return keycode;
+}
+
+static void
+step_trace(struct bench_data *data)
+{
+    const struct trace_event *event = next_event(data);
+
+    xkb_state_update_key(data->state, event->keycode, event->direction);
+}
+
+static void
+bench_update_key(struct bench_data *data)
+{
+    step_trace(data);
+}
+
+static void
+bench_update_mask(struct bench_data *data)
+{
+    const struct trace_event *event = next_event(data);
+    enum xkb_state_component changed;
+
+    changed = xkb_state_update_key(data->state, event->keycode,
+                                   event->direction);
+    if (changed == 0)
+        return;
+
+    xkb_state_update_mask(
+        data->client,
+        xkb_state_serialize_mods(data->state, XKB_STATE_MODS_DEPRESSED),
+        xkb_state_serialize_mods(data->state, XKB_STATE_MODS_LATCHED),
+        xkb_state_serialize_mods(data->state, XKB_STATE_MODS_LOCKED),
+        xkb_state_serialize_layout(data->state, XKB_STATE_LAYOUT_DEPRESSED),
+        xkb_state_serialize_layout(data->state, XKB_STATE_LAYOUT_LATCHED),
+        xkb_state_serialize_layout(data->state, XKB_STATE_LAYOUT_LOCKED));
+}
+
+static void
+bench_key_get_utf8(struct bench_data *data)
+{
+    char buf[64];
+
+    xkb_state_key_get_utf8(data->state, next_press(data), buf, sizeof(buf));
+}
+
+static void
+bench_key_get_syms(struct bench_data *data)
+{
+    const xkb_keysym_t *syms;
+
+    xkb_state_key_get_syms(data->state, next_press(data), &syms);
+}
+
+static void
+bench_consumed_mods(struct bench_data *data)
+{
+    xkb_keycode_t keycode = next_press(data);
+    xkb_mod_mask_t consumed;
+
+    consumed = xkb_state_key_get_consumed_mods(data->state, keycode);
+    (void) consumed;
+}
+
+static void
+bench_led_mod_query(struct bench_data *data)
+{
+    xkb_mod_index_t mod;
+    xkb_led_index_t led;
+    int active = 0;
+
+    for (mod = 0; mod < xkb_keymap_num_mods(data->keymap); mod++)
+        active += xkb_state_mod_index_is_active(data->state, mod,
+                                                XKB_STATE_MODS_EFFECTIVE);
+    for (led = 0; led < xkb_keymap_num_leds(data->keymap); led++)
+        active += xkb_state_led_index_is_active(data->state, led);
+    (void) active;
+}
+
+static const char *
+next_name(struct bench_data *data, xkb_keysym_t *keysym)
+{
+    size_t pos = data->keysym_pos;
+
+    data->keysym_pos = (pos + 1) % data->num_keysyms;
+    if (keysym)
+        *keysym = data->keysyms[pos];
+    return data->names[pos];
+}
+
+static void
+bench_keysym_get_name(struct bench_data *data)
+{
+    xkb_keysym_t keysym;
+    char buf[64];
+
+    next_name(data, &keysym);
+    xkb_keysym_get_name(keysym, buf, sizeof(buf));
+}
+
+static void
+bench_keysym_from_name(struct bench_data *data)
+{
+    xkb_keysym_t keysym;
+
+    keysym = xkb_keysym_from_name(next_name(data, NULL), XKB_KEYSYM_NO_FLAGS);
+    assert(keysym != XKB_KEY_NoSymbol);
+}
+
+static void
+bench_keysym_from_name_icase(struct bench_data *data)
+{
+    xkb_keysym_t keysym;
+
+    keysym = xkb_keysym_from_name(next_name(data, NULL),
+                                  XKB_KEYSYM_CASE_INSENSITIVE);
+    assert(keysym != XKB_KEY_NoSymbol);
+}
+
+static void
+bench_keysym_to_utf8(struct bench_data *data)
+{
+    xkb_keysym_t keysym;
+    char buf[8];
+
+    next_name(data, &keysym);
+    xkb_keysym_to_utf8(keysym, buf, sizeof(buf));
+}
+
+static void
+bench_keysym_to_utf32(struct bench_data *data)
+{
+    xkb_keysym_t keysym;
+    uint32_t cp;
+
+    next_name(data, &keysym);
+    cp = xkb_keysym_to_utf32(keysym);
+    (void) cp;
+}
+
+static const struct bench benches[] = {
+    { "compile-names", bench_compile_names, NULL, 1, 40 },
+    { "compile-string", bench_compile_string, NULL, 1, 200 },
+    { "compile-file", bench_compile_file, NULL, 1, 200 },
+    { "resolve-rules", bench_resolve_rules, NULL, 1, 500 },
+    { "get-as-string", bench_get_as_string, NULL, 1, 500 },
+    { "update-key", bench_update_key, NULL, 64, 5000 },
+    { "update-mask", bench_update_mask, NULL, 64, 5000 },
+    { "key-get-syms", bench_key_get_syms, step_trace, 64, 5000 },
+    { "key-get-utf8", bench_key_get_utf8, step_trace, 64, 5000 },
+    { "consumed-mods", bench_consumed_mods, step_trace, 64, 5000 },
+    { "led-mod-query", bench_led_mod_query, step_trace, 16, 5000 },
+    { "keysym-get-name", bench_keysym_get_name, NULL, 64, 5000 },
+    { "keysym-from-name", bench_keysym_from_name, NULL, 64, 5000 },
+    { "keysym-from-name-icase", bench_keysym_from_name_icase, NULL, 64, 2000 },
+    { "keysym-to-utf8", bench_keysym_to_utf8, NULL, 64, 5000 },
+    { "keysym-to-utf32", bench_keysym_to_utf32, NULL, 64, 5000 },
+};
+
+/***====================================================================***/
+
+struct result {
+    unsigned int ops;
+    double min, p50, p90, p99, max, mean;
+    /* Per operation, from the context statistics. */
+    double files_parsed, parse_bytes;
+};
+
+static int
+compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of sorted samples. */
+static double
+percentile(const double *sorted, unsigned int n, unsigned int p)
+{
+    unsigned int rank = (p * n + 99) / 100;
+
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static void
+run_bench(struct bench_data *data, const struct bench *bench,
+          double scale, struct result *result)
+{
+    unsigned int samples = MAX(1, (unsigned int) (bench->samples * scale));
+    unsigned int warmup = MAX(1, samples / WARMUP_DIVISOR);
+    unsigned int i, j;
+    struct xkb_context_stats stats;
+    double *times, sum = 0;
+    uint64_t start;
+
+    times = calloc(samples, sizeof(*times));
+    assert(times);
+
+    for (i = 0; i < warmup; i++) {
+        if (bench->step)
+            bench->step(data);
+        for (j = 0; j < bench->batch; j++)
+            bench->run(data);
+    }
+
+    xkb_context_reset_stats(data->ctx);
+
+    for (i = 0; i < samples; i++) {
+        if (bench->step)
+            bench->step(data);
+
+        start = now();
+        for (j = 0; j < bench->batch; j++)
+            bench->run(data);
+        times[i] = (double) (now() - start) / bench->batch;
+        sum += times[i];
+    }
+
+    qsort(times, samples, sizeof(*times), compare_double);
+
+    result->ops = samples * bench->batch;
+    result->min = times[0];
+    result->p50 = percentile(times, samples, 50);
+    result->p90 = percentile(times, samples, 90);
+    result->p99 = percentile(times, samples, 99);
+    result->max = times[samples - 1];
+    result->mean = sum / samples;
+
+    xkb_context_get_stats(data->ctx, &stats);
+    result->files_parsed = (double) stats.files_parsed / result->ops;
+    result->parse_bytes = (double) stats.parse_bytes / result->ops;
+
+    free(times);
+}
+
+static const char *
+format_time(double ns, char *buf, size_t size)
+{
+    if (ns < 1e3)
+        snprintf(buf, size, "%.1fns", ns);
+    else if (ns < 1e6)
+        snprintf(buf, size, "%.2fus", ns / 1e3);
+    else
+        snprintf(buf, size, "%.2fms", ns / 1e6);
+    return buf;
+}
+
+static void
+print_result(const struct bench *bench, const struct result *result,
+             bool json)
+{
+    char b[6][16];
+
+    if (json) {
+        printf("{\"name\": \"%s\", \"ops\": %u, \"batch\": %u, "
+               "\"min_ns\": %.1f, \"p50_ns\": %.1f, \"p90_ns\": %.1f, "
+               "\"p99_ns\": %.1f, \"max_ns\": %.1f, \"mean_ns\": %.1f, "
+               "\"files_parsed\": %.1f, \"parse_bytes\": %.0f}\n",
+               bench->name, result->ops, bench->batch,
+               result->min, result->p50, result->p90,
+               result->p99, result->max, result->mean,
+               result->files_parsed, result->parse_bytes);
+        return;
+    }
+
+    printf("%-24s %9u %10s %10s %10s %10s %10s",
+           bench->name, result->ops,
+           format_time(result->min, b[0], sizeof(b[0])),
+           format_time(result->p50, b[1], sizeof(b[1])),
+           format_time(result->p90, b[2], sizeof(b[2])),
+           format_time(result->p99, b[3], sizeof(b[3])),
+           format_time(result->max, b[4], sizeof(b[4])));
+    if (result->files_parsed > 0)
+        printf("  %.1f files, %.0f AST bytes",
+               result->files_parsed, result->parse_bytes);
+    printf("\n");
+}
+
+static bool
+selected(const struct bench *bench, int argc, char *argv[])
+{
+    int i;
+
+    if (argc == 0)
+        return true;
+
+    for (i = 0; i < argc; i++)
+        if (strstr(bench->name, argv[i]))
+            return true;
+
+    return false;
+}
+
+int
+main(int argc, char *argv[])
+{
+    struct bench_data data;
+    struct result result;
+    bool json = false;
+    double scale = 1.0;
+    char *path;
+    size_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "js:h")) != -1) {
+        switch (opt) {
+        case 'j':
+            json = true;
+            break;
+        case 's':
+            scale = atof(optarg);
+            if (scale > 0)
+                break;
+            /* fallthrough */
+        case 'h':
+        case '?':
+            fprintf(stderr, "Usage: %s [-j] [-s <scale>] [<benchmark>...]\n",
+                    argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    memset(&data, 0, sizeof(data));
+
+    data.ctx = test_get_context(0);
+    assert(data.ctx);
+    xkb_context_set_log_level(data.ctx, XKB_LOG_LEVEL_CRITICAL);
+    xkb_context_set_log_verbosity(data.ctx, 0);
+    assert(xkb_context_set_stats_enabled(data.ctx, 1));
+
+    data.rmlvo.rules = "evdev";
+    data.rmlvo.model = "pc105";
+    data.rmlvo.layout = "us,de";
+    data.rmlvo.variant = ",nodeadkeys";
+    data.rmlvo.options = "grp:alt_shift_toggle,ctrl:nocaps";
+
+    data.keymap = xkb_keymap_new_from_names(data.ctx, &data.rmlvo, 0);
+    assert(data.keymap);
+    data.keymap_string = xkb_keymap_get_as_string(data.keymap,
+                                                  XKB_KEYMAP_FORMAT_TEXT_V1);
+    assert(data.keymap_string);
+
+    path = test_get_path("keymaps/stringcomp.data");
+    assert(path);
+    data.keymap_file = fopen(path, "r");
+    assert(data.keymap_file);
+    free(path);
+
+    data.state = xkb_state_new(data.keymap);
+    data.client = xkb_state_new(data.keymap);
+    assert(data.state && data.client);
+
+    make_trace(&data);
+    collect_keysyms(&data);
+
+    if (!json)
+        printf("%-24s %9s %10s %10s %10s %10s %10s\n",
+               "benchmark", "ops", "min", "p50", "p90", "p99", "max");
+
+    for (i = 0; i < ARRAY_SIZE(benches); i++) {
+        if (!selected(&benches[i], argc - optind, argv + optind))
+            continue;
+
+        run_bench(&data, &benches[i], scale, &result);
+        print_result(&benches[i], &result, json);
+        fflush(stdout);
+    }
+
+    free(data.trace);
+    free(data.presses);
+    free(data.keysyms);
+    free(data.names);
+    xkb_state_unref(data.client);
+    xkb_state_unref(data.state);
+    fclose(data.keymap_file);
+    free(data.keymap_string);
+    xkb_keymap_unref(data.keymap);
+    xkb_context_unref(data.ctx);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright © 2014 The libxkbcommon authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "keymap.h"
+#include "keymap-cache.h"
+
+static int cache_hits;
+
+static void
+log_fn(struct xkb_context *ctx, enum xkb_log_level level,
+       const char *fmt, va_list args)
+{
+    if (strstr(fmt, "Loaded keymap from cache"))
+        cache_hits++;
+}
+
+static int
+foreach_entry(const char *dir, void (*fn)(const char *path))
+{
+    DIR *d = opendir(dir);
+    struct dirent *ent;
+    int count = 0;
+
+    assert(d);
+    while ((ent = readdir(d))) {
+        char *path;
+
+        if (ent->d_name[0] == '.')
+            continue;
+
+        assert(asprintf(&path, "%s/%s", dir, ent->d_name) > 0);
+        if (fn)
+            fn(path);
+        free(path);
+        count++;
+    }
+    closedir(d);
+
+    return count;
+}
+
+static void
+corrupt_entry(const char *path)
+{
+    assert(truncate(path, 100) == 0);
+}
+
+static void
+remove_entry(const char *path)
+{
+    assert(unlink(path) == 0);
+}
+
+static char *entry_path;
+
+static void
+find_entry(const char *path)
+{
+    free(entry_path);
+    entry_path = strdup(path);
+}
+
+static void
+write_entry(const char *data, size_t len)
+{
+    FILE *file = fopen(entry_path, "wb");
+
+    assert(file);
+    assert(fwrite(data, 1, len, file) == len);
+    assert(fclose(file) == 0);
+}
+
+/* Load the damaged entry; anything it yields must be safe to use. */
+static bool
+load_entry(struct xkb_context *ctx, const struct xkb_rule_names *rmlvo,
+           const char *data, size_t len)
+{
+    struct xkb_keymap *keymap;
+    struct xkb_state *state;
+    xkb_keycode_t kc;
+    char *str;
+
+    write_entry(data, len);
+    keymap = keymap_cache_load(ctx, rmlvo, XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    if (!keymap)
+        return false;
+
+    str = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    free(str);
+
+    state = xkb_state_new(keymap);
+    assert(state);
+    for (kc = xkb_keymap_min_keycode(keymap);
+         kc <= xkb_keymap_max_keycode(keymap); kc++) {
+        const xkb_keysym_t *syms;
+
+        xkb_state_update_key(state, kc, XKB_KEY_DOWN);
+        xkb_state_key_get_syms(state, kc, &syms);
+        xkb_state_key_get_utf8(state, kc, NULL, 0);
+        xkb_state_update_key(state, kc, XKB_KEY_UP);
+    }
+    xkb_state_unref(state);
+    xkb_keymap_unref(keymap);
+
+    return true;
+}
+
+/*
+ * Truncated and bit-flipped entries must be rejected; flips which keep
+ * the checksum valid may only yield keymaps which are safe to use.
+ */
+static void
+test_damaged_entry(struct xkb_context *ctx, const char *cache_dir)
+{
+    struct xkb_rule_names rmlvo = {
+        .rules = "evdev", .model = "pc105", .layout = "us,ru",
+    };
+    FILE *file;
+    struct stat stat_buf;
+    char *original, *data;
+    size_t len, step;
+    uint64_t checksum;
+
+    assert(foreach_entry(cache_dir, find_entry) == 1);
+    assert(stat(entry_path, &stat_buf) == 0);
+    len = stat_buf.st_size;
+    original = malloc(len);
+    data = malloc(len);
+    assert(original && data);
+    file = fopen(entry_path, "rb");
+    assert(file);
+    assert(fread(original, 1, len, file) == len);
+    fclose(file);
+
+    xkb_context_sanitize_rule_names(ctx, &rmlvo);
+    assert(load_entry(ctx, &rmlvo, original, len));
+
+    step = len / 256 + 1;
+    for (size_t i = 0; i < len; i += (i < 64 ? 1 : step))
+        assert(!load_entry(ctx, &rmlvo, original, i));
+
+    for (size_t i = 0; i < len * 8; i += step + 1) {
+        memcpy(data, original, len);
+        data[i / 8] ^= 1 << (i % 8);
+        assert(!load_entry(ctx, &rmlvo, data, len));
+
+        checksum = keymap_cache_checksum(data, len - sizeof(checksum));
+        memcpy(data + len - sizeof(checksum), &checksum, sizeof(checksum));
+        load_entry(ctx, &rmlvo, data, len);
+    }
+
+    write_entry(original, len);
+    free(original);
+    free(data);
+    free(entry_path);
+    entry_path = NULL;
+}
+
+static char *
+compile_to_string(struct xkb_context *ctx, const char *layout)
+{
+    struct xkb_keymap *keymap;
+    char *str;
+
+    keymap = test_compile_rules(ctx, "evdev", "pc105", layout, NULL, NULL);
+    assert(keymap);
+    str = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(str);
+    xkb_keymap_unref(keymap);
+    return str;
+}
+
+int
+main(void)
+{
+    char cache_dir[] = "/tmp/xkbcommon-cache-test.XXXXXX";
+    char include_dir[] = "/tmp/xkbcommon-include-test.XXXXXX";
+    char *include_symbols, *us_path, *data_path;
+    char *original, *str;
+    struct xkb_context *ctx;
+    struct xkb_keymap *keymap;
+    FILE *file;
+    const struct xkb_rule_names parallel_rmlvo = {
+        .rules = "evdev", .model = "pc105", .layout = "us,ru",
+    };
+
+    assert(mkdtemp(cache_dir));
+    assert(mkdtemp(include_dir));
+    assert(asprintf(&include_symbols, "%s/symbols", include_dir) > 0);
+    assert(mkdir(include_symbols, 0700) == 0);
+    assert(asprintf(&us_path, "%s/us", include_symbols) > 0);
+
+    ctx = xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                          XKB_CONTEXT_NO_ENVIRONMENT_NAMES);
+    assert(ctx);
+    xkb_context_set_log_level(ctx, XKB_LOG_LEVEL_DEBUG);
+    xkb_context_set_log_fn(ctx, log_fn);
+    assert(xkb_context_include_path_append(ctx, include_dir));
+    data_path = test_get_path("");
+    assert(xkb_context_include_path_append(ctx, data_path));
+    free(data_path);
+
+    assert(xkb_context_get_cache_path(ctx) == NULL);
+    assert(!xkb_context_set_cache_path(ctx, "/nonexistent/xkb/cache"));
+    assert(xkb_context_set_cache_path(ctx, cache_dir));
+    assert(streq(xkb_context_get_cache_path(ctx), cache_dir));
+
+    /* First compilation stores an entry. */
+    original = compile_to_string(ctx, "us,ru");
+    assert(cache_hits == 0);
+    assert(foreach_entry(cache_dir, NULL) == 1);
+
+    /* Second one is loaded from it, and is identical. */
+    str = compile_to_string(ctx, "us,ru");
+    assert(cache_hits == 1);
+    assert(streq(str, original));
+    free(str);
+
+    /* A different layout doesn't use it. */
+    str = compile_to_string(ctx, "us");
+    assert(cache_hits == 1);
+    assert(!streq(str, original));
+    free(str);
+    assert(foreach_entry(cache_dir, NULL) == 2);
+
+    /* A corrupt entry is ignored and replaced. */
+    foreach_entry(cache_dir, corrupt_entry);
+    str = compile_to_string(ctx, "us,ru");
+    assert(cache_hits == 1);
+    assert(streq(str, original));
+    free(str);
+    str = compile_to_string(ctx, "us,ru");
+    assert(cache_hits == 2);
+    assert(streq(str, original));
+    free(str);
+
+    /* Compiling in parallel uses the same entries. */
+    for (int i = 0; i < 2; i++) {
+        keymap = xkb_keymap_new_from_names(ctx, &parallel_rmlvo,
+                                           XKB_KEYMAP_COMPILE_PARALLEL);
+        assert(keymap);
+        assert(cache_hits == 3 + i);
+        str = xkb_keymap_get_as_string(keymap,
+                                       XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+        assert(str && streq(str, original));
+        free(str);
+        xkb_keymap_unref(keymap);
+    }
+    assert(foreach_entry(cache_dir, NULL) == 2);
+
+    /* Replace the entry of "us", which was corrupted above. */
+    str = compile_to_string(ctx, "us");
+    assert(cache_hits == 4);
+    free(str);
+
+    /*
+     * A file added earlier in the include path invalidates the entry,
+     * even though it wasn't read when the entry was written.  The
+     * include path directories are then read again too.
+     */
+    file = fopen(us_path, "w");
+    assert(file);
+    fprintf(file,
+            "default xkb_symbols \"basic\" {\n"
+            "    name[Group1] = \"Cached\";\n"
+            "    key <AE01> { [ 1, exclam ] };\n"
+            "};\n");
+    fclose(file);
+    keymap = test_compile_rules(ctx, "evdev", "pc105", "us", NULL, NULL);
+    assert(keymap);
+    assert(cache_hits == 4);
+    assert(streq(xkb_keymap_layout_get_name(keymap, 0), "Cached"));
+    xkb_keymap_unref(keymap);
+
+    /* And so does a change to a file which was read. */
+    file = fopen(us_path, "a");
+    assert(file);
+    fprintf(file, "// Changed.\n");
+    fclose(file);
+    keymap = test_compile_rules(ctx, "evdev", "pc105", "us", NULL, NULL);
+    assert(keymap);
+    assert(cache_hits == 4);
+    xkb_keymap_unref(keymap);
+    keymap = test_compile_rules(ctx, "evdev", "pc105", "us", NULL, NULL);
+    assert(keymap);
+    assert(cache_hits == 5);
+    assert(streq(xkb_keymap_layout_get_name(keymap, 0), "Cached"));
+    xkb_keymap_unref(keymap);
+
+    foreach_entry(cache_dir, remove_entry);
+    free(compile_to_string(ctx, "us,ru"));
+    test_damaged_entry(ctx, cache_dir);
+
+    xkb_context_unref(ctx);
+    free(original);
+
+    foreach_entry(cache_dir, remove_entry);
+    rmdir(cache_dir);
+    unlink(us_path);
+    rmdir(include_symbols);
+    rmdir(include_dir);
+    free(us_path);
+    free(include_symbols);
+
+    return 0;
+}
@@ -23,8 +23,285 @@
  * Author: Daniel Stone <daniel@fooishbar.org>
  */
 
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "test.h"
 #include "context.h"
+#include "xkbcomp-priv.h"
+#include "include.h"
+#include "evdev-scancodes.h"
+
+struct stats_calls {
+    int count;
+    struct xkb_context_stats last;
+};
+
+static void
+stats_fn(struct xkb_context *context, const struct xkb_context_stats *stats,
+         void *data)
+{
+    struct stats_calls *calls = data;
+
+    calls->count++;
+    calls->last = *stats;
+}
+
+static void
+test_stats(void)
+{
+    struct xkb_context *context = test_get_context(0);
+    struct xkb_rule_names rmlvo = {
+        "evdev", "pc105", "us,de", "", "grp:alt_shift_toggle"
+    };
+    struct stats_calls calls = { 0 };
+    struct xkb_context_stats stats;
+    struct xkb_keymap *keymap;
+    struct xkb_state *state;
+
+    assert(context);
+    memset(&stats, 0xff, sizeof(stats));
+    assert(!xkb_context_get_stats(context, &stats));
+    assert(stats.keymaps_compiled == 0 && stats.led_updates == 0);
+
+    assert(xkb_context_set_stats_enabled(context, 1));
+    xkb_context_set_stats_fn(context, stats_fn, &calls);
+    assert(xkb_context_get_stats(context, &stats));
+    assert(stats.keymaps_compiled == 0);
+
+    keymap = xkb_keymap_new_from_names(context, &rmlvo, 0);
+    assert(keymap);
+    assert(xkb_context_get_stats(context, &stats));
+
+    assert(stats.keymaps_compiled == 1);
+    assert(stats.compile_time > 0);
+    assert(stats.rules_time > 0);
+    assert(stats.symbols_time > 0);
+    assert(stats.derive_time > 0);
+    assert(stats.files_opened > 4);
+    assert(stats.files_parsed > 4);
+    assert(stats.max_include_depth > 0);
+    assert(stats.atoms_interned > 0);
+    assert(stats.parse_bytes > 0);
+
+    assert(calls.count == 1);
+    assert(calls.last.keymaps_compiled == 1);
+    assert(calls.last.files_parsed == stats.files_parsed);
+    assert(calls.last.max_include_depth == stats.max_include_depth);
+
+    state = xkb_state_new(keymap);
+    assert(state);
+    xkb_state_update_key(state, KEY_LEFTSHIFT + EVDEV_OFFSET, XKB_KEY_DOWN);
+    /* The copy is not updated in place. */
+    assert(stats.filters_created == 0);
+    assert(xkb_context_get_stats(context, &stats));
+    assert(stats.filters_created > 0);
+    assert(stats.led_updates > 0);
+    xkb_state_unref(state);
+
+    /* Failed compilations are reported, but not counted. */
+    rmlvo.layout = "does-not-exist";
+    assert(!xkb_keymap_new_from_names(context, &rmlvo, 0));
+    assert(xkb_context_get_stats(context, &stats));
+    assert(stats.keymaps_compiled == 1);
+    assert(calls.count == 2);
+    assert(calls.last.keymaps_compiled == 0);
+
+    xkb_context_reset_stats(context);
+    assert(xkb_context_get_stats(context, &stats));
+    assert(stats.keymaps_compiled == 0);
+    assert(stats.files_parsed == 0);
+    assert(stats.filters_created == 0);
+    assert(stats.atoms_interned == 0);
+
+    assert(xkb_context_set_stats_enabled(context, 0));
+    assert(!xkb_context_get_stats(context, &stats));
+
+    xkb_keymap_unref(keymap);
+    xkb_context_unref(context);
+}
+
+static void
+remove_file(const char *dir, const char *name)
+{
+    char *path;
+
+    assert(asprintf(&path, "%s/%s", dir, name) > 0);
+    assert(unlink(path) == 0);
+    free(path);
+}
+
+static void
+write_file(const char *dir, const char *name)
+{
+    char *path;
+    FILE *file;
+
+    assert(asprintf(&path, "%s/%s", dir, name) > 0);
+    file = fopen(path, "w");
+    assert(file);
+    fclose(file);
+    free(path);
+}
+
+/* Returns the directory in which @name is found, relative to @root. */
+static const char *
+find_symbols(struct xkb_context *context, const char *name, const char *root)
+{
+    static char found[256];
+    char *path;
+    FILE *file;
+
+    file = FindFileInXkbPath(context, name, FILE_TYPE_SYMBOLS, &path, NULL);
+    if (!file)
+        return NULL;
+    fclose(file);
+
+    if (strncmp(path, root, strlen(root)) == 0)
+        snprintf(found, sizeof(found), "%s", path + strlen(root));
+    else
+        snprintf(found, sizeof(found), "other");
+    free(path);
+    return found;
+}
+
+static void
+test_include_index(void)
+{
+    char root[] = "/tmp/xkbcommon-include-index.XXXXXX";
+    char *symbols, *vendor, *data_path;
+    struct xkb_context *context;
+
+    assert(mkdtemp(root));
+    assert(asprintf(&symbols, "%s/symbols", root) > 0);
+    assert(asprintf(&vendor, "%s/vendor", symbols) > 0);
+    assert(mkdir(symbols, 0700) == 0);
+    assert(mkdir(vendor, 0700) == 0);
+    write_file(vendor, "a");
+
+    context = xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                              XKB_CONTEXT_NO_ENVIRONMENT_NAMES);
+    assert(context);
+    assert(xkb_context_include_path_append(context, root));
+    data_path = test_get_path("");
+    assert(xkb_context_include_path_append(context, data_path));
+
+    /* Names in subdirectories are indexed in full. */
+    assert(streq(find_symbols(context, "vendor/a", root), "/symbols/vendor/a"));
+    assert(streq(find_symbols(context, "us", root), "other"));
+    assert(!find_symbols(context, "vendor/b", root));
+
+    /* A file which is found nowhere makes the directories be read again. */
+    write_file(vendor, "b");
+    assert(streq(find_symbols(context, "vendor/b", root), "/symbols/vendor/b"));
+
+    /*
+     * One which would take precedence is only seen once the include path
+     * is set again.
+     */
+    write_file(symbols, "us");
+    assert(streq(find_symbols(context, "us", root), "other"));
+    xkb_context_include_path_clear(context);
+    assert(xkb_context_include_path_append(context, root));
+    assert(xkb_context_include_path_append(context, data_path));
+    assert(streq(find_symbols(context, "us", root), "/symbols/us"));
+
+    xkb_context_unref(context);
+    free(data_path);
+
+    remove_file(vendor, "a");
+    remove_file(vendor, "b");
+    remove_file(symbols, "us");
+    assert(rmdir(vendor) == 0);
+    assert(rmdir(symbols) == 0);
+    assert(rmdir(root) == 0);
+    free(vendor);
+    free(symbols);
+}
+
+#ifdef HAVE_PTHREAD
+#define NUM_THREADS 4
+#define NUM_ROUNDS 3
+
+static const struct xkb_rule_names thread_rmlvo[] = {
+    { "evdev", "pc105", "us", "", "" },
+    { "evdev", "pc105", "us,de", "", "grp:alt_shift_toggle" },
+    { "evdev", "pc104", "ru,il", "phonetic,", "" },
+    { "evdev", "pc105", "ch", "", "ctrl:nocaps" },
+};
+
+struct compile_thread {
+    struct xkb_context *context;
+    char **expected;
+    int first;
+};
+
+static void *
+compile_thread(void *data)
+{
+    struct compile_thread *td = data;
+
+    for (int i = 0; i < NUM_ROUNDS * (int) ARRAY_SIZE(thread_rmlvo); i++) {
+        int n = (td->first + i) % ARRAY_SIZE(thread_rmlvo);
+        enum xkb_keymap_compile_flags flags =
+            (i % 2 ? XKB_KEYMAP_COMPILE_PARALLEL : 0);
+        struct xkb_keymap *keymap;
+        char *text;
+
+        keymap = xkb_keymap_new_from_names(td->context, &thread_rmlvo[n],
+                                           flags);
+        assert(keymap);
+        text = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+        assert(text);
+        assert(streq(text, td->expected[n]));
+        free(text);
+        xkb_keymap_unref(keymap);
+    }
+
+    return NULL;
+}
+
+/* Compile keymaps in several threads at once, all in the same context. */
+static void
+test_threads(void)
+{
+    struct xkb_context *context;
+    struct xkb_keymap *keymap;
+    char *expected[ARRAY_SIZE(thread_rmlvo)];
+    struct compile_thread td[NUM_THREADS];
+    pthread_t threads[NUM_THREADS];
+
+    context = test_get_context(0);
+    assert(context);
+    for (unsigned i = 0; i < ARRAY_SIZE(thread_rmlvo); i++) {
+        keymap = xkb_keymap_new_from_names(context, &thread_rmlvo[i], 0);
+        assert(keymap);
+        expected[i] = xkb_keymap_get_as_string(keymap,
+                                               XKB_KEYMAP_FORMAT_TEXT_V1);
+        assert(expected[i]);
+        xkb_keymap_unref(keymap);
+    }
+    xkb_context_unref(context);
+
+    context = test_get_context(0);
+    assert(context);
+    for (int t = 0; t < NUM_THREADS; t++) {
+        td[t].context = context;
+        td[t].expected = expected;
+        td[t].first = t;
+        assert(pthread_create(&threads[t], NULL, compile_thread, &td[t]) == 0);
+    }
+    for (int t = 0; t < NUM_THREADS; t++)
+        assert(pthread_join(threads[t], NULL) == 0);
+    xkb_context_unref(context);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(thread_rmlvo); i++)
+        free(expected[i]);
+}
+#endif
 
 int
 main(void)
@@ -48,5 +325,11 @@ main(void)
 
     xkb_context_unref(context);
 
+    test_stats();
+    test_include_index();
+#ifdef HAVE_PTHREAD
+    test_threads();
+#endif
+
     return 0;
 }
@@ -22,7 +22,7 @@
  */
 
 #include "test.h"
-#include "keysym.h" /* For unexported is_lower/upper/keypad() */
+#include "keysym.h" /* For unexported is_lower/upper() */
 
 static int
 test_string(const char *string, xkb_keysym_t expected)
@@ -81,6 +81,164 @@ test_utf8(xkb_keysym_t keysym, const char *expected)
     return streq(s, expected);
 }
 
+static void
+test_keysyms_to_utf8(void)
+{
+    const xkb_keysym_t keysyms[] = {
+        XKB_KEY_H, XKB_KEY_e, XKB_KEY_l, XKB_KEY_l, XKB_KEY_o,
+        XKB_KEY_comma, XKB_KEY_space, XKB_KEY_w, XKB_KEY_o, XKB_KEY_r,
+        XKB_KEY_l, XKB_KEY_d, XKB_KEY_Shift_L, XKB_KEY_exclam,
+        XKB_KEY_Cyrillic_em, XKB_KEY_oslash, XKB_KEY_Return,
+        XKB_KEY_EuroSign, 0x0101f600, 0x0100d800, 0x01110000,
+        XKB_KEY_a, XKB_KEY_b, XKB_KEY_c, XKB_KEY_d, XKB_KEY_e,
+        XKB_KEY_f, XKB_KEY_g, XKB_KEY_h, XKB_KEY_i,
+    };
+    const char *expected = "Hello, world!мø\r€😀abcdefghi";
+    const int len = strlen(expected);
+    char buf[64];
+
+    assert(xkb_keysyms_to_utf8(keysyms, ARRAY_SIZE(keysyms),
+                               buf, sizeof(buf)) == len);
+    assert(streq(buf, expected));
+
+    assert(xkb_keysyms_to_utf8(keysyms, 0, buf, sizeof(buf)) == 0);
+    assert(streq(buf, ""));
+    assert(xkb_keysyms_to_utf8(keysyms, ARRAY_SIZE(keysyms), NULL, 0) == len);
+
+    /* Truncated strings end before the first character which doesn't fit. */
+    for (size_t size = 1; size <= (size_t) len; size++) {
+        size_t end = 0;
+
+        memset(buf, 'x', sizeof(buf));
+        assert(xkb_keysyms_to_utf8(keysyms, ARRAY_SIZE(keysyms),
+                                   buf, size) == len);
+
+        while (end < size - 1) {
+            size_t next = end + 1;
+            while (((unsigned char) expected[next] & 0xc0) == 0x80)
+                next++;
+            if (next > size - 1)
+                break;
+            end = next;
+        }
+        assert(strlen(buf) == end);
+        assert(strncmp(buf, expected, end) == 0);
+        assert(buf[size] == 'x');
+    }
+}
+
+static void
+test_classify(void)
+{
+    const xkb_keysym_t keysyms[] = {
+        XKB_KEY_a, XKB_KEY_Shift_L, XKB_KEY_KP_1, XKB_KEY_F12,
+        XKB_KEY_Left, XKB_KEY_dead_acute, XKB_KEY_Return, 0x01000531,
+    };
+    const enum xkb_keysym_class expected[] = {
+        XKB_KEYSYM_CLASS_PRINTABLE,
+        XKB_KEYSYM_CLASS_MODIFIER,
+        XKB_KEYSYM_CLASS_KEYPAD | XKB_KEYSYM_CLASS_PRINTABLE,
+        XKB_KEYSYM_CLASS_FUNCTION,
+        XKB_KEYSYM_CLASS_CURSOR,
+        XKB_KEYSYM_CLASS_DEAD,
+        0,
+        XKB_KEYSYM_CLASS_PRINTABLE,
+    };
+    enum xkb_keysym_class classes[ARRAY_SIZE(keysyms)];
+
+    xkb_keysyms_classify(keysyms, ARRAY_SIZE(keysyms), classes);
+    for (size_t i = 0; i < ARRAY_SIZE(keysyms); i++) {
+        assert(classes[i] == expected[i]);
+        assert(xkb_keysym_classify(keysyms[i]) == expected[i]);
+    }
+
+    assert(xkb_keysym_is_modifier(XKB_KEY_Caps_Lock));
+    assert(xkb_keysym_is_modifier(XKB_KEY_ISO_Level3_Shift));
+    assert(xkb_keysym_is_modifier(XKB_KEY_Mode_switch));
+    assert(xkb_keysym_is_modifier(XKB_KEY_Num_Lock));
+    assert(!xkb_keysym_is_modifier(XKB_KEY_Scroll_Lock));
+    assert(xkb_keysym_is_function(XKB_KEY_F1));
+    assert(xkb_keysym_is_function(XKB_KEY_F35));
+    assert(!xkb_keysym_is_function(XKB_KEY_KP_F1));
+    assert(xkb_keysym_is_cursor(XKB_KEY_Home));
+    assert(xkb_keysym_is_cursor(XKB_KEY_Begin));
+    assert(!xkb_keysym_is_cursor(XKB_KEY_Select));
+    assert(!xkb_keysym_is_cursor(XKB_KEY_KP_Left));
+    assert(xkb_keysym_is_dead(XKB_KEY_dead_grave));
+    assert(xkb_keysym_is_dead(XKB_KEY_dead_greek));
+    assert(!xkb_keysym_is_dead(XKB_KEY_Multi_key));
+    assert(xkb_keysym_is_printable(XKB_KEY_space));
+    assert(xkb_keysym_is_printable(XKB_KEY_EuroSign));
+    assert(xkb_keysym_is_printable(XKB_KEY_KP_Space));
+    assert(!xkb_keysym_is_printable(XKB_KEY_KP_Enter));
+    assert(!xkb_keysym_is_printable(XKB_KEY_Delete));
+    assert(!xkb_keysym_is_printable(XKB_KEY_NoSymbol));
+    assert(!xkb_keysym_is_printable(0x0100001b));
+    assert(!xkb_keysym_is_printable(0x0100d800));
+    assert(!xkb_keysym_is_printable(0x01110000));
+    assert(!xkb_keysym_is_printable(XKB_KEY_XF86Back));
+    assert(xkb_keysym_classify(XKB_KEY_XF86Back) == 0);
+
+    /* The tables agree with xkb_keysym_to_utf32() for printable keysyms. */
+    for (xkb_keysym_t ks = 0; ks < 0x10000; ks++) {
+        uint32_t cp = xkb_keysym_to_utf32(ks);
+        bool printable = (cp >= 0x20 && cp < 0x7f) || cp >= 0xa0;
+        assert(!!xkb_keysym_is_printable(ks) == printable);
+    }
+}
+
+static void
+test_names_with_prefix(void)
+{
+    static const char *all[4096];
+    static const char *names[4096];
+    const char *prefixes[] = {
+        "", "a", "A", "dead_", "DEAD_", "KP_", "kp_", "XF86Audio", "Greek_al",
+        "Cyrillic_YE", "3270_", "F1", "Shift", "ThisKeyShouldNotExist",
+        "_", "\xc3\xa9",
+    };
+    int num_all;
+
+    num_all = xkb_keysym_names_with_prefix("", 0, all, ARRAY_SIZE(all));
+    assert(num_all > 2000 && (size_t) num_all <= ARRAY_SIZE(all));
+    for (int i = 0; i < num_all; i++)
+        assert(xkb_keysym_from_name(all[i], 0) != XKB_KEY_NoSymbol ||
+               streq(all[i], "NoSymbol"));
+    for (int i = 1; i < num_all; i++)
+        assert(strcasecmp(all[i - 1], all[i]) <= 0);
+
+    /* Compare with a search through all names. */
+    for (size_t p = 0; p < ARRAY_SIZE(prefixes); p++) {
+        const char *prefix = prefixes[p];
+        const size_t len = strlen(prefix);
+
+        for (int icase = 0; icase <= 1; icase++) {
+            int count = xkb_keysym_names_with_prefix(prefix,
+                icase ? XKB_KEYSYM_CASE_INSENSITIVE : 0,
+                names, ARRAY_SIZE(names));
+            int n = 0;
+
+            for (int i = 0; i < num_all; i++) {
+                if ((icase ? strncasecmp(all[i], prefix, len) :
+                             strncmp(all[i], prefix, len)) != 0)
+                    continue;
+                assert(n < count && names[n] == all[i]);
+                n++;
+            }
+            assert(n == count);
+        }
+    }
+
+    assert(xkb_keysym_names_with_prefix("dead_", 0, names, 3) > 3);
+    assert(strcasecmp(names[0], "dead_a") == 0);
+    assert(xkb_keysym_names_with_prefix("XF86Audio", 0, NULL, 0) > 10);
+    assert(xkb_keysym_names_with_prefix("ntilde", 0, names, 1) == 1);
+    assert(streq(names[0], "ntilde"));
+    assert(xkb_keysym_names_with_prefix("ntilde", XKB_KEYSYM_CASE_INSENSITIVE,
+                                        names, 2) == 2);
+    assert(xkb_keysym_names_with_prefix("a", 0xff, names, 1) == -1);
+}
+
 int
 main(void)
 {
@@ -126,6 +284,11 @@ main(void)
     assert(test_casestring("THORN", 0x00fe));
     assert(test_casestring("Thorn", 0x00fe));
     assert(test_casestring("thorn", 0x00fe));
+    /* No lower-case variant, so the exact match wins. */
+    assert(test_casestring("dead_I", 0xfe85));
+    assert(test_casestring("dead_i", 0xfe84));
+    assert(test_casestring("DEAD_I", 0xfe84));
+    assert(test_casestring("xf86_", XKB_KEY_NoSymbol));
 
     assert(test_utf8(XKB_KEY_y, "y"));
     assert(test_utf8(XKB_KEY_u, "u"));
@@ -155,6 +318,34 @@ main(void)
     assert(test_utf8(XKB_KEY_KP_Multiply, "*"));
     assert(test_utf8(XKB_KEY_KP_Subtract, "-"));
 
+    test_keysyms_to_utf8();
+    test_classify();
+    test_names_with_prefix();
+
+    assert(xkb_utf32_to_keysym('y') == XKB_KEY_y);
+    assert(xkb_utf32_to_keysym(0xf8) == XKB_KEY_oslash);
+    assert(xkb_utf32_to_keysym(0x43c) == XKB_KEY_Cyrillic_em);
+    assert(xkb_utf32_to_keysym(0x5d0) == XKB_KEY_hebrew_aleph);
+    assert(xkb_utf32_to_keysym(0x634) == XKB_KEY_Arabic_sheen);
+    assert(xkb_utf32_to_keysym(0x20ac) == XKB_KEY_EuroSign);
+    assert(xkb_utf32_to_keysym(0x2500) == XKB_KEY_horizconnector);
+    assert(xkb_utf32_to_keysym('\b') == XKB_KEY_BackSpace);
+    assert(xkb_utf32_to_keysym('\t') == XKB_KEY_Tab);
+    assert(xkb_utf32_to_keysym('\r') == XKB_KEY_Return);
+    assert(xkb_utf32_to_keysym(0x1b) == XKB_KEY_Escape);
+    assert(xkb_utf32_to_keysym(0x7f) == XKB_KEY_Delete);
+    assert(xkb_utf32_to_keysym(0x1f600) == 0x0101f600);
+    assert(xkb_utf32_to_keysym(0xd800) == XKB_KEY_NoSymbol);
+    assert(xkb_utf32_to_keysym(0xfdd0) == XKB_KEY_NoSymbol);
+    assert(xkb_utf32_to_keysym(0x1fffe) == XKB_KEY_NoSymbol);
+    assert(xkb_utf32_to_keysym(0x110000) == XKB_KEY_NoSymbol);
+
+    for (xkb_keysym_t ks = 0; ks < 0x10000; ks++) {
+        uint32_t cp = xkb_keysym_to_utf32(ks);
+        if (cp >= 0x100)
+            assert(xkb_keysym_to_utf32(xkb_utf32_to_keysym(cp)) == cp);
+    }
+
     assert(xkb_keysym_is_lower(XKB_KEY_a));
     assert(xkb_keysym_is_lower(XKB_KEY_Greek_lambda));
     assert(xkb_keysym_is_lower(xkb_keysym_from_name("U03b1", 0))); /* GREEK SMALL LETTER ALPHA */
@@ -196,5 +387,42 @@ main(void)
     assert(xkb_keysym_to_upper(XKB_KEY_eacute) == XKB_KEY_Eacute);
     assert(xkb_keysym_to_lower(XKB_KEY_Eacute) == XKB_KEY_eacute);
 
+    /* Latin-1 and legacy keysyms map to keysyms of the same kind. */
+    assert(xkb_keysym_to_upper(XKB_KEY_ydiaeresis) == XKB_KEY_Ydiaeresis);
+    assert(xkb_keysym_to_lower(XKB_KEY_Ydiaeresis) == XKB_KEY_ydiaeresis);
+    assert(xkb_keysym_to_upper(XKB_KEY_Greek_finalsmallsigma) == XKB_KEY_Greek_SIGMA);
+    assert(xkb_keysym_to_lower(XKB_KEY_Greek_SIGMA) == XKB_KEY_Greek_sigma);
+    assert(xkb_keysym_to_lower(XKB_KEY_Cyrillic_YU) == XKB_KEY_Cyrillic_yu);
+    assert(xkb_keysym_to_upper(XKB_KEY_Serbian_dze) == XKB_KEY_Serbian_DZE);
+    assert(xkb_keysym_to_upper(XKB_KEY_idotless) == XKB_KEY_I);
+    assert(xkb_keysym_to_lower(XKB_KEY_Iabovedot) == XKB_KEY_i);
+    assert(!xkb_keysym_is_lower(XKB_KEY_ssharp));
+    assert(!xkb_keysym_is_upper(XKB_KEY_ssharp));
+
+    /* Unicode keysyms, including scripts outside the legacy blocks. */
+    assert(xkb_keysym_to_upper(0x1000561) == 0x1000531); /* ARMENIAN AYB */
+    assert(xkb_keysym_to_lower(0x1000531) == 0x1000561);
+    assert(xkb_keysym_to_upper(0x10004b7) == 0x10004b6); /* CYRILLIC CHE WITH DESCENDER */
+    assert(xkb_keysym_to_lower(0x10010a0) == 0x1002d00); /* GEORGIAN AN */
+    assert(xkb_keysym_to_upper(0x10010d0) == 0x1001c90); /* GEORGIAN LETTER AN */
+    assert(xkb_keysym_to_upper(0x1002c30) == 0x1002c00); /* GLAGOLITIC AZU */
+    assert(xkb_keysym_to_upper(0x100ab70) == 0x10013a0); /* CHEROKEE A */
+    assert(xkb_keysym_to_lower(0x1010400) == 0x1010428); /* DESERET LONG I */
+    assert(xkb_keysym_to_upper(0x101e922) == 0x101e900); /* ADLAM ALIF */
+    assert(xkb_keysym_to_upper(0x1001f80) == 0x1001f88); /* GREEK ALPHA WITH PSILI AND YPOGEGRAMMENI */
+    assert(xkb_keysym_to_lower(0x1000130) == 0x1000069); /* LATIN CAPITAL I WITH DOT ABOVE */
+    assert(xkb_keysym_is_upper(0x1000531));
+    assert(xkb_keysym_is_lower(0x1000561));
+    assert(!xkb_keysym_is_lower(0x10001c5)); /* LATIN CAPITAL D WITH SMALL Z WITH CARON */
+    assert(!xkb_keysym_is_upper(0x10001c5));
+    assert(xkb_keysym_to_upper(0x1110000) == 0x1110000);
+    assert(xkb_keysym_to_lower(XKB_KEY_XF86Back) == XKB_KEY_XF86Back);
+
+    /* Unicode keysyms always convert to Unicode keysyms. */
+    for (xkb_keysym_t ks = 0x1000000; ks <= 0x110ffff; ks++) {
+        assert((xkb_keysym_to_lower(ks) & 0xff000000) == 0x01000000);
+        assert((xkb_keysym_to_upper(ks) & 0xff000000) == 0x01000000);
+    }
+
     return 0;
 }
@@ -69,7 +69,7 @@ main(int argc, char *argv[])
 
     xkb_context_sanitize_rule_names(ctx, &rmlvo);
 
-    if (!xkb_components_from_rules(ctx, &rmlvo, &kccgst))
+    if (!xkb_components_from_rules(ctx, &rmlvo, &kccgst, NULL))
         return 1;
 
     printf("keycodes: %s\n", kccgst.keycodes);
@@ -23,6 +23,9 @@
 
 #include <time.h>
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "test.h"
 #include "xkbcomp-priv.h"
 #include "rules.h"
@@ -67,7 +70,7 @@ test_rules(struct xkb_context *ctx, struct test_data *data)
         fprintf(stderr, "Expecting: %s\t%s\t%s\t%s\n",
                 data->keycodes, data->types, data->compat, data->symbols);
 
-    if (!xkb_components_from_rules(ctx, &rmlvo, &kccgst)) {
+    if (!xkb_components_from_rules(ctx, &rmlvo, &kccgst, NULL)) {
         fprintf(stderr, "Received : FAILURE\n");
         return data->should_fail;
     }
@@ -88,6 +91,191 @@ test_rules(struct xkb_context *ctx, struct test_data *data)
     return passed;
 }
 
+/* Resolving all of the tests at once gives the same results. */
+static bool
+test_rules_batch(struct xkb_context *ctx, struct test_data **data,
+                 size_t count)
+{
+    struct xkb_rule_names rmlvo[count];
+    struct xkb_component_names kccgst[count];
+    size_t expected_resolved = 0;
+    bool passed = true;
+
+    for (size_t i = 0; i < count; i++) {
+        rmlvo[i] = (struct xkb_rule_names) {
+            data[i]->rules, data[i]->model, data[i]->layout,
+            data[i]->variant, data[i]->options
+        };
+        if (!data[i]->should_fail)
+            expected_resolved++;
+    }
+
+    if (xkb_components_from_rules_batch(ctx, rmlvo, count, kccgst, NULL) !=
+        expected_resolved)
+        passed = false;
+
+    for (size_t i = 0; i < count; i++) {
+        if (data[i]->should_fail)
+            passed = passed && !kccgst[i].keycodes && !kccgst[i].types &&
+                     !kccgst[i].compat && !kccgst[i].symbols;
+        else
+            passed = passed &&
+                     streq(kccgst[i].keycodes, data[i]->keycodes) &&
+                     streq(kccgst[i].types, data[i]->types) &&
+                     streq(kccgst[i].compat, data[i]->compat) &&
+                     streq(kccgst[i].symbols, data[i]->symbols);
+    }
+
+    xkb_component_names_clear(kccgst, count);
+    for (size_t i = 0; i < count; i++)
+        assert(!kccgst[i].keycodes && !kccgst[i].symbols);
+
+    return passed;
+}
+
+static void
+test_resolve_rule_names(struct xkb_context *ctx)
+{
+    const struct xkb_rule_names names[] = {
+        { "evdev", "pc105", "us", "", "" },
+        { "evdev", "pc105", "de", "", "" },
+        { "no-such-rules", "pc105", "us", "", "" },
+    };
+    struct xkb_component_names components[ARRAY_SIZE(names)];
+
+    assert(xkb_context_resolve_rule_names(ctx, names, ARRAY_SIZE(names),
+                                          components) == 2);
+    assert(streq(components[0].keycodes, "evdev+aliases(qwerty)"));
+    assert(streq(components[0].symbols, "pc+us+inet(evdev)"));
+    assert(streq(components[1].symbols, "pc+de+inet(evdev)"));
+    assert(components[2].keycodes == NULL);
+    xkb_component_names_clear(components, ARRAY_SIZE(names));
+}
+
+static int unrecognized_count;
+
+ATTR_PRINTF(3, 0) static void
+unrecognized_log_fn(struct xkb_context *ctx, enum xkb_log_level level,
+                    const char *fmt, va_list args)
+{
+    if (strstr(fmt, "Unrecognized RMLVO"))
+        unrecognized_count++;
+}
+
+/*
+ * Which input values matched is tracked per resolution, so looking up
+ * a different RMLVO in the same compiled rules neither inherits nor
+ * leaves behind any of it.
+ */
+static void
+test_matched_per_resolution(struct xkb_context *ctx)
+{
+    struct test_data matching = {
+        .rules = "simple",
+
+        .model = "my_model", .layout = "my_layout", .variant = "my_variant",
+        .options = "my_option",
+
+        .keycodes = "my_keycodes", .types = "my_types",
+        .compat = "my_compat|some:compat",
+        .symbols = "my_symbols+extra_variant",
+    };
+    struct test_data other = {
+        .rules = "simple",
+
+        .model = "other_model", .layout = "other_layout", .variant = "",
+        .options = "other_option",
+
+        .keycodes = "default_keycodes", .types = "default_types",
+        .compat = "default_compat", .symbols = "default_symbols",
+    };
+    struct test_data unmatched_option = matching;
+    unmatched_option.options = "other_option";
+    unmatched_option.compat = "my_compat";
+    struct test_data *batch[] = { &matching, &other, &unmatched_option };
+    enum xkb_log_level old_level = xkb_context_get_log_level(ctx);
+
+    xkb_context_set_log_level(ctx, XKB_LOG_LEVEL_ERROR);
+    xkb_context_set_log_fn(ctx, unrecognized_log_fn);
+
+    unrecognized_count = 0;
+    assert(test_rules(ctx, &matching));
+    assert(unrecognized_count == 0);
+
+    assert(test_rules(ctx, &other));
+    assert(unrecognized_count == 1);
+    assert(test_rules(ctx, &other));
+    assert(unrecognized_count == 2);
+
+    assert(test_rules(ctx, &unmatched_option));
+    assert(unrecognized_count == 3);
+    assert(test_rules(ctx, &matching));
+    assert(unrecognized_count == 3);
+
+    assert(test_rules_batch(ctx, batch, ARRAY_SIZE(batch)));
+    assert(unrecognized_count == 5);
+
+    xkb_context_set_log_fn(ctx, NULL);
+    xkb_context_set_log_level(ctx, old_level);
+}
+
+static void
+write_rules_file(const char *path, const char *keycodes)
+{
+    FILE *file = fopen(path, "w");
+    assert(file);
+    fprintf(file,
+            "! model = keycodes\n  * = %s\n"
+            "! model = types\n  * = my_types\n"
+            "! model = compat\n  * = my_compat\n"
+            "! model = symbols\n  * = my_symbols\n",
+            keycodes);
+    assert(fclose(file) == 0);
+}
+
+/* A rules file which changes on disk must not be served from the cache. */
+static void
+test_modified_rules_file(void)
+{
+    char dir[] = "/tmp/xkbcommon-rules-test.XXXXXX";
+    char *rules_dir, *path;
+    struct xkb_context *ctx;
+
+    assert(mkdtemp(dir));
+    assert(asprintf(&rules_dir, "%s/rules", dir) > 0);
+    assert(mkdir(rules_dir, 0700) == 0);
+    assert(asprintf(&path, "%s/changing", rules_dir) > 0);
+
+    ctx = xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                          XKB_CONTEXT_NO_ENVIRONMENT_NAMES);
+    assert(ctx);
+    assert(xkb_context_include_path_append(ctx, dir));
+
+    struct test_data before = {
+        .rules = "changing",
+
+        .model = "", .layout = "", .variant = "", .options = "",
+
+        .keycodes = "first", .types = "my_types",
+        .compat = "my_compat", .symbols = "my_symbols",
+    };
+    write_rules_file(path, before.keycodes);
+    assert(test_rules(ctx, &before));
+    assert(test_rules(ctx, &before));
+
+    struct test_data after = before;
+    after.keycodes = "second_keycodes";
+    write_rules_file(path, after.keycodes);
+    assert(test_rules(ctx, &after));
+
+    xkb_context_unref(ctx);
+    unlink(path);
+    rmdir(rules_dir);
+    rmdir(dir);
+    free(path);
+    free(rules_dir);
+}
+
 static void
 benchmark(struct xkb_context *ctx)
 {
@@ -105,7 +293,7 @@ benchmark(struct xkb_context *ctx)
 
     clock_gettime(CLOCK_MONOTONIC, &start);
     for (i = 0; i < BENCHMARK_ITERATIONS; i++) {
-        assert(xkb_components_from_rules(ctx, &rmlvo, &kccgst));
+        assert(xkb_components_from_rules(ctx, &rmlvo, &kccgst, NULL));
         free(kccgst.keycodes);
         free(kccgst.types);
         free(kccgst.compat);
@@ -216,6 +404,22 @@ main(int argc, char *argv[])
     };
     assert(test_rules(ctx, &test7));
 
+    /* Lookups in rules files which were already compiled. */
+    assert(test_rules(ctx, &test1));
+    assert(test_rules(ctx, &test6));
+    assert(test_rules(ctx, &test3));
+    assert(test_rules(ctx, &test7));
+
+    struct test_data *batch[] = {
+        &test1, &test2, &test3, &test4, &test5, &test6, &test7,
+        &test3, &test1,
+    };
+    assert(test_rules_batch(ctx, batch, ARRAY_SIZE(batch)));
+
+    test_resolve_rule_names(ctx);
+    test_matched_per_resolution(ctx);
+    test_modified_rules_file();
+
     xkb_context_unref(ctx);
     return 0;
 }
@@ -22,6 +22,9 @@
  */
 
 #include <time.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 #include "evdev-scancodes.h"
 #include "test.h"
@@ -124,6 +127,88 @@ test_rmlvo_env(struct xkb_context *ctx, const char *rules, const char *model,
     return ret;
 }
 
+/* Check that XKB_KEYMAP_COMPILE_PARALLEL gives the same result. */
+static int
+test_rmlvo_parallel(struct xkb_context *context, const char *rules,
+                    const char *model, const char *layout,
+                    const char *variant, const char *options)
+{
+    struct xkb_rule_names rmlvo = {
+        .rules = rules,
+        .model = model,
+        .layout = layout,
+        .variant = variant,
+        .options = options,
+    };
+    struct xkb_keymap *keymap, *parallel;
+    char *str, *parallel_str;
+    int ret;
+
+    keymap = xkb_keymap_new_from_names(context, &rmlvo,
+                                       XKB_KEYMAP_COMPILE_NO_FLAGS);
+    parallel = xkb_keymap_new_from_names(context, &rmlvo,
+                                         XKB_KEYMAP_COMPILE_PARALLEL);
+    if (!keymap || !parallel) {
+        ret = (keymap == parallel);
+        xkb_keymap_unref(keymap);
+        xkb_keymap_unref(parallel);
+        return ret;
+    }
+
+    str = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+    parallel_str = xkb_keymap_get_as_string(parallel,
+                                            XKB_KEYMAP_FORMAT_TEXT_V1);
+    assert(str && parallel_str);
+
+    ret = streq(str, parallel_str);
+
+    free(str);
+    free(parallel_str);
+    xkb_keymap_unref(keymap);
+    xkb_keymap_unref(parallel);
+    return ret;
+}
+
+#ifdef HAVE_PTHREAD
+static pthread_t main_thread;
+static int log_count, log_count_other_thread;
+
+static void
+thread_log_fn(struct xkb_context *context, enum xkb_log_level level,
+              const char *fmt, va_list args)
+{
+    log_count++;
+    if (!pthread_equal(pthread_self(), main_thread))
+        log_count_other_thread++;
+}
+
+/* The prefetch threads must not call the log function themselves. */
+static void
+test_parallel_log(struct xkb_context *context)
+{
+    const char keymap_str[] =
+        "xkb_keymap {\n"
+        "  xkb_keycodes { include \"does-not-exist\" };\n"
+        "  xkb_types { include \"does-not-exist\" };\n"
+        "  xkb_compat { include \"does-not-exist\" };\n"
+        "  xkb_symbols { include \"does-not-exist\" };\n"
+        "};";
+    struct xkb_keymap *keymap;
+
+    main_thread = pthread_self();
+    xkb_context_set_log_fn(context, thread_log_fn);
+
+    keymap = xkb_keymap_new_from_string(context, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_PARALLEL);
+    assert(!keymap);
+    assert(log_count > 0);
+    assert(log_count_other_thread == 0);
+
+    xkb_context_set_log_fn(context, NULL);
+}
+#endif
+
 static void
 benchmark(struct xkb_context *context)
 {
@@ -239,6 +324,15 @@ main(int argc, char *argv[])
     assert(test_rmlvo_env(ctx, "evdev", "", "cz", "bksl", "",
                           KEY_A,          BOTH, XKB_KEY_a,                FINISH));
 
+    assert(test_rmlvo_parallel(ctx, "evdev", "pc105", "us,il,ru,ca", ",,,multix",
+                               "grp:alts_toggle,ctrl:nocaps,compose:rwin"));
+    assert(test_rmlvo_parallel(ctx, "evdev", "", "us,de", ",neo", ""));
+    /* Fails either way. */
+    assert(test_rmlvo_parallel(ctx, "evdev", "", "does-not-exist", "", ""));
+#ifdef HAVE_PTHREAD
+    test_parallel_log(ctx);
+#endif
+
     xkb_context_unref(ctx);
 
     ctx = test_get_context(0);
@@ -365,6 +365,78 @@ test_update_mask_mods(struct xkb_keymap *keymap)
     xkb_state_unref(state);
 }
 
+static void
+test_masks(struct xkb_keymap *keymap)
+{
+    struct xkb_state *state = xkb_state_new(keymap);
+    xkb_mod_mask_t ctrl, alt, caps;
+    xkb_led_mask_t caps_led, num_led;
+
+    assert(state);
+
+    ctrl = xkb_keymap_mod_get_mask(keymap, XKB_MOD_NAME_CTRL);
+    alt = xkb_keymap_mod_get_mask(keymap, XKB_MOD_NAME_ALT);
+    caps = xkb_keymap_mod_get_mask(keymap, XKB_MOD_NAME_CAPS);
+    assert(ctrl == (1u << xkb_keymap_mod_get_index(keymap, XKB_MOD_NAME_CTRL)));
+    assert(alt == (1u << xkb_keymap_mod_get_index(keymap, XKB_MOD_NAME_ALT)));
+    assert(xkb_keymap_mod_get_mask(keymap, "NoSuchMod") == 0);
+
+    caps_led = xkb_keymap_led_get_mask(keymap, XKB_LED_NAME_CAPS);
+    num_led = xkb_keymap_led_get_mask(keymap, XKB_LED_NAME_NUM);
+    assert(caps_led == (1u << xkb_keymap_led_get_index(keymap, XKB_LED_NAME_CAPS)));
+    assert(num_led != 0 && num_led != caps_led);
+    assert(xkb_keymap_led_get_mask(keymap, "NoSuchLED") == 0);
+
+    assert(xkb_state_mod_mask_is_active(state, 1u << 31,
+                                        XKB_STATE_MODS_EFFECTIVE,
+                                        XKB_STATE_MATCH_ANY) == -1);
+    assert(xkb_state_led_mask_is_active(state, 1u << 31,
+                                        XKB_STATE_MATCH_ANY) == -1);
+    /* A name which wasn't found doesn't match everything. */
+    assert(xkb_state_mod_mask_is_active(state,
+                                        xkb_keymap_mod_get_mask(keymap,
+                                                                "NoSuchMod"),
+                                        XKB_STATE_MODS_EFFECTIVE,
+                                        XKB_STATE_MATCH_ALL) == -1);
+    assert(xkb_state_led_mask_is_active(state, 0,
+                                        XKB_STATE_MATCH_ALL) == -1);
+
+    xkb_state_update_key(state, KEY_LEFTCTRL + EVDEV_OFFSET, XKB_KEY_DOWN);
+    xkb_state_update_key(state, KEY_LEFTALT + EVDEV_OFFSET, XKB_KEY_DOWN);
+    assert(xkb_state_mod_mask_is_active(state, ctrl | alt,
+                                        XKB_STATE_MODS_DEPRESSED,
+                                        XKB_STATE_MATCH_ALL) > 0);
+    assert(xkb_state_mod_mask_is_active(state, ctrl,
+                                        XKB_STATE_MODS_DEPRESSED,
+                                        XKB_STATE_MATCH_ALL) == 0);
+    assert(xkb_state_mod_mask_is_active(state, ctrl,
+                                        XKB_STATE_MODS_DEPRESSED,
+                                        XKB_STATE_MATCH_ALL |
+                                        XKB_STATE_MATCH_NON_EXCLUSIVE) > 0);
+    assert(xkb_state_mod_mask_is_active(state, ctrl | alt | caps,
+                                        XKB_STATE_MODS_DEPRESSED,
+                                        XKB_STATE_MATCH_ANY) > 0);
+    assert(xkb_state_mod_mask_is_active(state, ctrl | alt | caps,
+                                        XKB_STATE_MODS_DEPRESSED,
+                                        XKB_STATE_MATCH_ALL) == 0);
+    xkb_state_update_key(state, KEY_LEFTALT + EVDEV_OFFSET, XKB_KEY_UP);
+    xkb_state_update_key(state, KEY_LEFTCTRL + EVDEV_OFFSET, XKB_KEY_UP);
+
+    xkb_state_update_key(state, KEY_CAPSLOCK + EVDEV_OFFSET, XKB_KEY_DOWN);
+    xkb_state_update_key(state, KEY_CAPSLOCK + EVDEV_OFFSET, XKB_KEY_UP);
+    assert(xkb_state_led_mask_is_active(state, caps_led,
+                                        XKB_STATE_MATCH_ALL) > 0);
+    assert(xkb_state_led_mask_is_active(state, caps_led | num_led,
+                                        XKB_STATE_MATCH_ANY) > 0);
+    assert(xkb_state_led_mask_is_active(state, caps_led | num_led,
+                                        XKB_STATE_MATCH_ALL) == 0);
+    assert(xkb_state_led_mask_is_active(state, num_led,
+                                        XKB_STATE_MATCH_ANY |
+                                        XKB_STATE_MATCH_NON_EXCLUSIVE) == 0);
+
+    xkb_state_unref(state);
+}
+
 static void
 test_repeat(struct xkb_keymap *keymap)
 {
@@ -692,6 +764,7 @@ main(void)
     test_update_key(keymap);
     test_serialisation(keymap);
     test_update_mask_mods(keymap);
+    test_masks(keymap);
     test_repeat(keymap);
     test_consume(keymap);
     test_range(keymap);
@@ -24,11 +24,372 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 #include "test.h"
+#include "xkbcomp-priv.h"
 
 #define DATA_PATH "keymaps/stringcomp.data"
 
+static int
+write_count(void *data, const char *text, size_t len)
+{
+    int *count = data;
+
+    return ++(*count) < 3;
+}
+
+static void
+test_write(struct xkb_keymap *keymap, const char *dump)
+{
+    size_t len = strlen(dump), ret;
+    char *buffer, small[16];
+    FILE *file;
+    int count = 0;
+
+    /* Sizing, then writing to an exactly-sized buffer. */
+    assert(xkb_keymap_write_to_buffer(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                      0, NULL, 0) == len);
+    buffer = malloc(len + 1);
+    assert(buffer);
+    ret = xkb_keymap_write_to_buffer(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                     0, buffer, len + 1);
+    assert(ret == len);
+    assert(streq(buffer, dump));
+
+    /* Truncation. */
+    ret = xkb_keymap_write_to_buffer(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                     0, small, sizeof(small));
+    assert(ret == len);
+    assert(strlen(small) == sizeof(small) - 1);
+    assert(strncmp(small, dump, sizeof(small) - 1) == 0);
+
+    /* A file descriptor. */
+    file = tmpfile();
+    assert(file);
+    assert(xkb_keymap_write_to_fd(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                  0, fileno(file)));
+    rewind(file);
+    memset(buffer, 0, len + 1);
+    assert(fread(buffer, 1, len + 1, file) == len);
+    assert(streq(buffer, dump));
+    fclose(file);
+
+    /* The callback can stop the writing. */
+    assert(!xkb_keymap_write(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                             write_count, &count));
+    assert(count == 3);
+    assert(!xkb_keymap_write_to_buffer(keymap, 4893, 0, NULL, 0));
+    assert(!xkb_keymap_write_to_buffer(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                       1414, NULL, 0));
+
+    free(buffer);
+}
+
+static void
+test_text(struct xkb_keymap *keymap, const char *dump)
+{
+    const char *text;
+    size_t len, size;
+    struct stat stat_buf;
+    char *map, *str;
+    int fd;
+
+    text = xkb_keymap_get_text(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                               &len);
+    assert(text);
+    assert(len == strlen(dump));
+    assert(streq(text, dump));
+    assert(xkb_keymap_get_text(keymap, XKB_KEYMAP_FORMAT_TEXT_V1, 0,
+                               NULL) == text);
+    assert(!xkb_keymap_get_text(keymap, 4893, 0, NULL));
+
+    str = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(str && str != text && streq(str, dump));
+    free(str);
+
+    fd = xkb_keymap_get_text_fd(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                                &size);
+    if (fd < 0) {
+        fprintf(stderr, "sealed files not supported; skipping\n");
+        return;
+    }
+    assert(size == len + 1);
+    assert(xkb_keymap_get_text_fd(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                                  NULL) == fd);
+    assert(fstat(fd, &stat_buf) == 0);
+    assert((size_t) stat_buf.st_size == size);
+    assert(write(fd, "x", 1) < 0);
+    assert(ftruncate(fd, 0) < 0);
+
+    map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    assert(map != MAP_FAILED);
+    assert(streq(map, dump));
+    munmap(map, size);
+}
+
+static void
+assert_keymaps_equal(struct xkb_keymap *a, struct xkb_keymap *b)
+{
+    const struct xkb_key *ka, *kb;
+
+    assert(a->min_key_code == b->min_key_code);
+    assert(a->max_key_code == b->max_key_code);
+    assert(a->num_groups == b->num_groups);
+    for (xkb_layout_index_t i = 0; i < a->num_group_names; i++)
+        assert(a->group_names[i] == b->group_names[i]);
+
+    assert(a->mods.num_mods == b->mods.num_mods);
+    for (xkb_mod_index_t i = 0; i < a->mods.num_mods; i++) {
+        assert(a->mods.mods[i].name == b->mods.mods[i].name);
+        assert(a->mods.mods[i].mapping == b->mods.mods[i].mapping);
+    }
+
+    assert(a->num_leds == b->num_leds);
+    for (xkb_led_index_t i = 0; i < a->num_leds; i++) {
+        assert(a->leds[i].name == b->leds[i].name);
+        assert(a->leds[i].mods.mask == b->leds[i].mods.mask);
+        assert(a->leds[i].groups == b->leds[i].groups);
+        assert(a->leds[i].ctrls == b->leds[i].ctrls);
+    }
+
+    for (ka = a->keys + a->min_key_code, kb = b->keys + b->min_key_code;
+         ka <= a->keys + a->max_key_code; ka++, kb++) {
+        assert(ka->name == kb->name);
+        assert(ka->modmap == kb->modmap);
+        assert(ka->vmodmap == kb->vmodmap);
+        assert(ka->repeats == kb->repeats);
+        assert(ka->num_groups == kb->num_groups);
+        assert(ka->out_of_range_group_action == kb->out_of_range_group_action);
+
+        for (xkb_layout_index_t g = 0; g < ka->num_groups; g++) {
+            const struct xkb_key_type *ta = ka->groups[g].type;
+            const struct xkb_key_type *tb = kb->groups[g].type;
+
+            assert(ta->name == tb->name);
+            assert(ta->mods.mask == tb->mods.mask);
+            assert(ta->num_levels == tb->num_levels);
+
+            for (xkb_level_index_t l = 0; l < ta->num_levels; l++) {
+                const struct xkb_level *la = &ka->groups[g].levels[l];
+                const struct xkb_level *lb = &kb->groups[g].levels[l];
+
+                assert(la->num_syms == lb->num_syms);
+                if (la->num_syms == 1)
+                    assert(la->u.sym == lb->u.sym);
+                else if (la->num_syms > 1)
+                    assert(memcmp(la->u.syms, lb->u.syms,
+                                  la->num_syms * sizeof(*la->u.syms)) == 0);
+                assert(memcmp(&la->action, &lb->action,
+                              sizeof(la->action)) == 0);
+            }
+        }
+    }
+}
+
+#ifdef HAVE_PTHREAD
+#define NUM_THREADS 4
+
+struct text_thread {
+    struct xkb_keymap *keymap;
+    const char *text;
+    size_t len;
+    int fd;
+};
+
+static void *
+text_thread(void *data)
+{
+    struct text_thread *td = data;
+
+    td->text = xkb_keymap_get_text(td->keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                   0, &td->len);
+    td->fd = xkb_keymap_get_text_fd(td->keymap,
+                                    XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0, NULL);
+    return NULL;
+}
+
+/* All threads racing to make the text get the same one. */
+static void
+test_text_threads(struct xkb_context *ctx, const char *dump)
+{
+    struct xkb_keymap *keymap;
+    struct text_thread td[NUM_THREADS];
+    pthread_t threads[NUM_THREADS];
+
+    keymap = test_compile_string(ctx, dump);
+    assert(keymap);
+
+    for (int t = 0; t < NUM_THREADS; t++) {
+        td[t].keymap = xkb_keymap_ref(keymap);
+        assert(pthread_create(&threads[t], NULL, text_thread, &td[t]) == 0);
+    }
+    for (int t = 0; t < NUM_THREADS; t++) {
+        assert(pthread_join(threads[t], NULL) == 0);
+        xkb_keymap_unref(td[t].keymap);
+    }
+
+    assert(td[0].text && streq(td[0].text, dump));
+    assert(td[0].len == strlen(dump));
+    for (int t = 1; t < NUM_THREADS; t++) {
+        assert(td[t].text == td[0].text);
+        assert(td[t].len == td[0].len);
+        assert(td[t].fd == td[0].fd);
+    }
+    assert(xkb_keymap_get_text(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                               NULL) == td[0].text);
+
+    xkb_keymap_unref(keymap);
+}
+#endif
+
+static void
+test_compact(struct xkb_context *ctx, struct xkb_keymap *keymap,
+             const char *dump)
+{
+    struct xkb_keymap *compiled;
+    const char *compact, *compact2;
+    size_t len;
+
+    compact = xkb_keymap_get_text(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                  XKB_KEYMAP_SERIALIZE_COMPACT, &len);
+    assert(compact);
+    assert(len == strlen(compact));
+    assert(len < strlen(dump) * 2 / 3);
+    assert(xkb_keymap_write_to_buffer(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                      XKB_KEYMAP_SERIALIZE_COMPACT,
+                                      NULL, 0) == len);
+
+    /* It compiles to the same keymap, which writes the same text. */
+    compiled = test_compile_string(ctx, compact);
+    assert(compiled);
+    assert_keymaps_equal(keymap, compiled);
+
+    compact2 = xkb_keymap_get_text(compiled, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                   XKB_KEYMAP_SERIALIZE_COMPACT, NULL);
+    assert(compact2);
+    assert(streq(compact, compact2));
+
+    xkb_keymap_unref(compiled);
+}
+
+static struct xkb_keymap *
+compile_canonical(struct xkb_context *ctx, const char *string)
+{
+    struct xkb_keymap *keymap;
+
+    keymap = xkb_keymap_new(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    assert(keymap);
+
+    if (!CompileCanonicalKeymap(keymap, string, strlen(string))) {
+        xkb_keymap_unref(keymap);
+        return NULL;
+    }
+
+    return keymap;
+}
+
+static struct xkb_keymap *
+compile_full(struct xkb_context *ctx, const char *string)
+{
+    struct xkb_keymap *keymap;
+    XkbFile *file;
+
+    keymap = xkb_keymap_new(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    assert(keymap);
+
+    file = XkbParseString(ctx, string, strlen(string), "(input string)",
+                          NULL);
+    assert(file);
+    assert(CompileKeymap(file, keymap, MERGE_OVERRIDE, NULL));
+    FreeXkbFile(file);
+
+    return keymap;
+}
+
+/* A copy of a keymap must be independent of the original. */
+static void
+test_copy(struct xkb_keymap *keymap, const char *dump)
+{
+    struct xkb_keymap *copy;
+    char *str;
+
+    copy = xkb_keymap_copy(keymap);
+    assert(copy && copy != keymap);
+    assert(copy->keys != keymap->keys && copy->types != keymap->types);
+
+    str = xkb_keymap_get_as_string(copy, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(str && streq(str, dump));
+    free(str);
+    xkb_keymap_unref(copy);
+
+    str = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(str && streq(str, dump));
+    free(str);
+}
+
+static void
+test_canonical(struct xkb_context *ctx)
+{
+    static const enum xkb_keymap_serialize_flags flags[] = {
+        XKB_KEYMAP_SERIALIZE_NO_FLAGS, XKB_KEYMAP_SERIALIZE_COMPACT,
+    };
+    struct xkb_keymap *keymap, *fast, *full;
+    const char *text, *fast_text, *full_text;
+
+    keymap = test_compile_rules(ctx, NULL, NULL, "us,de,ru",
+                                ",nodeadkeys,phonetic",
+                                "grp:alt_shift_toggle,ctrl:nocaps");
+    assert(keymap);
+
+    /* Both of our own outputs take the fast path, to the same keymap. */
+    for (unsigned i = 0; i < ARRAY_SIZE(flags); i++) {
+        text = xkb_keymap_get_text(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                   flags[i], NULL);
+        assert(text);
+
+        fast = compile_canonical(ctx, text);
+        assert(fast);
+        full = compile_full(ctx, text);
+        assert_keymaps_equal(fast, full);
+
+        fast_text = xkb_keymap_get_text(fast, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                        flags[i], NULL);
+        full_text = xkb_keymap_get_text(full, XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                        flags[i], NULL);
+        assert(fast_text && full_text);
+        assert(streq(fast_text, text));
+        assert(streq(full_text, text));
+
+        xkb_keymap_unref(fast);
+        xkb_keymap_unref(full);
+    }
+
+    xkb_keymap_unref(keymap);
+
+    /* Anything else is left to the full compiler. */
+    assert(!compile_canonical(ctx, ""));
+    assert(!compile_canonical(ctx,
+        "xkb_keymap {\n"
+        "  xkb_keycodes { include \"evdev\" };\n"
+        "  xkb_types { include \"complete\" };\n"
+        "  xkb_compat { include \"complete\" };\n"
+        "  xkb_symbols { include \"pc+us\" };\n"
+        "};"));
+    assert(!compile_canonical(ctx,
+        "xkb_keymap {\n"
+        "  xkb_keycodes { <A> = 9; };\n"
+        "  xkb_types { };\n"
+        "  xkb_compat { };\n"
+        "  xkb_symbols { key <A> { [ a ] }; key <A> { [ b ] }; };\n"
+        "};"));
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -86,6 +447,15 @@ main(int argc, char *argv[])
     assert(dump2);
     assert(streq(dump, dump2));
 
+    test_write(keymap, dump);
+    test_text(keymap, dump);
+#ifdef HAVE_PTHREAD
+    test_text_threads(ctx, dump);
+#endif
+    test_compact(ctx, keymap, dump);
+    test_copy(keymap, dump);
+    test_canonical(ctx);
+
     /* Test response to invalid formats and flags. */
     assert(!xkb_keymap_new_from_string(ctx, dump, 0, 0));
     assert(!xkb_keymap_new_from_string(ctx, dump, -1, 0));
@@ -32,13 +32,130 @@
 #include "test.h"
 #include "xkbcommon/xkbcommon-x11.h"
 
+#include <xcb/xkb.h>
+
+static bool
+is_map_notify(const xcb_generic_event_t *event, uint8_t base_event)
+{
+    const xcb_xkb_map_notify_event_t *map_notify =
+        (const xcb_xkb_map_notify_event_t *) event;
+
+    return (event->response_type & ~0x80) == base_event &&
+           map_notify->xkbType == XCB_XKB_MAP_NOTIFY;
+}
+
+/*
+ * Change <AC01> with the core protocol, which the server reports with
+ * XkbMapNotify events, and check that applying them to the keymap gives
+ * the same keymap as fetching the whole of it again.
+ */
+static int
+test_map_notify(struct xkb_context *ctx, xcb_connection_t *conn,
+                int32_t device_id, uint8_t base_event,
+                struct xkb_keymap *keymap,
+                const xcb_keysym_t *syms, uint8_t num_syms)
+{
+    static const uint16_t map_parts =
+        (XCB_XKB_MAP_PART_KEY_TYPES |
+         XCB_XKB_MAP_PART_KEY_SYMS |
+         XCB_XKB_MAP_PART_MODIFIER_MAP |
+         XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS |
+         XCB_XKB_MAP_PART_KEY_ACTIONS |
+         XCB_XKB_MAP_PART_VIRTUAL_MODS |
+         XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP);
+    static const xcb_xkb_select_events_details_t details = { 0 };
+    const xcb_keycode_t keycode = 38;
+    xcb_generic_event_t *event;
+    xcb_generic_error_t *error;
+    xcb_void_cookie_t cookie;
+    struct xkb_keymap *updated, *fetched, *next;
+    char *original_dump, *updated_dump, *fetched_dump;
+    int ret;
+
+    cookie = xcb_xkb_select_events_aux_checked(conn, device_id,
+                                               XCB_XKB_EVENT_TYPE_MAP_NOTIFY,
+                                               0, 0, map_parts, map_parts,
+                                               &details);
+    error = xcb_request_check(conn, cookie);
+    if (error) {
+        free(error);
+        return SKIP_TEST;
+    }
+
+    xcb_change_keyboard_mapping(conn, 1, keycode, num_syms, syms);
+    xcb_flush(conn);
+
+    /* The core MappingNotify is sent too, without being selected. */
+    while ((event = xcb_wait_for_event(conn)) &&
+           !is_map_notify(event, base_event))
+        free(event);
+    assert(event);
+
+    /*
+     * The server may report the change in several events; a round trip
+     * makes sure they have all arrived.
+     */
+    free(xcb_get_input_focus_reply(conn, xcb_get_input_focus(conn), NULL));
+
+    updated = xkb_keymap_ref(keymap);
+    do {
+        if (is_map_notify(event, base_event)) {
+            next = xkb_x11_keymap_new_from_map_notify(updated, conn, event);
+            assert(next);
+            xkb_keymap_unref(updated);
+            updated = next;
+        }
+        free(event);
+    } while ((event = xcb_poll_for_queued_event(conn)));
+
+    fetched = xkb_x11_keymap_new_from_device(ctx, conn, device_id,
+                                             XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(fetched);
+
+    original_dump = xkb_keymap_get_as_string(keymap,
+                                             XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    updated_dump = xkb_keymap_get_as_string(updated,
+                                            XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    fetched_dump = xkb_keymap_get_as_string(fetched,
+                                            XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(original_dump && updated_dump && fetched_dump);
+
+    /* The change must have been made, for the test to mean anything. */
+    assert(!streq(original_dump, fetched_dump));
+
+    ret = 0;
+    if (!streq(updated_dump, fetched_dump)) {
+        fprintf(stderr,
+                "map notify test failed: updated map differs from fetched\n");
+        fprintf(stderr, "updated map:\n");
+        fprintf(stderr, "%s\n", updated_dump);
+        fprintf(stderr, "fetched map:\n");
+        fprintf(stderr, "%s\n", fetched_dump);
+        ret = 1;
+    }
+
+    free(original_dump);
+    free(updated_dump);
+    free(fetched_dump);
+    xkb_keymap_unref(updated);
+    xkb_keymap_unref(fetched);
+    return ret;
+}
+
 int
 main(void)
 {
+    /* <AC01> is "a" in the uploaded keymap, which has two groups. */
+    static const xcb_keysym_t one_group[] = { XKB_KEY_b, XKB_KEY_B };
+    /* In the core protocol, the fifth and sixth symbols are group 3. */
+    static const xcb_keysym_t three_groups[] = {
+        XKB_KEY_b, XKB_KEY_B, XKB_KEY_c, XKB_KEY_C, XKB_KEY_d, XKB_KEY_D,
+    };
     struct xkb_context *ctx = test_get_context(0);
     struct xkb_keymap *keymap;
     xcb_connection_t *conn;
     int32_t device_id;
+    uint8_t base_event;
     int pipefds[2];
     int ret, status;
     char displayfd[128], display[128];
@@ -62,7 +179,9 @@ main(void)
      *    day for xkbcommon-x11] so we use xkbcomp for now).
      * 4. Download the keymap back from the display using xkbcommon-x11.
      * 5. Compare received keymap to the uploaded keymap.
-     * 6. Kill the server & clean up.
+     * 6. Change a key, and compare the keymap updated from the resulting
+     *    XkbMapNotify events to the keymap downloaded again.
+     * 7. Kill the server & clean up.
      */
 
     ret = pipe(pipefds);
@@ -95,11 +214,14 @@ main(void)
         ret = SKIP_TEST;
         goto err_xvfd;
     }
+    /* The keymap is fetched again below, from the atom cache. */
+    ret = xkb_x11_register_connection(ctx, conn);
+    assert(ret);
     ret = xkb_x11_setup_xkb_extension(conn,
                                       XKB_X11_MIN_MAJOR_XKB_VERSION,
                                       XKB_X11_MIN_MINOR_XKB_VERSION,
                                       XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS,
-                                      NULL, NULL, NULL, NULL);
+                                      NULL, NULL, &base_event, NULL);
     if (!ret) {
         ret = SKIP_TEST;
         goto err_xcb;
@@ -151,12 +273,27 @@ main(void)
         goto err_dump;
     }
 
-    ret = 0;
+    ret = test_map_notify(ctx, conn, device_id, base_event, keymap,
+                          one_group, ARRAY_SIZE(one_group));
+    if (ret != 0)
+        goto err_dump;
+
+    /*
+     * Starting from the changed keymap, give the key more groups than
+     * the keymap has, which the update can't apply by itself.
+     */
+    xkb_keymap_unref(keymap);
+    keymap = xkb_x11_keymap_new_from_device(ctx, conn, device_id,
+                                            XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(keymap);
+    ret = test_map_notify(ctx, conn, device_id, base_event, keymap,
+                          three_groups, ARRAY_SIZE(three_groups));
 err_dump:
     free(original);
     free(dump);
     xkb_keymap_unref(keymap);
 err_xcb:
+    xkb_x11_unregister_connection(ctx, conn);
     xcb_disconnect(conn);
 err_xvfd:
     kill(xvfb_pid, SIGTERM);
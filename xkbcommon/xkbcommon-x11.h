@@ -89,7 +89,9 @@ extern "C" {
  *    NewKeyboardNotify, MapNotify, StateNotify; using the
  *    xcb_xkb_select_events_aux() request.
  * 7. When NewKeyboardNotify or MapNotify are received, recreate the
- *    xkb_keymap and xkb_state as described above.
+ *    xkb_keymap and xkb_state as described above.  For MapNotify, the
+ *    xkb_x11_keymap_new_from_map_notify() function can be used instead,
+ *    to only fetch the parts of the keymap which changed.
  * 8. When StateNotify is received, update the xkb_state accordingly
  *    using the xkb_state_update_mask() function.
  *
@@ -185,6 +187,47 @@ xkb_x11_setup_xkb_extension(xcb_connection_t *connection,
 int32_t
 xkb_x11_get_core_keyboard_device_id(xcb_connection_t *connection);
 
+/**
+ * Let a context cache what it learns from an X11 connection.
+ *
+ * X atoms never change on a server, so the context can remember the names
+ * of the atoms seen when fetching keymaps from a registered connection,
+ * and fetching a keymap from it again then needs no requests to resolve
+ * them.  Nothing is cached for connections which are not registered.
+ *
+ * The connection must be unregistered with
+ * xkb_x11_unregister_connection() before it is disconnected; a later
+ * connection could otherwise be taken for it.  Registering a connection
+ * which is already registered has no effect.
+ *
+ * @param context
+ *     The context in which keymaps will be created from the connection.
+ * @param connection
+ *     An XCB connection to the X server.
+ *
+ * @returns 1 on success, or 0 if memory could not be allocated.
+ *
+ * @since 0.5.0
+ */
+int
+xkb_x11_register_connection(struct xkb_context *context,
+                            xcb_connection_t *connection);
+
+/**
+ * Forget what a context cached from an X11 connection.
+ *
+ * @param context
+ *     The context the connection was registered with.
+ * @param connection
+ *     A connection registered with xkb_x11_register_connection(), or one
+ *     which is not registered, in which case nothing happens.
+ *
+ * @since 0.5.0
+ */
+void
+xkb_x11_unregister_connection(struct xkb_context *context,
+                              xcb_connection_t *connection);
+
 /**
  * Create a keymap from an X11 keyboard device.
  *
@@ -212,6 +255,43 @@ xkb_x11_keymap_new_from_device(struct xkb_context *context,
                                int32_t device_id,
                                enum xkb_keymap_compile_flags flags);
 
+/**
+ * Create a keymap from an X11 keyboard device, following a change to
+ * its keymap.
+ *
+ * When a tool like xmodmap changes a few keys, the X server sends an
+ * XkbMapNotify event with the ranges of the keys and key types which
+ * changed.  This function only fetches these parts from the X server,
+ * and takes the rest from the previous keymap of the device.  If the
+ * change is too large to be applied this way, e.g. the range of the
+ * keycodes or the number of key types changed, or a key got more groups
+ * than the keymap had, the whole keymap is fetched again, like
+ * xkb_x11_keymap_new_from_device() does.
+ *
+ * The previous keymap is not modified; states created for it should be
+ * recreated for the returned keymap.  If nothing which the keymap
+ * represents changed, a new reference to the previous keymap is
+ * returned.
+ *
+ * @param keymap
+ *     The current keymap of the device, as created by
+ *     xkb_x11_keymap_new_from_device() or by this function.
+ * @param connection
+ *     An XCB connection to the X server.
+ * @param event
+ *     The XkbMapNotify event for the device, as received from XCB (an
+ *     xcb_xkb_map_notify_event_t).  Other events are an error.
+ *
+ * @returns A keymap retrieved from the X server, or NULL on failure.
+ *
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+struct xkb_keymap *
+xkb_x11_keymap_new_from_map_notify(struct xkb_keymap *keymap,
+                                   xcb_connection_t *connection,
+                                   const xcb_generic_event_t *event);
+
 /**
  * Create a new keyboard state object from an X11 keyboard device.
  *
@@ -107,6 +107,10 @@ extern "C" {
  * Objects are created in a specific context, and multiple contexts may
  * coexist simultaneously.  Objects from different contexts are completely
  * separated and do not share any memory or state.
+ *
+ * If libxkbcommon was built with thread support, keymaps may be created
+ * in several threads at once from the same context.  The context must
+ * not be changed (e.g. its include path or logging) meanwhile.
  */
 struct xkb_context;
 
@@ -362,6 +366,27 @@ struct xkb_rule_names {
     const char *options;
 };
 
+/**
+ * Names of keymap components, also known as KcCGST.
+ *
+ * These are the names of the keycodes, types, compat and symbols
+ * sections a keymap is put together from, as found by looking up RMLVO
+ * names in a rules file.
+ *
+ * @sa xkb_context_resolve_rule_names()
+ * @since 0.5.0
+ */
+struct xkb_component_names {
+    /** The keycodes section, e.g. "evdev+aliases(qwerty)". */
+    char *keycodes;
+    /** The types section, e.g. "complete". */
+    char *types;
+    /** The compat section, e.g. "complete". */
+    char *compat;
+    /** The symbols section, e.g. "pc+us+inet(evdev)". */
+    char *symbols;
+};
+
 /**
  * @defgroup keysyms Keysyms
  * Utility functions related to keysyms.
@@ -452,6 +477,34 @@ enum xkb_keysym_flags {
 xkb_keysym_t
 xkb_keysym_from_name(const char *name, enum xkb_keysym_flags flags);
 
+/**
+ * Get the keysym names which start with a prefix.
+ *
+ * This is meant for completion of keysym names, e.g. in keymap editors.
+ *
+ * @param[in]  prefix The prefix to search for.  The empty prefix matches
+ * every name.
+ * @param[in]  flags  XKB_KEYSYM_CASE_INSENSITIVE to also match names
+ * whose prefix differs by case.
+ * @param[out] names  An array to store the names into.  The names are
+ * static strings, which must not be freed or modified.
+ * @param[in]  size   The number of elements in names.
+ *
+ * The names are stored in alphabetical order, ignoring case.  Only the
+ * first size names are stored; the search does not allocate memory.
+ * Names of the forms "Unnnn" and "0xnnnnnnnn", which are accepted by
+ * xkb_keysym_from_name() for any keysym, are not included.
+ *
+ * @returns The number of names which start with the prefix, which may be
+ * more than size.  If invalid flags are passed, returns -1.
+ *
+ * @sa xkb_keysym_from_name()
+ * @since 0.5.0
+ */
+int
+xkb_keysym_names_with_prefix(const char *prefix, enum xkb_keysym_flags flags,
+                             const char **names, size_t size);
+
 /**
  * Get the Unicode/UTF-8 representation of a keysym.
  *
@@ -471,6 +524,32 @@ xkb_keysym_from_name(const char *name, enum xkb_keysym_flags flags);
 int
 xkb_keysym_to_utf8(xkb_keysym_t keysym, char *buffer, size_t size);
 
+/**
+ * Get the Unicode/UTF-8 representation of an array of keysyms.
+ *
+ * @param[in]  keysyms The keysyms.
+ * @param[in]  count   The number of keysyms.
+ * @param[out] buffer  A buffer to write the UTF-8 string into.
+ * @param[in]  size    The size of buffer.
+ *
+ * The characters of the keysyms are written one after the other, and the
+ * string is NUL-terminated.  Keysyms which do not have a Unicode
+ * representation are skipped.  If the buffer is too small, the string is
+ * truncated to the characters which fit, never in the middle of one.
+ *
+ * @returns The number of bytes in the whole string, not including the
+ * terminating byte, like snprintf(3).  The string was truncated if this
+ * is size or more.
+ *
+ * This function does not perform any @ref keysym-transformations.
+ *
+ * @sa xkb_keysym_to_utf8()
+ * @since 0.5.0
+ */
+int
+xkb_keysyms_to_utf8(const xkb_keysym_t *keysyms, size_t count,
+                    char *buffer, size_t size);
+
 /**
  * Get the Unicode/UTF-32 representation of a keysym.
  *
@@ -486,6 +565,157 @@ xkb_keysym_to_utf8(xkb_keysym_t keysym, char *buffer, size_t size);
 uint32_t
 xkb_keysym_to_utf32(xkb_keysym_t keysym);
 
+/**
+ * Get the keysym corresponding to a Unicode/UTF-32 codepoint.
+ *
+ * @returns The keysym corresponding to the specified Unicode
+ * codepoint, or XKB_KEY_NoSymbol if there is none.
+ *
+ * This function is the inverse of xkb_keysym_to_utf32().  In cases where
+ * a single codepoint corresponds to multiple keysyms, returns the keysym
+ * whose value is the codepoint, if any (e.g. XKB_KEY_EuroSign), and else
+ * the keysym with the lowest value.
+ *
+ * Unicode codepoints which do not have a special (legacy) keysym
+ * encoding use a direct encoding scheme.  These keysyms don't usually
+ * have an associated keysym constant (XKB_KEY_*).
+ *
+ * For noncharacter Unicode codepoints and codepoints outside of the
+ * defined Unicode planes this function returns XKB_KEY_NoSymbol.
+ *
+ * @sa xkb_keysym_to_utf32()
+ * @since 0.5.0
+ */
+xkb_keysym_t
+xkb_utf32_to_keysym(uint32_t ucs);
+
+/**
+ * Classes of keysyms, returned by xkb_keysym_classify().
+ *
+ * A keysym may belong to several classes; for example, XKB_KEY_KP_1 is
+ * both a keypad and a printable keysym.
+ *
+ * @since 0.5.0
+ */
+enum xkb_keysym_class {
+    /**
+     * A modifier keysym: XKB_KEY_Shift_L to XKB_KEY_Hyper_R,
+     * XKB_KEY_ISO_Lock to XKB_KEY_ISO_Level5_Lock, XKB_KEY_Mode_switch and
+     * XKB_KEY_Num_Lock.
+     */
+    XKB_KEYSYM_CLASS_MODIFIER = (1 << 0),
+    /** A keypad keysym: XKB_KEY_KP_Space to XKB_KEY_KP_Equal. */
+    XKB_KEYSYM_CLASS_KEYPAD = (1 << 1),
+    /** A function key keysym: XKB_KEY_F1 to XKB_KEY_F35. */
+    XKB_KEYSYM_CLASS_FUNCTION = (1 << 2),
+    /** A cursor keysym: XKB_KEY_Home to XKB_KEY_Begin. */
+    XKB_KEYSYM_CLASS_CURSOR = (1 << 3),
+    /** A dead keysym, i.e. XKB_KEY_dead_*. */
+    XKB_KEYSYM_CLASS_DEAD = (1 << 4),
+    /**
+     * A keysym whose Unicode representation, as given by
+     * xkb_keysym_to_utf32(), is a character other than a control
+     * character.
+     */
+    XKB_KEYSYM_CLASS_PRINTABLE = (1 << 5)
+};
+
+/**
+ * Get the classes of a keysym.
+ *
+ * These follow the Is*Key() macros of X11/Xutil.h, so that applications
+ * need not carry their own range checks.
+ *
+ * @returns A mask of enum xkb_keysym_class flags, or 0 if the keysym is
+ * in none of the classes.
+ *
+ * @sa xkb_keysyms_classify()
+ * @since 0.5.0
+ */
+enum xkb_keysym_class
+xkb_keysym_classify(xkb_keysym_t keysym);
+
+/**
+ * Get the classes of an array of keysyms.
+ *
+ * @param[in]  keysyms The keysyms.
+ * @param[in]  count   The number of keysyms.
+ * @param[out] classes An array of count elements, in which the classes
+ * of each keysym are stored as by xkb_keysym_classify().
+ *
+ * @sa xkb_keysym_classify()
+ * @since 0.5.0
+ */
+void
+xkb_keysyms_classify(const xkb_keysym_t *keysyms, size_t count,
+                     enum xkb_keysym_class *classes);
+
+/**
+ * Test whether a keysym is a modifier keysym.
+ *
+ * @returns 1 if it is, 0 otherwise.
+ *
+ * @sa XKB_KEYSYM_CLASS_MODIFIER
+ * @since 0.5.0
+ */
+int
+xkb_keysym_is_modifier(xkb_keysym_t keysym);
+
+/**
+ * Test whether a keysym is a keypad keysym.
+ *
+ * @returns 1 if it is, 0 otherwise.
+ *
+ * @sa XKB_KEYSYM_CLASS_KEYPAD
+ * @since 0.5.0
+ */
+int
+xkb_keysym_is_keypad(xkb_keysym_t keysym);
+
+/**
+ * Test whether a keysym is a function key keysym.
+ *
+ * @returns 1 if it is, 0 otherwise.
+ *
+ * @sa XKB_KEYSYM_CLASS_FUNCTION
+ * @since 0.5.0
+ */
+int
+xkb_keysym_is_function(xkb_keysym_t keysym);
+
+/**
+ * Test whether a keysym is a cursor keysym.
+ *
+ * @returns 1 if it is, 0 otherwise.
+ *
+ * @sa XKB_KEYSYM_CLASS_CURSOR
+ * @since 0.5.0
+ */
+int
+xkb_keysym_is_cursor(xkb_keysym_t keysym);
+
+/**
+ * Test whether a keysym is a dead keysym.
+ *
+ * @returns 1 if it is, 0 otherwise.
+ *
+ * @sa XKB_KEYSYM_CLASS_DEAD
+ * @since 0.5.0
+ */
+int
+xkb_keysym_is_dead(xkb_keysym_t keysym);
+
+/**
+ * Test whether a keysym is a printable keysym.
+ *
+ * @returns 1 if it is, 0 otherwise.
+ *
+ * @sa XKB_KEYSYM_CLASS_PRINTABLE
+ * @since 0.5.0
+ */
+int
+xkb_keysym_is_printable(xkb_keysym_t keysym);
+
 /** @} */
 
 /**
@@ -572,6 +802,40 @@ xkb_context_set_user_data(struct xkb_context *context, void *user_data);
 void *
 xkb_context_get_user_data(struct xkb_context *context);
 
+/**
+ * Set the directory in which compiled keymaps are cached.
+ *
+ * If set, xkb_keymap_new_from_names() stores the keymaps it compiles in
+ * this directory, and on later calls with the same names loads them from
+ * there instead of compiling them again.  A cached keymap is only used if
+ * it was compiled with the same include path, and none of the files read
+ * while compiling it have changed since.  Otherwise it is compiled again
+ * and the cache entry is replaced.
+ *
+ * The cache is disabled by default.
+ *
+ * @param path The cache directory, which must already exist and be
+ * writable.  If NULL, the cache is disabled.
+ *
+ * @returns 1 on success, or 0 if the directory is not accessible.
+ *
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+int
+xkb_context_set_cache_path(struct xkb_context *context, const char *path);
+
+/**
+ * Get the directory in which compiled keymaps are cached.
+ *
+ * @returns The cache directory, or NULL if the cache is disabled.
+ *
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+const char *
+xkb_context_get_cache_path(struct xkb_context *context);
+
 /** @} */
 
 /**
@@ -582,6 +846,12 @@ xkb_context_get_user_data(struct xkb_context *context);
  * include statement is encountered during keymap compilation.
  * In most cases, the default include paths are sufficient.
  *
+ * The context lists the directories of the include paths when it first
+ * searches them, and keeps the listing.  A file added later is still
+ * found if no include path has it in the listing; to have it take
+ * precedence over a file later in the include path, clear and set the
+ * include path again.
+ *
  * @{
  */
 
@@ -747,6 +1017,143 @@ xkb_context_set_log_fn(struct xkb_context *context,
 
 /** @} */
 
+/**
+ * @defgroup stats Statistics
+ * Measuring where the library spends its time.
+ *
+ * @{
+ */
+
+/**
+ * Statistics collected by a context.
+ *
+ * Times are in nanoseconds of a monotonic clock.  Work done on several
+ * threads at once, e.g. with XKB_KEYMAP_COMPILE_PARALLEL, is added up,
+ * so the times of the phases may add up to more than compile_time.
+ *
+ * @sa xkb_context_set_stats_enabled()
+ * @since 0.5.0
+ */
+struct xkb_context_stats {
+    /** The number of keymaps compiled successfully. */
+    uint64_t keymaps_compiled;
+    /** Time spent compiling keymaps, from start to finish. */
+    uint64_t compile_time;
+    /** Time spent looking up RMLVO names in rules files. */
+    uint64_t rules_time;
+    /** Time spent finding and opening files in the include path. */
+    uint64_t file_lookup_time;
+    /** Time spent parsing keymap files and strings. */
+    uint64_t parse_time;
+    /** Time spent compiling the keycodes sections. */
+    uint64_t keycodes_time;
+    /** Time spent compiling the types sections. */
+    uint64_t types_time;
+    /** Time spent compiling the compat sections. */
+    uint64_t compat_time;
+    /** Time spent compiling the symbols sections. */
+    uint64_t symbols_time;
+    /**
+     * Time spent applying the compat interpretations and the modifier
+     * map to the keys, once the sections are compiled.
+     */
+    uint64_t derive_time;
+    /** The number of files opened from the include path. */
+    uint64_t files_opened;
+    /** The number of keymap files and strings parsed. */
+    uint64_t files_parsed;
+    /** The deepest nesting of include statements. */
+    uint64_t max_include_depth;
+    /** The number of strings added to the context's atom table. */
+    uint64_t atoms_interned;
+    /** The number of bytes allocated for the parsed files. */
+    uint64_t parse_bytes;
+    /**
+     * The number of filters created by xkb_state_update_key(), i.e. the
+     * number of key actions which were started.
+     */
+    uint64_t filters_created;
+    /** The number of times the LED state of a keyboard state was updated. */
+    uint64_t led_updates;
+};
+
+/**
+ * A function which receives the statistics of a keymap compilation.
+ *
+ * @param context The context in which the keymap was compiled.
+ * @param stats   The statistics of this compilation only.  The
+ * max_include_depth is that of this compilation, and the state counters
+ * are 0.  The pointer is only valid until the function returns.
+ * @param data    The user data passed to xkb_context_set_stats_fn().
+ *
+ * @sa xkb_context_set_stats_fn()
+ */
+typedef void (*xkb_context_stats_fn)(struct xkb_context *context,
+                                     const struct xkb_context_stats *stats,
+                                     void *data);
+
+/**
+ * Enable or disable collecting statistics in a context.
+ *
+ * Statistics are not collected by default.  When enabled, the counters
+ * start from 0; when disabled, they are discarded.
+ *
+ * @returns 1 on success, or 0 if out of memory.
+ *
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+int
+xkb_context_set_stats_enabled(struct xkb_context *context, int enabled);
+
+/**
+ * Get the statistics collected in a context.
+ *
+ * @param context   The context.
+ * @param stats_out Filled with the totals since statistics were enabled
+ * or last reset, or with zeros if they are not enabled.  Compilations
+ * running in other threads meanwhile may be partly counted.
+ *
+ * @returns 1 if statistics are enabled, or 0 otherwise.
+ *
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+int
+xkb_context_get_stats(struct xkb_context *context,
+                      struct xkb_context_stats *stats_out);
+
+/**
+ * Set the statistics collected in a context back to 0.
+ *
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+void
+xkb_context_reset_stats(struct xkb_context *context);
+
+/**
+ * Set a function to be called after each keymap compilation.
+ *
+ * The function is called while statistics are enabled, once for each
+ * keymap compiled in the context, whether it succeeded or not, e.g. to
+ * export the statistics to a monitoring system.  Keymaps which are
+ * loaded from the cache (see xkb_context_set_cache_path()) are not
+ * compiled.
+ *
+ * @param context  The context.
+ * @param stats_fn The function, or NULL to stop calling it.
+ * @param data     User data passed to @p stats_fn.
+ *
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+void
+xkb_context_set_stats_fn(struct xkb_context *context,
+                         xkb_context_stats_fn stats_fn, void *data);
+
+/** @} */
+
 /**
  * @defgroup keymap Keymap Creation
  * Creating and destroying keymaps.
@@ -757,7 +1164,21 @@ xkb_context_set_log_fn(struct xkb_context *context,
 /** Flags for keymap compilation. */
 enum xkb_keymap_compile_flags {
     /** Do not apply any flags. */
-    XKB_KEYMAP_COMPILE_NO_FLAGS = 0
+    XKB_KEYMAP_COMPILE_NO_FLAGS = 0,
+    /**
+     * Read and parse the files included by the keymap's sections in
+     * parallel, using a thread for each section.  This reduces the time
+     * it takes to compile keymaps with many includes, such as those
+     * created from RMLVO names.
+     *
+     * While the keymap is compiled, the context's logging function may be
+     * called from these threads, and messages may come in a different
+     * order.  If libxkbcommon was built without thread support, this flag
+     * has no effect.
+     *
+     * @since 0.5.0
+     */
+    XKB_KEYMAP_COMPILE_PARALLEL = (1 << 0)
 };
 
 /**
@@ -781,6 +1202,54 @@ xkb_keymap_new_from_names(struct xkb_context *context,
                           const struct xkb_rule_names *names,
                           enum xkb_keymap_compile_flags flags);
 
+/**
+ * Look up the keymap components for several sets of RMLVO names.
+ *
+ * This performs the rules lookup step of xkb_keymap_new_from_names() on
+ * all of the names at once, without compiling any keymap.  Names which
+ * use the same rules file are resolved in a single pass over it, so this
+ * is much faster than looking them up one by one, e.g. when enumerating
+ * many layout and option combinations.
+ *
+ * @param context    The context in which to look up the names.
+ * @param names      An array of @p count RMLVO names.  Default values are
+ * used as in xkb_keymap_new_from_names().
+ * @param count      The number of names.
+ * @param components An array of @p count entries, in which the components
+ * for each of the names are stored.  If a name could not be resolved, all
+ * of the fields of its entry are set to NULL.
+ *
+ * @returns The number of names which were resolved.
+ *
+ * The entries must be freed with xkb_component_names_clear().
+ *
+ * @sa xkb_rule_names
+ * @sa xkb_component_names
+ * @memberof xkb_context
+ * @since 0.5.0
+ */
+size_t
+xkb_context_resolve_rule_names(struct xkb_context *context,
+                               const struct xkb_rule_names *names,
+                               size_t count,
+                               struct xkb_component_names *components);
+
+/**
+ * Free the strings in keymap components returned by
+ * xkb_context_resolve_rule_names().
+ *
+ * The fields of the entries are set to NULL; the array itself is not
+ * freed.
+ *
+ * @param components An array of @p count entries.
+ * @param count      The number of entries.
+ *
+ * @since 0.5.0
+ */
+void
+xkb_component_names_clear(struct xkb_component_names *components,
+                          size_t count);
+
 /** The possible keymap formats. */
 enum xkb_keymap_format {
     /** The current/classic XKB text format, as generated by xkbcomp -xkb. */
@@ -887,6 +1356,157 @@ char *
 xkb_keymap_get_as_string(struct xkb_keymap *keymap,
                          enum xkb_keymap_format format);
 
+/**
+ * A function which receives the text of a keymap, piece by piece.
+ *
+ * @param data The user data passed to xkb_keymap_write().
+ * @param text The next piece of the text.  It is not NUL-terminated, and
+ * is only valid until the function returns.
+ * @param len  The length of the piece, in bytes.
+ *
+ * @returns 1 to continue, or 0 to stop writing, in which case
+ * xkb_keymap_write() fails.
+ *
+ * @sa xkb_keymap_write()
+ */
+typedef int (*xkb_keymap_write_fn)(void *data, const char *text, size_t len);
+
+/**
+ * Flags for writing a keymap.
+ *
+ * @sa xkb_keymap_write()
+ */
+enum xkb_keymap_serialize_flags {
+    /** Do not apply any flags. */
+    XKB_KEYMAP_SERIALIZE_NO_FLAGS = 0,
+    /**
+     * Write the keymap as compactly as possible, e.g. to send it to
+     * clients.
+     *
+     * Whitespace is squeezed out, and fields which have their default
+     * value, or which are only needed to compile the keymap and are
+     * already applied to the keys (such as the compat interpretations,
+     * key aliases, level names and section names), are left out.  The
+     * text compiles to a keymap which behaves the same as this one, but
+     * is not meant to be read.
+     */
+    XKB_KEYMAP_SERIALIZE_COMPACT = (1 << 0)
+};
+
+/**
+ * Write the compiled keymap to a function, without building the whole
+ * string in memory first.
+ *
+ * @param keymap   The keymap to write.
+ * @param format   The keymap format to use, as in xkb_keymap_get_as_string().
+ * @param flags    Optional flags for the output, or 0.
+ * @param write_fn The function which receives the text.
+ * @param data     User data passed to @p write_fn.
+ *
+ * @returns 1 on success, or 0 if the format or flags are not supported
+ * or @p write_fn failed.
+ *
+ * Without flags, the concatenated pieces are the same as the string
+ * returned by xkb_keymap_get_as_string(), without the terminating NUL.
+ *
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+int
+xkb_keymap_write(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                 enum xkb_keymap_serialize_flags flags,
+                 xkb_keymap_write_fn write_fn, void *data);
+
+/**
+ * Write the compiled keymap to a file descriptor, e.g. a memfd to be
+ * shared with a client.
+ *
+ * @returns 1 on success, or 0 if unsuccessful, in which case errno may
+ * be set by write(2).  The terminating NUL is not written.
+ *
+ * @sa xkb_keymap_write()
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+int
+xkb_keymap_write_to_fd(struct xkb_keymap *keymap,
+                       enum xkb_keymap_format format,
+                       enum xkb_keymap_serialize_flags flags, int fd);
+
+/**
+ * Write the compiled keymap to a buffer as a NUL-terminated string.
+ *
+ * At most @p size bytes are written, including the terminating NUL.  If
+ * @p size is 0, nothing is written and @p buffer may be NULL; this can be
+ * used to get the exact size of the buffer needed.
+ *
+ * @returns The length of the keymap string, not including the
+ * terminating NUL, or 0 if unsuccessful.  If the returned length is
+ * @p size or more, the string in the buffer was truncated.
+ *
+ * @sa xkb_keymap_write()
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+size_t
+xkb_keymap_write_to_buffer(struct xkb_keymap *keymap,
+                           enum xkb_keymap_format format,
+                           enum xkb_keymap_serialize_flags flags,
+                           char *buffer, size_t size);
+
+/**
+ * Get the compiled keymap as a string owned by the keymap.
+ *
+ * The string is made on the first call, and kept on the keymap; later
+ * calls return the same string without formatting the keymap again.
+ * This suits e.g. a server which sends the keymap to many clients.  It
+ * may be called from several threads at once.
+ *
+ * @param keymap     The keymap.
+ * @param format     The keymap format to use.  Only the format from which
+ * the keymap was created, or XKB_KEYMAP_USE_ORIGINAL_FORMAT, is supported.
+ * @param flags      Optional flags for the output, or 0.  A string is
+ * kept for each set of flags.
+ * @param length_out If not NULL, set to the length of the string, not
+ * including the terminating NUL.
+ *
+ * @returns The keymap as a NUL-terminated string, or NULL if
+ * unsuccessful.  The string must not be modified or freed; it is valid
+ * for as long as the keymap is.
+ *
+ * @sa xkb_keymap_get_as_string()
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+const char *
+xkb_keymap_get_text(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                    enum xkb_keymap_serialize_flags flags, size_t *length_out);
+
+/**
+ * Get the compiled keymap as a sealed, read-only file owned by the keymap.
+ *
+ * The file is a memfd holding the string from xkb_keymap_get_text(),
+ * including the terminating NUL.  It is sealed against any change, so it
+ * can be passed as is to any number of clients, which can map it
+ * privately.  Like the string, it is made on the first call only.
+ *
+ * @param keymap   The keymap.
+ * @param format   The keymap format to use, as in xkb_keymap_get_text().
+ * @param flags    Optional flags for the output, as in xkb_keymap_get_text().
+ * @param size_out If not NULL, set to the size of the file.
+ *
+ * @returns A file descriptor, or -1 if unsuccessful or if sealed files
+ * are not supported on the system.  The file descriptor must not be
+ * closed; it is valid for as long as the keymap is.
+ *
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+int
+xkb_keymap_get_text_fd(struct xkb_keymap *keymap,
+                       enum xkb_keymap_format format,
+                       enum xkb_keymap_serialize_flags flags, size_t *size_out);
+
 /** @} */
 
 /**
@@ -972,6 +1592,23 @@ xkb_keymap_mod_get_name(struct xkb_keymap *keymap, xkb_mod_index_t idx);
 xkb_mod_index_t
 xkb_keymap_mod_get_index(struct xkb_keymap *keymap, const char *name);
 
+/**
+ * Get the mask of a modifier by name.
+ *
+ * This resolves the name once, so that the result can be kept and passed
+ * to xkb_state_mod_mask_is_active() instead of looking the name up on
+ * every query.  Masks of several modifiers may be combined with bitwise OR.
+ *
+ * @returns The mask.  If no modifier with this name exists, returns 0,
+ * which xkb_state_mod_mask_is_active() rejects.
+ *
+ * @sa xkb_keymap_mod_get_index()
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+xkb_mod_mask_t
+xkb_keymap_mod_get_mask(struct xkb_keymap *keymap, const char *name);
+
 /**
  * Get the number of layouts in the keymap.
  *
@@ -1049,6 +1686,22 @@ xkb_keymap_led_get_name(struct xkb_keymap *keymap, xkb_led_index_t idx);
 xkb_led_index_t
 xkb_keymap_led_get_index(struct xkb_keymap *keymap, const char *name);
 
+/**
+ * Get the mask of a LED by name.
+ *
+ * The result can be kept and passed to xkb_state_led_mask_is_active().
+ * Masks of several LEDs may be combined with bitwise OR.
+ *
+ * @returns The mask.  If no LED with this name exists, returns 0,
+ * which xkb_state_led_mask_is_active() rejects.
+ *
+ * @sa xkb_keymap_led_get_index()
+ * @memberof xkb_keymap
+ * @since 0.5.0
+ */
+xkb_led_mask_t
+xkb_keymap_led_get_mask(struct xkb_keymap *keymap, const char *name);
+
 /**
  * Get the number of layouts for a specific key.
  *
@@ -1436,8 +2089,9 @@ xkb_state_key_get_level(struct xkb_state *state, xkb_keycode_t key,
                         xkb_layout_index_t layout);
 
 /**
- * Match flags for xkb_state_mod_indices_are_active() and
- * xkb_state_mod_names_are_active(), specifying the conditions for a
+ * Match flags for xkb_state_mod_indices_are_active(),
+ * xkb_state_mod_names_are_active(), xkb_state_mod_mask_is_active() and
+ * xkb_state_led_mask_is_active(), specifying the conditions for a
  * successful match.  XKB_STATE_MATCH_NON_EXCLUSIVE is bitmaskable with
  * the other modes.
  */
@@ -1565,6 +2219,30 @@ xkb_state_mod_indices_are_active(struct xkb_state *state,
                                  enum xkb_state_match match,
                                  ...);
 
+/**
+ * Test whether a set of modifiers are active in a given keyboard state by
+ * mask.
+ *
+ * @param state The keyboard state.
+ * @param mask  The set of modifiers to test, e.g. as returned by
+ * xkb_keymap_mod_get_mask().
+ * @param type  The component of the state against which to match the
+ * given modifiers.
+ * @param match The manner by which to match the state against the
+ * given modifiers.
+ *
+ * @returns 1 if the modifiers are active, 0 if they are not.  If the mask
+ * is empty, or contains modifiers which are invalid in the keymap,
+ * returns -1.
+ *
+ * @memberof xkb_state
+ * @since 0.5.0
+ */
+int
+xkb_state_mod_mask_is_active(struct xkb_state *state, xkb_mod_mask_t mask,
+                             enum xkb_state_component type,
+                             enum xkb_state_match match);
+
 /**
  * @page consumed-modifiers Consumed Modifiers
  * @parblock
@@ -1720,6 +2398,25 @@ xkb_state_led_name_is_active(struct xkb_state *state, const char *name);
 int
 xkb_state_led_index_is_active(struct xkb_state *state, xkb_led_index_t idx);
 
+/**
+ * Test whether a set of LEDs are active in a given keyboard state by mask.
+ *
+ * @param state The keyboard state.
+ * @param mask  The set of LEDs to test, e.g. as returned by
+ * xkb_keymap_led_get_mask().
+ * @param match The manner by which to match the state against the
+ * given LEDs.
+ *
+ * @returns 1 if the LEDs are active, 0 if they are not.  If the mask
+ * is empty, or contains LEDs which are invalid in the keymap, returns -1.
+ *
+ * @memberof xkb_state
+ * @since 0.5.0
+ */
+int
+xkb_state_led_mask_is_active(struct xkb_state *state, xkb_led_mask_t mask,
+                             enum xkb_state_match match);
+
 /** @} */
 
 /* Leave this include last, so it can pick up our types, etc. */